@@ -36,6 +36,22 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 #include "SDL2_rotozoom.h"
 #include "SDL2_gfxPrimitives_font.h"
 
+/*!
+\brief Defined when SDL_RenderGeometry is available (SDL 2.0.18 or newer).
+
+Define SDL2_GFX_NO_GEOMETRY at compile time to always use the fallback code paths.
+*/
+#if SDL_VERSION_ATLEAST(2,0,18) && !defined(SDL2_GFX_NO_GEOMETRY)
+#define SDL2_GFX_HAVE_GEOMETRY 1
+#endif
+
+/*!
+\brief Defined when SDL draws lines as Bresenham points by default (SDL 2.0.20 or newer).
+*/
+#if SDL_VERSION_ATLEAST(2,0,20)
+#define SDL2_GFX_HAVE_LINE_POINTS 1
+#endif
+
 /* ---- Structures */
 
 /*!
@@ -59,3126 +75,15093 @@ typedef struct {
 	Sint16 last1x, last1y, last2x, last2y, first1x, first1y, first2x, first2y, tempx, tempy;
 } SDL2_gfxMurphyIterator;
 
-/* ---- Pixel */
+/*!
+\brief A run of recorded batch primitives sharing the same color and blend mode.
+
+When a batch is flushed, runs of the same color are grouped: group is the index of the
+first run of the group, which links the runs of the group through next and last and the
+previous group through previous. x1, y1, x2, y2 hold the bounds of the run and groupX1,
+groupY1, groupX2, groupY2 those of the group it starts.
+*/
+typedef struct {
+	Uint8 r, g, b, a;
+	int firstPoint, numPoints;
+	int firstRect, numRects;
+	int firstOutline, numOutlines;
+	int firstStrip, numStrips;
+	int x1, y1, x2, y2;
+	int groupX1, groupY1, groupX2, groupY2;
+	int group, next, last, previous;
+} SDL2_gfxBatchRun;
 
 /*!
-\brief Draw pixel  in currently set color.
+\brief A recorded line or polyline of a batch.
+*/
+typedef struct {
+	int firstPoint, numPoints;
+} SDL2_gfxBatchStrip;
 
-\param renderer The renderer to draw on.
-\param x X (horizontal) coordinate of the pixel.
-\param y Y (vertical) coordinate of the pixel.
+/*!
+\brief The structure holding the recorded primitives of a batch.
 
-\returns Returns 0 on success, -1 on failure.
+Points, rectangles, rectangle outlines and lines are stored in growable arrays
+and grouped into runs of consecutive primitives drawn with the same color.
+The batch of a display list is never drawn; list is set and runs below
+numSealedRuns have already been turned into draw calls of the list.
 */
-int pixel(SDL_Renderer *renderer, Sint16 x, Sint16 y)
-{
-	return SDL_RenderDrawPoint(renderer, x, y);
-}
+struct gfxBatch {
+	SDL_Renderer *renderer;
+	int active;
+	Uint8 r, g, b, a;
+	SDL2_gfxBatchRun *runs;
+	int numRuns, maxRuns;
+	int numSealedRuns;
+	SDL_Point *points;
+	int numPoints, maxPoints;
+	SDL_Rect *rects;
+	int numRects, maxRects;
+	SDL_Rect *outlines;
+	int numOutlines, maxOutlines;
+	SDL2_gfxBatchStrip *strips;
+	int numStrips, maxStrips;
+	SDL_Point *lines;
+	int numLines, maxLines;
+	gfxContext *context;
+	gfxDisplayList *list;
+	gfxBatch *next;
+};
 
 /*!
-\brief Draw pixel with blending enabled if a<255.
+\brief Types of the draw calls of a display list.
+*/
+enum {
+	SDL2_GFX_LIST_RUNS,
+	SDL2_GFX_LIST_GEOMETRY,
+	SDL2_GFX_LIST_COPY
+};
 
-\param renderer The renderer to draw on.
-\param x X (horizontal) coordinate of the pixel.
-\param y Y (vertical) coordinate of the pixel.
-\param color The color value of the pixel to draw (0xRRGGBBAA). 
+/*!
+\brief A draw call of a display list.
 
-\returns Returns 0 on success, -1 on failure.
+Runs refer to the batch of the list: first and count select the runs, of which
+only the lines are drawn when geometry is available. Geometry selects count
+vertices from first and the indices from firstIndex, which are relative to the
+first vertex. Copies keep the rectangles and the color and alpha modulation
+of the texture.
 */
-int pixelColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint32 color)
-{
-	Uint8 *c = (Uint8 *)&color; 
-	return pixelRGBA(renderer, x, y, c[0], c[1], c[2], c[3]);
-}
+typedef struct {
+	int type;
+	SDL_Texture *texture;
+	SDL_BlendMode blend;
+	int first, count;
+	int firstIndex, numIndices;
+	SDL_Rect srcrect, dstrect;
+	Uint8 r, g, b, a;
+} SDL2_gfxListOp;
 
 /*!
-\brief Draw pixel with blending enabled if a<255.
+\brief A texture created from a surface for the textured polygons of a display list.
+*/
+typedef struct {
+	SDL_Surface *surface;
+	SDL_Texture *texture;
+} SDL2_gfxListTexture;
 
-\param renderer The renderer to draw on.
-\param x X (horizontal) coordinate of the pixel.
-\param y Y (vertical) coordinate of the pixel.
-\param r The red color value of the pixel to draw. 
-\param g The green color value of the pixel to draw.
-\param b The blue color value of the pixel to draw.
-\param a The alpha value of the pixel to draw.
+/*!
+\brief The structure holding a display list.
 
-\returns Returns 0 on success, -1 on failure.
+Primitives are recorded through the batch of the list. With SDL 2.0.18 or newer
+the pixels, rectangles and outlines are turned into colored triangles as soon as
+a run is complete and neighbouring triangles are merged into one draw call, so
+only lines stay in the batch. The bounds (inclusive) cover everything recorded.
+Textures uploaded for recorded textured polygons belong to the list.
 */
-int pixelRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
-{
-	int result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
-	result |= SDL_RenderDrawPoint(renderer, x, y);
-	return result;
-}
+struct gfxDisplayList {
+	gfxBatch batch;
+	SDL2_gfxListOp *ops;
+	int numOps, maxOps;
+	SDL2_gfxListTexture *textures;
+	int numTextures, maxTextures;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL_Vertex *vertices;
+	int numVertices, maxVertices;
+	int *indices;
+	int numIndices, maxIndices;
+#endif
+	int empty;
+	int x1, y1, x2, y2;
+};
 
 /*!
-\brief Draw pixel with blending enabled and using alpha weight on color.
+\brief Enables shadowing the draw color and blend mode of renderers by default.
 
-\param renderer The renderer to draw on.
-\param x The horizontal coordinate of the pixel.
-\param y The vertical position of the pixel.
-\param r The red color value of the pixel to draw. 
-\param g The green color value of the pixel to draw.
-\param b The blue color value of the pixel to draw.
-\param a The alpha value of the pixel to draw.
-\param weight The weight multiplied into the alpha value of the pixel.
+Disabled by default. Define as 1 at compile time to enable shadowing without calling
+gfxPrimitivesSetStateShadowing().
+*/
+#ifndef SDL2_GFX_STATE_SHADOWING
+#define SDL2_GFX_STATE_SHADOWING 0
+#endif
 
-\returns Returns 0 on success, -1 on failure.
+/*!
+\brief The draw color and blend mode last set on a renderer and the number of state calls issued and skipped.
 */
-int pixelRGBAWeight(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Uint32 weight)
-{
-	/*
-	* Modify Alpha by weight 
-	*/
-	Uint32 ax = a;
-	ax = ((ax * weight) >> 8);
-	if (ax > 255) {
-		a = 255;
-	} else {
-		a = (Uint8)(ax & 0x000000ff);
-	}
+typedef struct SDL2_gfxRendererState {
+	SDL_Renderer *renderer;
+	int hasBlend, hasColor;
+	SDL_BlendMode blend;
+	Uint8 r, g, b, a;
+	Uint32 issued, elided;
+	struct SDL2_gfxRendererState *next;
+} SDL2_gfxRendererState;
 
-	return pixelRGBA(renderer, x, y, r, g, b, a);
-}
+/*!
+\brief The damaged area tracked by a context.
 
-/* ---- Hline */
+The area touched by the primitive currently drawn is pending (inclusive bounds in
+drawing coordinates) until it is clipped to the visible area of its target, moved
+by the viewport origin and scaled into render target coordinates, and added to the
+list of non-overlapping damaged rectangles.
+*/
+typedef struct {
+	int maxRects;
+	SDL_Rect *rects;
+	int numRects;
+	int pending;
+	int x1, y1, x2, y2;
+	SDL_Rect clip;
+	int originX, originY;
+	float scaleX, scaleY;
+} SDL2_gfxDamage;
 
 /*!
-\brief Draw horizontal line in currently set color
+\brief The structure describing where the internal drawing functions emit to.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. left) of the line.
-\param x2 X coordinate of the second point (i.e. right) of the line.
-\param y Y coordinate of the points of the line.
+All primitives are drawn through a target so they can either go to the
+renderer directly, be recorded into an active batch or be written straight
+into the memory of a surface. The visible area is looked up once when the
+target is set up; when cull is set, work outside of clip is skipped.
+*/
+typedef struct {
+	SDL_Renderer *renderer;
+	SDL2_gfxRendererState *state;
+	gfxContext *context;
+	gfxBatch *batch;
+	int coverage;
+	SDL_Surface *surface;
+	int locked;
+	Uint32 color;
+	Uint8 r, g, b, a;
+	int blendIndex;
+	Uint8 blendPixel;
+	int cull;
+	SDL_Rect clip;
+	SDL2_gfxDamage *damage;
+} SDL2_gfxTarget;
 
-\returns Returns 0 on success, -1 on failure.
+/*!
+\brief Enables collecting anti-aliased pixels into per-alpha point sets by default.
+
+Define as 0 at compile time to plot anti-aliased pixels one by one unless
+enabled at runtime with gfxPrimitivesSetAABatching().
 */
-int hline(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y)
-{
-	return SDL_RenderDrawLine(renderer, x1, y, x2, y);;
-}
+#ifndef SDL2_GFX_AA_BATCHING
+#define SDL2_GFX_AA_BATCHING 1
+#endif
 
+/*!
+\brief The structure holding the anti-aliased pixels of a primitive until they are drawn.
+*/
+typedef struct {
+	SDL_Point *points;
+	SDL_Point *sorted;
+	Uint8 *alphas;
+	int numPoints, maxPoints;
+} SDL2_gfxCoverage;
 
 /*!
-\brief Draw horizontal line with blending.
+\brief A growable block of temporary memory.
+*/
+typedef struct {
+	void *data;
+	size_t size;
+} SDL2_gfxScratch;
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. left) of the line.
-\param x2 X coordinate of the second point (i.e. right) of the line.
-\param y Y coordinate of the points of the line.
-\param color The color value of the line to draw (0xRRGGBBAA). 
+/*!
+\brief A shape tessellated relative to its origin, kept by the shape cache.
 
-\returns Returns 0 on success, -1 on failure.
+Ellipses and arcs are relative to their center, rounded rectangles and boxes to
+their upper left corner. The key fields identify the shape; the pixels, their
+weights and the rectangles follow the structure in the same allocation.
+Anti-aliased shapes weight the alpha value of each pixel with weight / 256;
+the weights are NULL for shapes drawn in a single color.
 */
-int hlineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y, Uint32 color)
-{
-	Uint8 *c = (Uint8 *)&color; 
-	return hlineRGBA(renderer, x1, x2, y, c[0], c[1], c[2], c[3]);
-}
+typedef struct SDL2_gfxShape {
+	int type;
+	int rx, ry, start, end, filled;
+	SDL_Point *points;
+	Uint16 *weights;
+	int numPoints;
+	SDL_Rect *rects;
+	int numRects;
+	struct SDL2_gfxShape *next;
+} SDL2_gfxShape;
 
 /*!
-\brief Draw horizontal line with blending.
+\brief The tessellated shapes of a context, most recently used first, and the cache statistics.
+*/
+typedef struct {
+	SDL2_gfxShape *shapes;
+	int count;
+	int size;
+	int sizeSet;
+	Uint32 hits, misses;
+} SDL2_gfxShapeCache;
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. left) of the line.
-\param x2 X coordinate of the second point (i.e. right) of the line.
-\param y Y coordinate of the points of the line.
-\param r The red value of the line to draw. 
-\param g The green value of the line to draw. 
-\param b The blue value of the line to draw. 
-\param a The alpha value of the line to draw. 
+/*!
+\brief The structure holding the scratch memory and active batches used by the drawing functions.
 
-\returns Returns 0 on success, -1 on failure.
+Primitives never free their temporary memory; the buffers only grow and are
+reused by the next primitive drawn with the same context.
 */
-int hlineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
-{
-	int result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
-	result |= SDL_RenderDrawLine(renderer, x1, y, x2, y);
-	return result;
-}
+struct gfxContext {
+	SDL2_gfxScratch polyInts;
+	SDL2_gfxScratch points;
+	SDL2_gfxScratch vertices;
+	SDL2_gfxScratch bezier;
+	SDL2_gfxScratch geometry;
+	SDL2_gfxScratch indices;
+	SDL2_gfxScratch spans;
+	SDL2_gfxScratch cells;
+	SDL2_gfxScratch runs;
+	SDL2_gfxCoverage coverage;
+	SDL2_gfxScratch shapePoints;
+	SDL2_gfxScratch shapeWeights;
+	SDL2_gfxScratch shapeRects;
+	SDL2_gfxShapeCache shapes;
+	SDL2_gfxDamage damage;
+	SDL2_gfxRendererState *state;
+	int stateGeneration;
+	gfxBatch *batches;
+#ifdef SDL2_GFX_STATS
+	gfxPrimitivesStats stats[GFX_STATS_FAMILIES];
+	gfxPrimitivesStats *statsCurrent;
+	int statsDepth;
+	Uint64 statsStart;
+#endif
+};
 
-/* ---- Vline */
+/* ---- Context */
 
 /*!
-\brief Draw vertical line in currently set color
+\brief Context used by all threads which have not set their own context.
+*/
+static gfxContext gfxPrimitivesDefaultContext;
 
-\param renderer The renderer to draw on.
-\param x X coordinate of points of the line.
-\param y1 Y coordinate of the first point (i.e. top) of the line.
-\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+/*!
+\brief Thread local storage slot holding the current context of each thread (0 until first used).
+*/
+static SDL_TLSID gfxPrimitivesContextTLS = 0;
 
-\returns Returns 0 on success, -1 on failure.
+/*!
+\brief Lock protecting the creation of the thread local storage slot.
 */
-int vline(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2)
-{
-	return SDL_RenderDrawLine(renderer, x, y1, x, y2);;
-}
+static SDL_SpinLock gfxPrimitivesContextLock = 0;
 
 /*!
-\brief Draw vertical line with blending.
+\brief Create a drawing context.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the points of the line.
-\param y1 Y coordinate of the first point (i.e. top) of the line.
-\param y2 Y coordinate of the second point (i.e. bottom) of the line.
-\param color The color value of the line to draw (0xRRGGBBAA). 
+A context owns the temporary memory used by the drawing functions (polygon edge
+tables, point and vertex arrays, bezier buffers, spans and anti-aliased pixels), the
+cached shapes and the batches activated while it is current. Threads drawing concurrently to
+different renderers or surfaces must each use their own context.
 
-\returns Returns 0 on success, -1 on failure.
+\returns Returns the new context or NULL on failure.
 */
-int vlineColor(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2, Uint32 color)
+gfxContext *gfxCreateContext(void)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return vlineRGBA(renderer, x, y1, y2, c[0], c[1], c[2], c[3]);
+	return (gfxContext *)calloc(1, sizeof(gfxContext));
 }
 
 /*!
-\brief Draw vertical line with blending.
-
-\param renderer The renderer to draw on.
-\param x X coordinate of the points of the line.
-\param y1 Y coordinate of the first point (i.e. top) of the line.
-\param y2 Y coordinate of the second point (i.e. bottom) of the line.
-\param r The red value of the line to draw. 
-\param g The green value of the line to draw. 
-\param b The blue value of the line to draw. 
-\param a The alpha value of the line to draw. 
+\brief Internal function to free the memory held by a context.
 
-\returns Returns 0 on success, -1 on failure.
+\param context The context to release.
 */
-int vlineRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static void _gfxReleaseContext(gfxContext *context)
 {
-	int result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
-	result |= SDL_RenderDrawLine(renderer, x, y1, x, y2);
-	return result;
+	gfxBatch *batch, *next;
+	SDL2_gfxShape *shape, *nextShape;
+
+	for (batch = context->batches; batch != NULL; batch = next) {
+		next = batch->next;
+		batch->active = 0;
+		batch->context = NULL;
+		batch->next = NULL;
+	}
+	free(context->polyInts.data);
+	free(context->points.data);
+	free(context->vertices.data);
+	free(context->bezier.data);
+	free(context->geometry.data);
+	free(context->indices.data);
+	free(context->spans.data);
+	free(context->cells.data);
+	free(context->runs.data);
+	free(context->coverage.points);
+	free(context->coverage.sorted);
+	free(context->coverage.alphas);
+	free(context->shapePoints.data);
+	free(context->shapeWeights.data);
+	free(context->shapeRects.data);
+	free(context->damage.rects);
+	for (shape = context->shapes.shapes; shape != NULL; shape = nextShape) {
+		nextShape = shape->next;
+		free(shape);
+	}
+	memset(context, 0, sizeof(gfxContext));
 }
 
-/* ---- Rectangle */
-
 /*!
-\brief Draw rectangle with blending.
+\brief Free a drawing context.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
-\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
-\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
-\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+Batches still active in the context are deactivated without being flushed.
+If the context is current in the calling thread, the thread reverts to the
+default context. Passing the default context (see gfxGetContext) only
+releases its temporary memory.
 
-\returns Returns 0 on success, -1 on failure.
+\param context The context to free.
 */
-int rectangleColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+void gfxDestroyContext(gfxContext *context)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return rectangleRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+	if (context == NULL) {
+		return;
+	}
+
+	if ((gfxPrimitivesContextTLS != 0) && (SDL_TLSGet(gfxPrimitivesContextTLS) == context)) {
+		SDL_TLSSet(gfxPrimitivesContextTLS, NULL, NULL);
+	}
+	_gfxReleaseContext(context);
+	if (context != &gfxPrimitivesDefaultContext) {
+		free(context);
+	}
 }
 
 /*!
-\brief Draw rectangle with blending.
+\brief Set the context used by the drawing functions called from the current thread.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
-\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
-\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
-\param r The red value of the rectangle to draw. 
-\param g The green value of the rectangle to draw. 
-\param b The blue value of the rectangle to draw. 
-\param a The alpha value of the rectangle to draw. 
+\param context The context to use or NULL to use the default context.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int rectangleRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int gfxSetContext(gfxContext *context)
 {
-	int result;
-	Sint16 tmp;
-	SDL_Rect rect;
-
-	/*
-	* Test for special cases of straight lines or single point 
-	*/
-	if (x1 == x2) {
-		if (y1 == y2) {
-			return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-		} else {
-			return (vlineRGBA(renderer, x1, y1, y2, r, g, b, a));
+	if (gfxPrimitivesContextTLS == 0) {
+		if (context == NULL) {
+			return 0;
 		}
-	} else {
-		if (y1 == y2) {
-			return (hlineRGBA(renderer, x1, x2, y1, r, g, b, a));
+		SDL_AtomicLock(&gfxPrimitivesContextLock);
+		if (gfxPrimitivesContextTLS == 0) {
+			gfxPrimitivesContextTLS = SDL_TLSCreate();
+		}
+		SDL_AtomicUnlock(&gfxPrimitivesContextLock);
+		if (gfxPrimitivesContextTLS == 0) {
+			return -1;
 		}
 	}
 
-	/*
-	* Swap x1, x2 if required 
-	*/
-	if (x1 > x2) {
-		tmp = x1;
-		x1 = x2;
-		x2 = tmp;
-	}
-
-	/*
-	* Swap y1, y2 if required 
-	*/
-	if (y1 > y2) {
-		tmp = y1;
-		y1 = y2;
-		y2 = tmp;
+	if (context == &gfxPrimitivesDefaultContext) {
+		context = NULL;
 	}
 
-	/* 
-	* Create destination rect
-	*/	
-	rect.x = x1;
-	rect.y = y1;
-	rect.w = x2 - x1;
-	rect.h = y2 - y1;
-	
-	/*
-	* Draw
-	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);	
-	result |= SDL_RenderDrawRect(renderer, &rect);
-	return result;
+	return SDL_TLSSet(gfxPrimitivesContextTLS, context, NULL);
 }
 
-/* ---- Rounded Rectangle */
-
 /*!
-\brief Draw rounded-corner rectangle with blending.
-
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
-\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
-\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
-\param rad The radius of the corner arc.
-\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+\brief Get the context used by the drawing functions called from the current thread.
 
-\returns Returns 0 on success, -1 on failure.
+\returns Returns the context set with gfxSetContext or the default context.
 */
-int roundedRectangleColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+gfxContext *gfxGetContext(void)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return roundedRectangleRGBA(renderer, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+	gfxContext *context;
+
+	if (gfxPrimitivesContextTLS != 0) {
+		context = (gfxContext *)SDL_TLSGet(gfxPrimitivesContextTLS);
+		if (context != NULL) {
+			return context;
+		}
+	}
+
+	return &gfxPrimitivesDefaultContext;
 }
 
+/* ---- Statistics */
+
 /*!
-\brief Draw rounded-corner rectangle with blending.
+\brief Get the counters of the primitives drawn with the current context.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
-\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
-\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
-\param rad The radius of the corner arc.
-\param r The red value of the rectangle to draw. 
-\param g The green value of the rectangle to draw. 
-\param b The blue value of the rectangle to draw. 
-\param a The alpha value of the rectangle to draw. 
+Only available when the library is compiled with SDL2_GFX_STATS defined; the counting
+is compiled out entirely otherwise. The counters accumulate until reset with
+gfxPrimitivesResetStats(), i.e. once per frame. Time is measured in
+SDL_GetPerformanceCounter() ticks. Batches count their flushes and the renderer
+calls issued when flushing in the GFX_STATS_BATCH family.
 
-\returns Returns 0 on success, -1 on failure.
+\param stats Array of GFX_STATS_FAMILIES counters to fill, indexed by gfxStatsFamily.
+
+\returns Returns 0 on success, -1 on failure or if statistics are not compiled in.
 */
-int roundedRectangleRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int gfxPrimitivesGetStats(gfxPrimitivesStats *stats)
 {
-	int result = 0;
-	Sint16 tmp;
-	Sint16 w, h;
-	Sint16 xx1, xx2;
-	Sint16 yy1, yy2;
-	
-	/*
-	* Check renderer
-	*/
-	if (renderer == NULL)
-	{
+#ifdef SDL2_GFX_STATS
+	if (stats == NULL) {
 		return -1;
 	}
+	SDL_memcpy(stats, gfxGetContext()->stats, sizeof(gfxGetContext()->stats));
+	return 0;
+#else
+	(void)stats;
+	return SDL_SetError("Statistics not compiled in (SDL2_GFX_STATS)");
+#endif
+}
 
-	/*
-	* Check radius vor valid range
-	*/
-	if (rad < 0) {
-		return -1;
-	}
+/*!
+\brief Reset the counters of the primitives drawn with the current context.
+*/
+void gfxPrimitivesResetStats(void)
+{
+#ifdef SDL2_GFX_STATS
+	gfxContext *context = gfxGetContext();
 
-	/*
-	* Special case - no rounding
-	*/
-	if (rad <= 1) {
-		return rectangleRGBA(renderer, x1, y1, x2, y2, r, g, b, a);
-	}
+	SDL_memset(context->stats, 0, sizeof(context->stats));
+#endif
+}
 
-	/*
-	* Test for special cases of straight lines or single point 
-	*/
-	if (x1 == x2) {
-		if (y1 == y2) {
-			return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-		} else {
-			return (vlineRGBA(renderer, x1, y1, y2, r, g, b, a));
-		}
-	} else {
-		if (y1 == y2) {
-			return (hlineRGBA(renderer, x1, x2, y1, r, g, b, a));
-		}
-	}
+#ifdef SDL2_GFX_STATS
+/*!
+\brief Internal function to start counting a primitive call.
 
-	/*
-	* Swap x1, x2 if required 
-	*/
-	if (x1 > x2) {
-		tmp = x1;
-		x1 = x2;
-		x2 = tmp;
-	}
+Calls can be nested; everything is counted in the family of the outermost call.
 
-	/*
-	* Swap y1, y2 if required 
-	*/
-	if (y1 > y2) {
-		tmp = y1;
-		y1 = y2;
-		y2 = tmp;
+\param dst The target the primitive is drawn on.
+\param family The family of the primitive.
+*/
+static void _gfxStatsBegin(SDL2_gfxTarget *dst, gfxStatsFamily family)
+{
+	gfxContext *context = dst->context;
+
+	if (context->statsDepth++ > 0) {
+		return;
 	}
+	context->statsCurrent = &context->stats[family];
+	context->statsCurrent->calls++;
+	context->statsStart = SDL_GetPerformanceCounter();
+}
 
-	/*
-	* Calculate width&height 
-	*/
-	w = x2 - x1;
-	h = y2 - y1;
+/*!
+\brief Internal function to stop counting a primitive call.
 
-	/*
-	* Maybe adjust radius
-	*/
-	if ((rad * 2) > w)  
-	{
-		rad = w / 2;
-	}
-	if ((rad * 2) > h)
-	{
-		rad = h / 2;
-	}
+\param dst The target the primitive was drawn on.
+\param result The result of the primitive.
 
-	/*
-	* Draw corners
-	*/
-	xx1 = x1 + rad;
-	xx2 = x2 - rad;
-	yy1 = y1 + rad;
-	yy2 = y2 - rad;
-	result |= arcRGBA(renderer, xx1, yy1, rad, 180, 270, r, g, b, a);
-	result |= arcRGBA(renderer, xx2, yy1, rad, 270, 360, r, g, b, a);
-	result |= arcRGBA(renderer, xx1, yy2, rad,  90, 180, r, g, b, a);
-	result |= arcRGBA(renderer, xx2, yy2, rad,   0,  90, r, g, b, a);
+\returns Returns the result of the primitive.
+*/
+static int _gfxStatsEnd(SDL2_gfxTarget *dst, int result)
+{
+	gfxContext *context = dst->context;
 
-	/*
-	* Draw lines
-	*/
-	if (xx1 <= xx2) {
-		result |= hlineRGBA(renderer, xx1, xx2, y1, r, g, b, a);
-		result |= hlineRGBA(renderer, xx1, xx2, y2, r, g, b, a);
-	}
-	if (yy1 <= yy2) {
-		result |= vlineRGBA(renderer, x1, yy1, yy2, r, g, b, a);
-		result |= vlineRGBA(renderer, x2, yy1, yy2, r, g, b, a);
+	if (--context->statsDepth > 0) {
+		return result;
 	}
+	context->statsCurrent->time += SDL_GetPerformanceCounter() - context->statsStart;
+	context->statsCurrent = NULL;
 
 	return result;
 }
 
-/* ---- Rounded Box */
+/*!
+\brief Counts a primitive call into the given family: evaluates to the result of the call.
+*/
+#define SDL2_GFX_STATS_CALL(dst, family, call) (_gfxStatsBegin((dst), (family)), _gfxStatsEnd((dst), (call)))
 
 /*!
-\brief Draw rounded-corner box (filled rectangle) with blending.
+\brief Adds n to a counter of the primitive currently drawn with a context.
+*/
+#define SDL2_GFX_STATS_ADD(context, field, n) do { \
+		if ((context)->statsCurrent) { \
+			(context)->statsCurrent->field += (n); \
+		} \
+	} while (0)
+#else
+#define SDL2_GFX_STATS_CALL(dst, family, call) (call)
+#define SDL2_GFX_STATS_ADD(context, field, n) ((void)0)
+#endif
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the box.
-\param y1 Y coordinate of the first point (i.e. top right) of the box.
-\param x2 X coordinate of the second point (i.e. bottom left) of the box.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
-\param rad The radius of the corner arcs of the box.
-\param color The color value of the box to draw (0xRRGGBBAA). 
+/*!
+\brief Internal function to get a scratch buffer of at least the given size.
 
-\returns Returns 0 on success, -1 on failure.
+The buffer only grows; its previous content is preserved when it does.
+
+\param scratch The scratch buffer.
+\param size The number of bytes required.
+
+\returns Returns the buffer or NULL on failure.
 */
-int roundedBoxColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+static void *_gfxScratch(SDL2_gfxScratch *scratch, size_t size)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return roundedBoxRGBA(renderer, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+	size_t newSize;
+	void *newData;
+
+	if (size <= scratch->size) {
+		return scratch->data;
+	}
+
+	newSize = (scratch->size > 0) ? scratch->size : 256;
+	while (newSize < size) {
+		newSize *= 2;
+	}
+	newData = realloc(scratch->data, newSize);
+	if (newData == NULL) {
+		return NULL;
+	}
+	SDL2_GFX_STATS_ADD(gfxGetContext(), bytesAllocated, newSize - scratch->size);
+	scratch->data = newData;
+	scratch->size = newSize;
+
+	return newData;
 }
 
+/* ---- Damage */
+
 /*!
-\brief Draw rounded-corner box (filled rectangle) with blending.
+\brief Internal function to add a rectangle to the damaged area of a context.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the box.
-\param y1 Y coordinate of the first point (i.e. top right) of the box.
-\param x2 X coordinate of the second point (i.e. bottom left) of the box.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
-\param rad The radius of the corner arcs of the box.
-\param r The red value of the box to draw. 
-\param g The green value of the box to draw. 
-\param b The blue value of the box to draw. 
-\param a The alpha value of the box to draw. 
+Damaged rectangles never overlap: rectangles overlapping the new one are merged into
+it until it overlaps none of them. When the list is full, the two rectangles (the new
+one included) whose bounding rectangle is smallest are merged first.
+
+\param damage The damage tracker.
+\param rect The rectangle to add.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int roundedBoxRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2,
-	Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static int _gfxAddDamage(SDL2_gfxDamage *damage, const SDL_Rect *rect)
 {
-	int result;
-	Sint16 w, h, r2, tmp;
-	Sint16 cx = 0;
-	Sint16 cy = rad;
-	Sint16 ocx = (Sint16) 0xffff;
-	Sint16 ocy = (Sint16) 0xffff;
-	Sint16 df = 1 - rad;
-	Sint16 d_e = 3;
-	Sint16 d_se = -2 * rad + 5;
-	Sint16 xpcx, xmcx, xpcy, xmcy;
-	Sint16 ypcy, ymcy, ypcx, ymcx;
-	Sint16 x, y, dx, dy;
-
-	/* 
-	* Check destination renderer 
-	*/
-	if (renderer == NULL)
-	{
-		return -1;
+	SDL_Rect merged, u;
+	int i, j, bi, bj;
+	Sint64 area, best;
+
+	if (damage->rects == NULL) {
+		damage->rects = (SDL_Rect *)malloc(damage->maxRects * sizeof(SDL_Rect));
+		if (damage->rects == NULL) {
+			return -1;
+		}
+		SDL2_GFX_STATS_ADD(gfxGetContext(), bytesAllocated, damage->maxRects * sizeof(SDL_Rect));
 	}
 
-	/*
-	* Check radius vor valid range
-	*/
-	if (rad < 0) {
-		return -1;
-	}
+	merged = *rect;
+	for (;;) {
+		/*
+		* Absorb the rectangles overlapping the new one; its growth may reach more of them
+		*/
+		for (i = 0; i < damage->numRects; i++) {
+			if (SDL_HasIntersection(&damage->rects[i], &merged)) {
+				SDL_UnionRect(&damage->rects[i], &merged, &merged);
+				damage->rects[i] = damage->rects[--damage->numRects];
+				i = -1;
+			}
+		}
 
-	/*
-	* Special case - no rounding
-	*/
-	if (rad <= 1) {
-		return rectangleRGBA(renderer, x1, y1, x2, y2, r, g, b, a);
-	}
+		if (damage->numRects < damage->maxRects) {
+			damage->rects[damage->numRects++] = merged;
+			return 0;
+		}
 
-	/*
-	* Test for special cases of straight lines or single point 
-	*/
-	if (x1 == x2) {
-		if (y1 == y2) {
-			return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-		} else {
-			return (vlineRGBA(renderer, x1, y1, y2, r, g, b, a));
+		/*
+		* Full: find the cheapest pair, the new rectangle being number numRects
+		*/
+		best = -1;
+		bi = 0;
+		bj = 1;
+		for (i = 0; i < damage->numRects; i++) {
+			for (j = i + 1; j <= damage->numRects; j++) {
+				SDL_UnionRect(&damage->rects[i], (j < damage->numRects) ? &damage->rects[j] : &merged, &u);
+				area = (Sint64)u.w * u.h;
+				if ((best < 0) || (area < best)) {
+					best = area;
+					bi = i;
+					bj = j;
+				}
+			}
 		}
-	} else {
-		if (y1 == y2) {
-			return (hlineRGBA(renderer, x1, x2, y1, r, g, b, a));
+		if (bj == damage->numRects) {
+			SDL_UnionRect(&damage->rects[bi], &merged, &merged);
+			damage->rects[bi] = damage->rects[--damage->numRects];
+		} else {
+			SDL_UnionRect(&damage->rects[bi], &damage->rects[bj], &u);
+			damage->rects[bj] = damage->rects[--damage->numRects];
+			damage->rects[bi] = damage->rects[--damage->numRects];
+			if (_gfxAddDamage(damage, &u)) {
+				return -1;
+			}
 		}
 	}
+}
 
-	/*
-	* Swap x1, x2 if required 
-	*/
-	if (x1 > x2) {
-		tmp = x1;
-		x1 = x2;
-		x2 = tmp;
+/*!
+\brief Internal function to add the area touched by the last primitive to the damaged area.
+
+\param damage The damage tracker.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCommitDamage(SDL2_gfxDamage *damage)
+{
+	SDL_Rect rect;
+	int x1, y1, x2, y2;
+
+	if (!damage->pending) {
+		return 0;
+	}
+	damage->pending = 0;
+
+	rect.x = damage->x1;
+	rect.y = damage->y1;
+	rect.w = damage->x2 - damage->x1 + 1;
+	rect.h = damage->y2 - damage->y1 + 1;
+	if (!SDL_IntersectRect(&rect, &damage->clip, &rect)) {
+		return 0;
 	}
 
 	/*
-	* Swap y1, y2 if required 
+	* Render target coordinates; scaled pixels cover every output pixel they touch 
 	*/
-	if (y1 > y2) {
-		tmp = y1;
-		y1 = y2;
-		y2 = tmp;
+	x1 = rect.x + damage->originX;
+	y1 = rect.y + damage->originY;
+	x2 = x1 + rect.w;
+	y2 = y1 + rect.h;
+	if ((damage->scaleX != 1.0f) || (damage->scaleY != 1.0f)) {
+		x1 = (int)SDL_floor(x1 * damage->scaleX);
+		y1 = (int)SDL_floor(y1 * damage->scaleY);
+		x2 = (int)SDL_ceil(x2 * damage->scaleX);
+		y2 = (int)SDL_ceil(y2 * damage->scaleY);
+	}
+	rect.x = x1;
+	rect.y = y1;
+	rect.w = x2 - x1;
+	rect.h = y2 - y1;
+	if ((rect.w <= 0) || (rect.h <= 0)) {
+		return 0;
 	}
 
-	/*
-	* Calculate width&height 
-	*/
-	w = x2 - x1 + 1;
-	h = y2 - y1 + 1;
+	return _gfxAddDamage(damage, &rect);
+}
 
-	/*
-	* Maybe adjust radius
-	*/
-	r2 = rad + rad;
-	if (r2 > w)  
-	{
-		rad = w / 2;
-		r2 = rad + rad;
+/*!
+\brief Internal function to start tracking the damage of a primitive drawn on a target.
+
+Called when the target is set up; the area touched by the previous primitive is
+added to the damaged area first.
+
+\param dst The target to track.
+\param originX X coordinate of the viewport of the target in render target coordinates.
+\param originY Y coordinate of the viewport of the target in render target coordinates.
+*/
+static void _gfxTrackDamage(SDL2_gfxTarget *dst, int originX, int originY)
+{
+	SDL2_gfxDamage *damage = &dst->context->damage;
+
+	if (damage->maxRects <= 0) {
+		return;
 	}
-	if (r2 > h)
-	{
-		rad = h / 2;
+
+	_gfxCommitDamage(damage);
+	damage->clip = dst->clip;
+	damage->originX = originX;
+	damage->originY = originY;
+	damage->scaleX = 1.0f;
+	damage->scaleY = 1.0f;
+	if (dst->renderer) {
+		SDL_RenderGetScale(dst->renderer, &damage->scaleX, &damage->scaleY);
 	}
+	dst->damage = damage;
+}
 
-	/* Setup filled circle drawing for corners */
-	x = x1 + rad;
-	y = y1 + rad;
-	dx = x2 - x1 - rad - rad;
-	dy = y2 - y1 - rad - rad;
+/*!
+\brief Internal function to mark an area of a target as touched by the current primitive.
 
-	/*
-	* Set color
-	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
+Does nothing unless damage tracking is enabled. The area is clipped to the visible
+area of the target once the primitive is complete.
 
-	/*
-	* Draw corners
-	*/
-	do {
-		xpcx = x + cx;
-		xmcx = x - cx;
-		xpcy = x + cy;
-		xmcy = x - cy;
-		if (ocy != cy) {
-			if (cy > 0) {
-				ypcy = y + cy;
-				ymcy = y - cy;
-				result |= hline(renderer, xmcx, xpcx + dx, ypcy + dy);
-				result |= hline(renderer, xmcx, xpcx + dx, ymcy);
-			} else {
-				result |= hline(renderer, xmcx, xpcx + dx, y);
-			}
-			ocy = cy;
-		}
-		if (ocx != cx) {
-			if (cx != cy) {
-				if (cx > 0) {
-					ypcx = y + cx;
-					ymcx = y - cx;
-					result |= hline(renderer, xmcy, xpcy + dx, ymcx);
-					result |= hline(renderer, xmcy, xpcy + dx, ypcx + dy);
-				} else {
-					result |= hline(renderer, xmcy, xpcy + dx, y);
-				}
-			}
-			ocx = cx;
-		}
+\param dst The target drawn on.
+\param x1 X coordinate of the left edge of the area.
+\param y1 Y coordinate of the top edge of the area.
+\param x2 X coordinate of the right edge of the area (inclusive).
+\param y2 Y coordinate of the bottom edge of the area (inclusive).
+*/
+static void _gfxDamage(SDL2_gfxTarget *dst, int x1, int y1, int x2, int y2)
+{
+	SDL2_gfxDamage *damage = dst->damage;
 
-		/*
-		* Update 
-		*/
-		if (df < 0) {
-			df += d_e;
-			d_e += 2;
-			d_se += 2;
-		} else {
-			df += d_se;
-			d_e += 2;
-			d_se += 4;
-			cy--;
-		}
-		cx++;
-	} while (cx <= cy);
+	if (damage == NULL) {
+		return;
+	}
 
-	/* Inside */
-	if (dx > 0 && dy > 0) {
-		result |= boxRGBA(renderer, x1, y1 + rad + 1, x2, y2 - rad, r, g, b, a);
+	if (!damage->pending) {
+		damage->x1 = x1;
+		damage->y1 = y1;
+		damage->x2 = x2;
+		damage->y2 = y2;
+		damage->pending = 1;
+		return;
 	}
 
-	return (result);
+	damage->x1 = SDL_min(damage->x1, x1);
+	damage->y1 = SDL_min(damage->y1, y1);
+	damage->x2 = SDL_max(damage->x2, x2);
+	damage->y2 = SDL_max(damage->y2, y2);
 }
 
-/* ---- Box */
-
 /*!
-\brief Draw box (filled rectangle) with blending.
+\brief Internal function to mark the bounding box of points as touched by the current primitive.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the box.
-\param y1 Y coordinate of the first point (i.e. top right) of the box.
-\param x2 X coordinate of the second point (i.e. bottom left) of the box.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
-\param color The color value of the box to draw (0xRRGGBBAA). 
+\param dst The target drawn on.
+\param points Array of points.
+\param n Number of points in the array.
+*/
+static void _gfxDamagePoints(SDL2_gfxTarget *dst, const SDL_Point *points, int n)
+{
+	int i;
 
-\returns Returns 0 on success, -1 on failure.
+	if (dst->damage == NULL) {
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		_gfxDamage(dst, points[i].x, points[i].y, points[i].x, points[i].y);
+	}
+}
+
+/*!
+\brief Enable or disable tracking the areas drawn by the primitives of the current context.
+
+While enabled, the bounding box of every primitive drawn on a renderer or surface,
+clipped to the visible area, is added to a list of non-overlapping damaged rectangles
+(see gfxGetDamageRects). Rectangles are in the coordinates of the render target,
+that is the viewport origin is added and the render scale applied, so primitives
+drawn under different viewports are tracked consistently; for surfaces they are
+surface coordinates. Use a context per target (see gfxSetContext) to track several
+renderers or surfaces separately. Primitives
+recorded into a batch count when recorded, display lists when drawn.
+
+\param maxRects Maximum number of damaged rectangles kept; more are merged. Set to 0 to disable tracking.
 */
-int boxColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+void gfxSetDamageTracking(int maxRects)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return boxRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+	SDL2_gfxDamage *damage = &gfxGetContext()->damage;
+
+	free(damage->rects);
+	damage->rects = NULL;
+	damage->numRects = 0;
+	damage->pending = 0;
+	damage->maxRects = SDL_max(maxRects, 0);
 }
 
 /*!
-\brief Draw box (filled rectangle) with blending.
+\brief Get the damaged rectangles of the current context.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. top right) of the box.
-\param y1 Y coordinate of the first point (i.e. top right) of the box.
-\param x2 X coordinate of the second point (i.e. bottom left) of the box.
-\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
-\param r The red value of the box to draw. 
-\param g The green value of the box to draw. 
-\param b The blue value of the box to draw. 
-\param a The alpha value of the box to draw.
+\param rects Array receiving up to maxRects rectangles; may be NULL.
+\param maxRects Number of rectangles the array can hold.
 
-\returns Returns 0 on success, -1 on failure.
+\returns Returns the number of damaged rectangles, which may be more than maxRects.
 */
-int boxRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int gfxGetDamageRects(SDL_Rect *rects, int maxRects)
 {
-	int result;
-	Sint16 tmp;
-	SDL_Rect rect;
+	SDL2_gfxDamage *damage = &gfxGetContext()->damage;
 
-	/*
-	* Test for special cases of straight lines or single point 
-	*/
-	if (x1 == x2) {
-		if (y1 == y2) {
-			return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-		} else {
-			return (vlineRGBA(renderer, x1, y1, y2, r, g, b, a));
-		}
-	} else {
-		if (y1 == y2) {
-			return (hlineRGBA(renderer, x1, x2, y1, r, g, b, a));
-		}
+	_gfxCommitDamage(damage);
+	if (rects != NULL) {
+		SDL_memcpy(rects, damage->rects, SDL_min(SDL_max(maxRects, 0), damage->numRects) * sizeof(SDL_Rect));
 	}
 
-	/*
-	* Swap x1, x2 if required 
-	*/
-	if (x1 > x2) {
-		tmp = x1;
-		x1 = x2;
-		x2 = tmp;
-	}
+	return damage->numRects;
+}
 
-	/*
-	* Swap y1, y2 if required 
-	*/
-	if (y1 > y2) {
-		tmp = y1;
-		y1 = y2;
-		y2 = tmp;
-	}
+/*!
+\brief Forget the damaged rectangles of the current context, i.e. after presenting a frame.
+*/
+void gfxClearDamage(void)
+{
+	SDL2_gfxDamage *damage = &gfxGetContext()->damage;
 
-	/* 
-	* Create destination rect
-	*/	
-	rect.x = x1;
-	rect.y = y1;
-	rect.w = x2 - x1 + 1;
-	rect.h = y2 - y1 + 1;
-	
-	/*
-	* Draw
-	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);	
-	result |= SDL_RenderFillRect(renderer, &rect);
-	return result;
+	damage->numRects = 0;
+	damage->pending = 0;
 }
 
-/* ----- Line */
+/* ---- Renderer state */
 
 /*!
-\brief Draw line with alpha blending using the currently set color.
+\brief Flag to skip setting a draw color or blend mode which is already set on the renderer.
+*/
+static int gfxPrimitivesStateShadowing = SDL2_GFX_STATE_SHADOWING;
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the line.
-\param y1 Y coordinate of the first point of the line.
-\param x2 X coordinate of the second point of the line.
-\param y2 Y coordinate of the second point of the line.
+/*!
+\brief List of the shadowed renderer states, most recently used first.
+*/
+static SDL2_gfxRendererState *gfxPrimitivesStates = NULL;
 
-\returns Returns 0 on success, -1 on failure.
+/*!
+\brief Lock protecting the list of renderer states.
 */
-int line(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2)
-{
-	/*
-	* Draw
-	*/
-	return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
-}
+static SDL_SpinLock gfxPrimitivesStateLock = 0;
 
 /*!
-\brief Draw line with alpha blending.
+\brief Counter bumped whenever renderer states are freed, so contexts drop the state they looked up last.
+*/
+static SDL_atomic_t gfxPrimitivesStateGeneration;
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the line.
-\param y1 Y coordinate of the first point of the line.
-\param x2 X coordinate of the second point of the line.
-\param y2 Y coordinate of the seond point of the line.
-\param color The color value of the line to draw (0xRRGGBBAA). 
+/*!
+\brief Sets if the draw color and blend mode of renderers are shadowed.
 
-\returns Returns 0 on success, -1 on failure.
+When enabled, the last draw color and blend mode set by the primitives are remembered
+per renderer and calls setting them again to the same values are skipped. Call
+gfxInvalidateRendererState() after changing the draw color or blend mode of a renderer
+with other SDL functions and gfxReleaseRenderer() before destroying a renderer.
+Disabled by default.
+
+\param enable Set to 1 to enable or 0 to disable shadowing of the renderer state.
 */
-int lineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+void gfxPrimitivesSetStateShadowing(int enable)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return lineRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+	SDL_AtomicLock(&gfxPrimitivesStateLock);
+	gfxPrimitivesStateShadowing = enable;
+	SDL_AtomicUnlock(&gfxPrimitivesStateLock);
+	gfxInvalidateRendererState(NULL);
 }
 
 /*!
-\brief Draw line with alpha blending.
+\brief Forget the draw color and blend mode shadowed for a renderer.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the line.
-\param y1 Y coordinate of the first point of the line.
-\param x2 X coordinate of the second point of the line.
-\param y2 Y coordinate of the second point of the line.
-\param r The red value of the line to draw. 
-\param g The green value of the line to draw. 
-\param b The blue value of the line to draw. 
-\param a The alpha value of the line to draw.
+The next primitive drawn sets both again. The call statistics are kept.
 
-\returns Returns 0 on success, -1 on failure.
+\param renderer The renderer whose state was changed outside of the primitives. Set to NULL for all renderers.
 */
-int lineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+void gfxInvalidateRendererState(SDL_Renderer *renderer)
 {
-	/*
-	* Draw
-	*/
-	int result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);	
-	result |= SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
-	return result;
+	SDL2_gfxRendererState *state;
+
+	SDL_AtomicLock(&gfxPrimitivesStateLock);
+	for (state = gfxPrimitivesStates; state != NULL; state = state->next) {
+		if ((renderer == NULL) || (state->renderer == renderer)) {
+			state->hasBlend = 0;
+			state->hasColor = 0;
+		}
+	}
+	SDL_AtomicUnlock(&gfxPrimitivesStateLock);
 }
 
-/* ---- AA Line */
+/*!
+\brief Get the number of draw color and blend mode calls issued and skipped.
 
-#define AAlevels 256
-#define AAbits 8
+\param renderer The renderer to query. Set to NULL for the sum of all renderers.
+\param issued Returns the number of calls passed on to the renderer; may be NULL.
+\param elided Returns the number of calls skipped since the state was already set; may be NULL.
+*/
+void gfxGetRendererStateStats(SDL_Renderer *renderer, Uint32 *issued, Uint32 *elided)
+{
+	SDL2_gfxRendererState *state;
+	Uint32 sumIssued = 0, sumElided = 0;
+
+	SDL_AtomicLock(&gfxPrimitivesStateLock);
+	for (state = gfxPrimitivesStates; state != NULL; state = state->next) {
+		if ((renderer == NULL) || (state->renderer == renderer)) {
+			sumIssued += state->issued;
+			sumElided += state->elided;
+		}
+	}
+	SDL_AtomicUnlock(&gfxPrimitivesStateLock);
+
+	if (issued) {
+		*issued = sumIssued;
+	}
+	if (elided) {
+		*elided = sumElided;
+	}
+}
 
 /*!
-\brief Internal function to draw anti-aliased line with alpha blending and endpoint control.
+\brief Internal function to get the shadowed state of a renderer.
 
-This implementation of the Wu antialiasing code is based on Mike Abrash's
-DDJ article which was reprinted as Chapter 42 of his Graphics Programming
-Black Book, but has been optimized to work with SDL and utilizes 32-bit
-fixed-point arithmetic by A. Schiffler. The endpoint control allows the
-supression to draw the last pixel useful for rendering continous aa-lines
-with alpha<255.
+Creates the state on first use; states are only freed by gfxReleaseRenderer(). The
+state looked up last is kept in the current context, so drawing repeatedly to the
+same renderer neither takes the lock nor walks the list.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the aa-line.
-\param y1 Y coordinate of the first point of the aa-line.
-\param x2 X coordinate of the second point of the aa-line.
-\param y2 Y coordinate of the second point of the aa-line.
-\param r The red value of the aa-line to draw. 
-\param g The green value of the aa-line to draw. 
-\param b The blue value of the aa-line to draw. 
-\param a The alpha value of the aa-line to draw.
-\param draw_endpoint Flag indicating if the endpoint should be drawn; draw if non-zero.
+\param renderer The renderer to look up.
 
-\returns Returns 0 on success, -1 on failure.
+\returns Returns the state of the renderer or NULL if shadowing is disabled or out of memory.
 */
-int _aalineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a, int draw_endpoint)
+static SDL2_gfxRendererState *_gfxRendererState(SDL_Renderer *renderer)
 {
-	Sint32 xx0, yy0, xx1, yy1;
-	int result;
-	Uint32 intshift, erracc, erradj;
-	Uint32 erracctmp, wgt, wgtcompmask;
-	int dx, dy, tmp, xdir, y0p1, x0pxdir;
-
-	/*
-	* Keep on working with 32bit numbers 
-	*/
-	xx0 = x1;
-	yy0 = y1;
-	xx1 = x2;
-	yy1 = y2;
+	gfxContext *context;
+	SDL2_gfxRendererState *state, **link;
+	int generation;
 
-	/*
-	* Reorder points to make dy positive 
-	*/
-	if (yy0 > yy1) {
-		tmp = yy0;
-		yy0 = yy1;
-		yy1 = tmp;
-		tmp = xx0;
-		xx0 = xx1;
-		xx1 = tmp;
+	if ((renderer == NULL) || (!gfxPrimitivesStateShadowing)) {
+		return NULL;
 	}
 
 	/*
-	* Calculate distance 
+	* The generation is compared first: a state freed since the lookup must not be read
 	*/
-	dx = xx1 - xx0;
-	dy = yy1 - yy0;
+	context = gfxGetContext();
+	generation = SDL_AtomicGet(&gfxPrimitivesStateGeneration);
+	if ((context->stateGeneration == generation) && (context->state != NULL) && (context->state->renderer == renderer)) {
+		return context->state;
+	}
 
-	/*
-	* Adjust for negative dx and set xdir 
-	*/
-	if (dx >= 0) {
-		xdir = 1;
-	} else {
-		xdir = -1;
-		dx = (-dx);
+	SDL_AtomicLock(&gfxPrimitivesStateLock);
+	for (link = &gfxPrimitivesStates; *link != NULL; link = &(*link)->next) {
+		if ((*link)->renderer == renderer) {
+			break;
+		}
 	}
-	
-	/*
-	* Check for special cases 
-	*/
-	if (dx == 0) {
-		/*
-		* Vertical line 
-		*/
-		if (draw_endpoint)
-		{
-			return (vlineRGBA(renderer, x1, y1, y2, r, g, b, a));
-		} else {
-			if (dy > 0) {
-				return (vlineRGBA(renderer, x1, yy0, yy0+dy, r, g, b, a));
-			} else {
-				return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-			}
-		}
-	} else if (dy == 0) {
-		/*
-		* Horizontal line 
-		*/
-		if (draw_endpoint)
-		{
-			return (hlineRGBA(renderer, x1, x2, y1, r, g, b, a));
-		} else {
-			if (dx > 0) {
-				return (hlineRGBA(renderer, xx0, xx0+dx, y1, r, g, b, a));
-			} else {
-				return (pixelRGBA(renderer, x1, y1, r, g, b, a));
-			}
+	state = *link;
+	if (state == NULL) {
+		state = (SDL2_gfxRendererState *)calloc(1, sizeof(SDL2_gfxRendererState));
+		if (state != NULL) {
+			state->renderer = renderer;
+			state->next = gfxPrimitivesStates;
+			gfxPrimitivesStates = state;
 		}
-	} else if ((dx == dy) && (draw_endpoint)) {
-		/*
-		* Diagonal line (with endpoint)
-		*/
-		return (lineRGBA(renderer, x1, y1, x2, y2,  r, g, b, a));
+	} else if (link != &gfxPrimitivesStates) {
+		*link = state->next;
+		state->next = gfxPrimitivesStates;
+		gfxPrimitivesStates = state;
 	}
+	SDL_AtomicUnlock(&gfxPrimitivesStateLock);
 
+	context->state = state;
+	context->stateGeneration = generation;
 
-	/*
-	* Line is not horizontal, vertical or diagonal (with endpoint)
-	*/
-	result = 0;
+	return state;
+}
 
-	/*
-	* Zero accumulator 
-	*/
-	erracc = 0;
+/*!
+\brief Internal function to free the shadowed state of a renderer.
 
-	/*
-	* # of bits by which to shift erracc to get intensity level 
-	*/
-	intshift = 32 - AAbits;
+\param renderer The renderer being released.
+*/
+static void _gfxReleaseRendererState(SDL_Renderer *renderer)
+{
+	SDL2_gfxRendererState *state, **link;
+
+	SDL_AtomicLock(&gfxPrimitivesStateLock);
+	link = &gfxPrimitivesStates;
+	while (*link != NULL) {
+		state = *link;
+		if (state->renderer != renderer) {
+			link = &state->next;
+			continue;
+		}
+		*link = state->next;
+		free(state);
+	}
+	SDL_AtomicAdd(&gfxPrimitivesStateGeneration, 1);
+	SDL_AtomicUnlock(&gfxPrimitivesStateLock);
+}
 
-	/*
-	* Mask used to flip all bits in an intensity weighting 
-	*/
-	wgtcompmask = AAlevels - 1;
+/*!
+\brief Internal function to set the draw blend mode of a renderer unless it is already set.
 
-	/*
-	* Draw the initial pixel in the foreground color 
-	*/
-	result |= pixelRGBA(renderer, x1, y1, r, g, b, a);
+\param renderer The renderer to change.
+\param state The shadowed state of the renderer or NULL.
+\param blend The blend mode to set.
 
-	/*
-	* x-major or y-major? 
-	*/
-	if (dy > dx) {
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSetBlendMode(SDL_Renderer *renderer, SDL2_gfxRendererState *state, SDL_BlendMode blend)
+{
+	int result;
 
-		/*
-		* y-major.  Calculate 16-bit fixed point fractional part of a pixel that
-		* X advances every time Y advances 1 pixel, truncating the result so that
-		* we won't overrun the endpoint along the X axis 
-		*/
-		/*
-		* Not-so-portable version: erradj = ((Uint64)dx << 32) / (Uint64)dy; 
-		*/
-		erradj = ((dx << 16) / dy) << 16;
+	if (state == NULL) {
+		return SDL_SetRenderDrawBlendMode(renderer, blend);
+	}
+	if ((state->hasBlend) && (state->blend == blend)) {
+		state->elided++;
+		return 0;
+	}
 
-		/*
-		* draw all pixels other than the first and last 
-		*/
-		x0pxdir = xx0 + xdir;
-		while (--dy) {
-			erracctmp = erracc;
-			erracc += erradj;
-			if (erracc <= erracctmp) {
-				/*
-				* rollover in error accumulator, x coord advances 
-				*/
-				xx0 = x0pxdir;
-				x0pxdir += xdir;
-			}
-			yy0++;		/* y-major so always advance Y */
+	state->issued++;
+	result = SDL_SetRenderDrawBlendMode(renderer, blend);
+	state->hasBlend = (result == 0);
+	state->blend = blend;
 
-			/*
-			* the AAbits most significant bits of erracc give us the intensity
-			* weighting for this pixel, and the complement of the weighting for
-			* the paired pixel. 
-			*/
-			wgt = (erracc >> intshift) & 255;
-			result |= pixelRGBAWeight (renderer, xx0, yy0, r, g, b, a, 255 - wgt);
-			result |= pixelRGBAWeight (renderer, x0pxdir, yy0, r, g, b, a, wgt);
-		}
+	return result;
+}
 
-	} else {
+/*!
+\brief Internal function to set the draw color of a renderer unless it is already set.
 
-		/*
-		* x-major line.  Calculate 16-bit fixed-point fractional part of a pixel
-		* that Y advances each time X advances 1 pixel, truncating the result so
-		* that we won't overrun the endpoint along the X axis. 
-		*/
-		/*
-		* Not-so-portable version: erradj = ((Uint64)dy << 32) / (Uint64)dx; 
-		*/
-		erradj = ((dy << 16) / dx) << 16;
+\param renderer The renderer to change.
+\param state The shadowed state of the renderer or NULL.
+\param r The red value of the color.
+\param g The green value of the color.
+\param b The blue value of the color.
+\param a The alpha value of the color.
 
-		/*
-		* draw all pixels other than the first and last 
-		*/
-		y0p1 = yy0 + 1;
-		while (--dx) {
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSetDrawColor(SDL_Renderer *renderer, SDL2_gfxRendererState *state, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
 
-			erracctmp = erracc;
-			erracc += erradj;
-			if (erracc <= erracctmp) {
-				/*
-				* Accumulator turned over, advance y 
-				*/
-				yy0 = y0p1;
-				y0p1++;
-			}
-			xx0 += xdir;	/* x-major so always advance X */
-			/*
-			* the AAbits most significant bits of erracc give us the intensity
-			* weighting for this pixel, and the complement of the weighting for
-			* the paired pixel. 
-			*/
-			wgt = (erracc >> intshift) & 255;
-			result |= pixelRGBAWeight (renderer, xx0, yy0, r, g, b, a, 255 - wgt);
-			result |= pixelRGBAWeight (renderer, xx0, y0p1, r, g, b, a, wgt);
-		}
+	if (state == NULL) {
+		return SDL_SetRenderDrawColor(renderer, r, g, b, a);
 	}
-
-	/*
-	* Do we have to draw the endpoint 
-	*/
-	if (draw_endpoint) {
-		/*
-		* Draw final pixel, always exactly intersected by the line and doesn't
-		* need to be weighted. 
-		*/
-		result |= pixelRGBA (renderer, x2, y2, r, g, b, a);
+	if ((state->hasColor) && (state->r == r) && (state->g == g) && (state->b == b) && (state->a == a)) {
+		state->elided++;
+		return 0;
 	}
 
-	return (result);
+	state->issued++;
+	result = SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	state->hasColor = (result == 0);
+	state->r = r;
+	state->g = g;
+	state->b = b;
+	state->a = a;
+
+	return result;
 }
 
+/* ---- Batch */
+
 /*!
-\brief Draw anti-aliased line with alpha blending.
+\brief Internal helper to grow a batch array so it can hold at least n more elements.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the aa-line.
-\param y1 Y coordinate of the first point of the aa-line.
-\param x2 X coordinate of the second point of the aa-line.
-\param y2 Y coordinate of the second point of the aa-line.
-\param color The color value of the aa-line to draw (0xRRGGBBAA).
+\param array Pointer to the array to grow.
+\param num Number of elements currently used.
+\param max Pointer to the number of elements currently allocated.
+\param n Number of elements to add.
+\param size Size of one element in bytes.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aalineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+static int _gfxBatchGrow(void **array, int num, int *max, int n, size_t size)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return _aalineRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3], 1);
+	int newMax;
+	void *newArray;
+
+	if (num + n <= *max) {
+		return 0;
+	}
+
+	newMax = (*max > 0) ? *max : 64;
+	while (newMax < num + n) {
+		newMax *= 2;
+	}
+	newArray = realloc(*array, newMax * size);
+	if (newArray == NULL) {
+		return -1;
+	}
+	SDL2_GFX_STATS_ADD(gfxGetContext(), bytesAllocated, (newMax - *max) * size);
+	*array = newArray;
+	*max = newMax;
+
+	return 0;
 }
 
 /*!
-\brief Draw anti-aliased line with alpha blending.
+\brief Internal function to get the run that the next batch primitive is added to.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the aa-line.
-\param y1 Y coordinate of the first point of the aa-line.
-\param x2 X coordinate of the second point of the aa-line.
-\param y2 Y coordinate of the second point of the aa-line.
-\param r The red value of the aa-line to draw. 
-\param g The green value of the aa-line to draw. 
-\param b The blue value of the aa-line to draw. 
-\param a The alpha value of the aa-line to draw.
+Starts a new run if the current batch color differs from the color of the last run.
 
-\returns Returns 0 on success, -1 on failure.
+\param batch The batch to record into.
+
+\returns Returns the current run or NULL on failure.
 */
-int aalineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static SDL2_gfxBatchRun *_gfxBatchRun(gfxBatch *batch)
 {
-	return _aalineRGBA(renderer, x1, y1, x2, y2, r, g, b, a, 1);
-}
+	SDL2_gfxBatchRun *run;
 
-/* ----- Circle */
+	if (batch->numRuns > batch->numSealedRuns) {
+		run = &batch->runs[batch->numRuns - 1];
+		if ((run->r == batch->r) && (run->g == batch->g) && (run->b == batch->b) && (run->a == batch->a)) {
+			return run;
+		}
+	}
+
+	if (_gfxBatchGrow((void **)&batch->runs, batch->numRuns, &batch->maxRuns, 1, sizeof(SDL2_gfxBatchRun))) {
+		return NULL;
+	}
+	run = &batch->runs[batch->numRuns++];
+	run->r = batch->r;
+	run->g = batch->g;
+	run->b = batch->b;
+	run->a = batch->a;
+	run->firstPoint = batch->numPoints;
+	run->numPoints = 0;
+	run->firstRect = batch->numRects;
+	run->numRects = 0;
+	run->firstOutline = batch->numOutlines;
+	run->numOutlines = 0;
+	run->firstStrip = batch->numStrips;
+	run->numStrips = 0;
+
+	return run;
+}
 
 /*!
-\brief Draw circle with blending.
+\brief Internal function to record points into a batch.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the circle.
-\param y Y coordinate of the center of the circle.
-\param rad Radius in pixels of the circle.
-\param color The color value of the circle to draw (0xRRGGBBAA). 
+\param batch The batch to record into.
+\param points Array of points.
+\param n Number of points in the array.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int circleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+static int _gfxBatchPoints(gfxBatch *batch, const SDL_Point *points, int n)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return ellipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+	SDL2_gfxBatchRun *run = _gfxBatchRun(batch);
+	if (run == NULL) {
+		return -1;
+	}
+	if (_gfxBatchGrow((void **)&batch->points, batch->numPoints, &batch->maxPoints, n, sizeof(SDL_Point))) {
+		return -1;
+	}
+	memcpy(&batch->points[batch->numPoints], points, n * sizeof(SDL_Point));
+	batch->numPoints += n;
+	run->numPoints += n;
+
+	return 0;
 }
 
 /*!
-\brief Draw circle with blending.
+\brief Internal function to record a filled rectangle into a batch.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the circle.
-\param y Y coordinate of the center of the circle.
-\param rad Radius in pixels of the circle.
-\param r The red value of the circle to draw. 
-\param g The green value of the circle to draw. 
-\param b The blue value of the circle to draw. 
-\param a The alpha value of the circle to draw.
+\param batch The batch to record into.
+\param x X coordinate of the upper left corner of the rectangle.
+\param y Y coordinate of the upper left corner of the rectangle.
+\param w Width of the rectangle.
+\param h Height of the rectangle.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int circleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static int _gfxBatchRect(gfxBatch *batch, int x, int y, int w, int h)
 {
-	return ellipseRGBA(renderer, x, y, rad, rad, r, g, b, a);
+	SDL2_gfxBatchRun *run = _gfxBatchRun(batch);
+	if (run == NULL) {
+		return -1;
+	}
+	if (_gfxBatchGrow((void **)&batch->rects, batch->numRects, &batch->maxRects, 1, sizeof(SDL_Rect))) {
+		return -1;
+	}
+	batch->rects[batch->numRects].x = x;
+	batch->rects[batch->numRects].y = y;
+	batch->rects[batch->numRects].w = w;
+	batch->rects[batch->numRects].h = h;
+	batch->numRects++;
+	run->numRects++;
+
+	return 0;
 }
 
-/* ----- Arc */
-
 /*!
-\brief Arc with blending.
+\brief Internal function to record a rectangle outline into a batch.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the arc.
-\param y Y coordinate of the center of the arc.
-\param rad Radius in pixels of the arc.
-\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
-\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
-\param color The color value of the arc to draw (0xRRGGBBAA). 
+\param batch The batch to record into.
+\param rect The rectangle to outline.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int arcColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
+static int _gfxBatchOutline(gfxBatch *batch, const SDL_Rect *rect)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return arcRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
+	SDL2_gfxBatchRun *run = _gfxBatchRun(batch);
+	if (run == NULL) {
+		return -1;
+	}
+	if (_gfxBatchGrow((void **)&batch->outlines, batch->numOutlines, &batch->maxOutlines, 1, sizeof(SDL_Rect))) {
+		return -1;
+	}
+	batch->outlines[batch->numOutlines++] = *rect;
+	run->numOutlines++;
+
+	return 0;
 }
 
 /*!
-\brief Arc with blending.
+\brief Internal function to record a line or connected lines into a batch.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the arc.
-\param y Y coordinate of the center of the arc.
-\param rad Radius in pixels of the arc.
-\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
-\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
-\param r The red value of the arc to draw. 
-\param g The green value of the arc to draw. 
-\param b The blue value of the arc to draw. 
-\param a The alpha value of the arc to draw.
+\param batch The batch to record into.
+\param points Array of points of the lines.
+\param n Number of points in the array.
 
 \returns Returns 0 on success, -1 on failure.
 */
-/* TODO: rewrite algorithm; arc endpoints are not always drawn */
-int arcRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static int _gfxBatchLines(gfxBatch *batch, const SDL_Point *points, int n)
 {
-	int result;
-	Sint16 cx = 0;
-	Sint16 cy = rad;
-	Sint16 df = 1 - rad;
-	Sint16 d_e = 3;
-	Sint16 d_se = -2 * rad + 5;
-	Sint16 xpcx, xmcx, xpcy, xmcy;
-	Sint16 ypcy, ymcy, ypcx, ymcx;
-	Uint8 drawoct;
-	int startoct, endoct, oct, stopval_start = 0, stopval_end = 0;
-	double dstart, dend, temp = 0.;
-
-	/*
-	* Sanity check radius 
-	*/
-	if (rad < 0) {
-		return (-1);
+	SDL2_gfxBatchRun *run = _gfxBatchRun(batch);
+	if (run == NULL) {
+		return -1;
 	}
+	if (_gfxBatchGrow((void **)&batch->strips, batch->numStrips, &batch->maxStrips, 1, sizeof(SDL2_gfxBatchStrip))) {
+		return -1;
+	}
+	if (_gfxBatchGrow((void **)&batch->lines, batch->numLines, &batch->maxLines, n, sizeof(SDL_Point))) {
+		return -1;
+	}
+	memcpy(&batch->lines[batch->numLines], points, n * sizeof(SDL_Point));
+	batch->strips[batch->numStrips].firstPoint = batch->numLines;
+	batch->strips[batch->numStrips].numPoints = n;
+	batch->numStrips++;
+	batch->numLines += n;
+	run->numStrips++;
+
+	return 0;
+}
 
-	/*
-	* Special case for rad=0 - draw a point 
-	*/
-	if (rad == 0) {
-		return (pixelRGBA(renderer, x, y, r, g, b, a));
+/*!
+\brief Internal function to compute the bounds of the primitives of a batch run.
+
+\param batch The batch holding the run.
+\param run The run to compute the bounds of.
+*/
+static void _gfxBatchBounds(const gfxBatch *batch, SDL2_gfxBatchRun *run)
+{
+	const SDL_Rect *rect;
+	const SDL_Point *point;
+	const SDL2_gfxBatchStrip *strip;
+	int i, j;
+
+	run->x1 = run->y1 = SDL_MAX_SINT32;
+	run->x2 = run->y2 = SDL_MIN_SINT32;
+	for (i = run->firstRect; i < run->firstRect + run->numRects; i++) {
+		rect = &batch->rects[i];
+		run->x1 = SDL_min(run->x1, rect->x);
+		run->y1 = SDL_min(run->y1, rect->y);
+		run->x2 = SDL_max(run->x2, rect->x + rect->w - 1);
+		run->y2 = SDL_max(run->y2, rect->y + rect->h - 1);
+	}
+	for (i = run->firstOutline; i < run->firstOutline + run->numOutlines; i++) {
+		rect = &batch->outlines[i];
+		run->x1 = SDL_min(run->x1, rect->x);
+		run->y1 = SDL_min(run->y1, rect->y);
+		run->x2 = SDL_max(run->x2, rect->x + rect->w - 1);
+		run->y2 = SDL_max(run->y2, rect->y + rect->h - 1);
+	}
+	for (i = run->firstPoint; i < run->firstPoint + run->numPoints; i++) {
+		point = &batch->points[i];
+		run->x1 = SDL_min(run->x1, point->x);
+		run->y1 = SDL_min(run->y1, point->y);
+		run->x2 = SDL_max(run->x2, point->x);
+		run->y2 = SDL_max(run->y2, point->y);
+	}
+	for (i = run->firstStrip; i < run->firstStrip + run->numStrips; i++) {
+		strip = &batch->strips[i];
+		for (j = strip->firstPoint; j < strip->firstPoint + strip->numPoints; j++) {
+			point = &batch->lines[j];
+			run->x1 = SDL_min(run->x1, point->x);
+			run->y1 = SDL_min(run->y1, point->y);
+			run->x2 = SDL_max(run->x2, point->x);
+			run->y2 = SDL_max(run->y2, point->y);
+		}
 	}
+}
 
-	/*
-	 Octant labeling
-	      
-	  \ 5 | 6 /
-	   \  |  /
-	  4 \ | / 7
-	     \|/
-	------+------ +x
-	     /|\
-	  3 / | \ 0
-	   /  |  \
-	  / 2 | 1 \
-	      +y
+/*!
+\brief Maximum number of bounds tested to move a batch run into an earlier group of the same color.
+*/
+#define SDL2_GFX_BATCH_MERGE_TESTS 256
 
-	 Initially reset bitmask to 0x00000000
-	 the set whether or not to keep drawing a given octant.
-	 For example: 0x00111100 means we're drawing in octants 2-5
-	*/
-	drawoct = 0; 
+/*!
+\brief Internal function to test if the bounds of two batch runs overlap.
 
-	/*
-	* Fixup angles
-	*/
-	start %= 360;
-	end %= 360;
-	/* 0 <= start & end < 360; note that sometimes start > end - if so, arc goes back through 0. */
-	while (start < 0) start += 360;
-	while (end < 0) end += 360;
-	start %= 360;
-	end %= 360;
+\param a The first run.
+\param b The second run.
 
-	/* now, we find which octants we're drawing in. */
-	startoct = start / 45;
-	endoct = end / 45;
-	oct = startoct - 1;
+\returns Returns 1 if the bounds overlap, 0 otherwise.
+*/
+static int _gfxBatchOverlap(const SDL2_gfxBatchRun *a, const SDL2_gfxBatchRun *b)
+{
+	return (a->x1 <= b->x2) && (b->x1 <= a->x2) && (a->y1 <= b->y2) && (b->y1 <= a->y2);
+}
 
-	/* stopval_start, stopval_end; what values of cx to stop at. */
-	do {
-		oct = (oct + 1) % 8;
+/*!
+\brief Internal function to group the runs of a batch by color.
 
-		if (oct == startoct) {
-			/* need to compute stopval_start for this octant.  Look at picture above if this is unclear */
-			dstart = (double)start;
-			switch (oct) 
-			{
-			case 0:
-			case 3:
-				temp = sin(dstart * M_PI / 180.);
-				break;
-			case 1:
-			case 6:
-				temp = cos(dstart * M_PI / 180.);
-				break;
-			case 2:
-			case 5:
-				temp = -cos(dstart * M_PI / 180.);
-				break;
-			case 4:
-			case 7:
-				temp = -sin(dstart * M_PI / 180.);
+A run joins the closest earlier group of the same color if it does not overlap any run
+of the groups drawn in between, so moving it does not change the result of blending.
+Otherwise, or when too many bounds would have to be tested, it starts a new group.
+
+\param batch The batch to group.
+*/
+static void _gfxGroupBatchRuns(gfxBatch *batch)
+{
+	SDL2_gfxBatchRun *run, *group, *member;
+	int i, j, k, tests, overlap, lastGroup = -1;
+
+	for (i = 0; i < batch->numRuns; i++) {
+		run = &batch->runs[i];
+		_gfxBatchBounds(batch, run);
+		run->groupX1 = run->x1;
+		run->groupY1 = run->y1;
+		run->groupX2 = run->x2;
+		run->groupY2 = run->y2;
+		run->group = i;
+		run->next = -1;
+		run->last = i;
+
+		tests = 0;
+		overlap = 0;
+		for (j = lastGroup; (j >= 0) && (!overlap); j = group->previous) {
+			group = &batch->runs[j];
+			if ((group->r == run->r) && (group->g == run->g) && (group->b == run->b) && (group->a == run->a)) {
+				batch->runs[group->last].next = i;
+				group->last = i;
+				group->groupX1 = SDL_min(group->groupX1, run->x1);
+				group->groupY1 = SDL_min(group->groupY1, run->y1);
+				group->groupX2 = SDL_max(group->groupX2, run->x2);
+				group->groupY2 = SDL_max(group->groupY2, run->y2);
+				run->group = j;
 				break;
 			}
-			temp *= rad;
-			stopval_start = (int)temp;
 
-			/* 
-			This isn't arbitrary, but requires graph paper to explain well.
-			The basic idea is that we're always changing drawoct after we draw, so we
-			stop immediately after we render the last sensible pixel at x = ((int)temp).
-			and whether to draw in this octant initially
+			/*
+			* Test the runs of the group only if the group bounds overlap 
 			*/
-			if (oct % 2) drawoct |= (1 << oct);			/* this is basically like saying drawoct[oct] = true, if drawoct were a bool array */
-			else		 drawoct &= 255 - (1 << oct);	/* this is basically like saying drawoct[oct] = false */
+			tests++;
+			if ((group->groupX1 <= run->x2) && (run->x1 <= group->groupX2) && (group->groupY1 <= run->y2) && (run->y1 <= group->groupY2)) {
+				for (k = j; (k >= 0) && (!overlap); k = member->next) {
+					member = &batch->runs[k];
+					overlap = _gfxBatchOverlap(member, run);
+					tests++;
+				}
+			}
+			if (tests > SDL2_GFX_BATCH_MERGE_TESTS) {
+				overlap = 1;
+			}
 		}
-		if (oct == endoct) {
-			/* need to compute stopval_end for this octant */
-			dend = (double)end;
-			switch (oct)
-			{
-			case 0:
-			case 3:
-				temp = sin(dend * M_PI / 180);
-				break;
-			case 1:
-			case 6:
-				temp = cos(dend * M_PI / 180);
-				break;
-			case 2:
-			case 5:
-				temp = -cos(dend * M_PI / 180);
-				break;
-			case 4:
-			case 7:
-				temp = -sin(dend * M_PI / 180);
-				break;
+
+		if (run->group == i) {
+			run->previous = lastGroup;
+			lastGroup = i;
+		}
+	}
+}
+
+#ifdef SDL2_GFX_HAVE_LINE_POINTS
+/*!
+\brief Internal function to test if the renderers draw lines as points.
+
+\returns Returns 1 unless SDL_HINT_RENDER_LINE_METHOD selects lines or geometry.
+*/
+static int _gfxLinesAsPoints(void)
+{
+	const char *hint = SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD);
+
+	return (hint == NULL) || ((SDL_atoi(hint) != 2) && (SDL_atoi(hint) != 3));
+}
+
+/*!
+\brief Internal function to get the number of points of a line strip drawn as points.
+
+\param batch The batch holding the strip.
+\param strip The line strip.
+
+\returns Returns the maximum number of points.
+*/
+static int _gfxBatchStripSize(const gfxBatch *batch, const SDL2_gfxBatchStrip *strip)
+{
+	const SDL_Point *p = &batch->lines[strip->firstPoint];
+	int i, n = 0;
+
+	for (i = 0; i < strip->numPoints - 1; i++) {
+		n += SDL_max(abs(p[i + 1].x - p[i].x), abs(p[i + 1].y - p[i].y)) + 1;
+	}
+
+	return n;
+}
+
+/*!
+\brief Internal function to rasterize a line strip into the points SDL draws for it.
+
+Uses the Bresenham variant of the SDL renderer: every segment but the last leaves out its
+end point, which is the start of the next segment, and the end point of a closed strip is
+left out too, so no pixel is blended twice.
+
+\param batch The batch holding the strip.
+\param strip The line strip.
+\param points Array receiving the points, large enough for _gfxBatchStripSize() points.
+
+\returns Returns the number of points stored.
+*/
+static int _gfxBatchStripPoints(const gfxBatch *batch, const SDL2_gfxBatchStrip *strip, SDL_Point *points)
+{
+	const SDL_Point *p = &batch->lines[strip->firstPoint];
+	int i, k, n = 0, count = strip->numPoints, drewLine = 0, drawLast;
+	int deltax, deltay, numpixels, d, dinc1, dinc2, x, xinc1, xinc2, y, yinc1, yinc2;
+
+	for (i = 0; i < count - 1; i++) {
+		if (i == count - 2) {
+			drawLast = (!drewLine) || (p[i + 1].x != p[0].x) || (p[i + 1].y != p[0].y);
+		} else {
+			drawLast = 0;
+			if ((p[i].x == p[i + 1].x) && (p[i].y == p[i + 1].y)) {
+				continue;
 			}
-			temp *= rad;
-			stopval_end = (int)temp;
+		}
 
-			/* and whether to draw in this octant initially */
-			if (startoct == endoct)	{
-				/* note:      we start drawing, stop, then start again in this case */
-				/* otherwise: we only draw in this octant, so initialize it to false, it will get set back to true */
-				if (start > end) {
-					/* unfortunately, if we're in the same octant and need to draw over the whole circle, */
-					/* we need to set the rest to true, because the while loop will end at the bottom. */
-					drawoct = 255;
-				} else {
-					drawoct &= 255 - (1 << oct);
+		deltax = abs(p[i + 1].x - p[i].x);
+		deltay = abs(p[i + 1].y - p[i].y);
+		if (deltax >= deltay) {
+			numpixels = deltax + 1;
+			d = (2 * deltay) - deltax;
+			dinc1 = deltay * 2;
+			dinc2 = (deltay - deltax) * 2;
+			xinc1 = 1;
+			xinc2 = 1;
+			yinc1 = 0;
+			yinc2 = 1;
+		} else {
+			numpixels = deltay + 1;
+			d = (2 * deltax) - deltay;
+			dinc1 = deltax * 2;
+			dinc2 = (deltax - deltay) * 2;
+			xinc1 = 0;
+			xinc2 = 1;
+			yinc1 = 1;
+			yinc2 = 1;
+		}
+		if (p[i].x > p[i + 1].x) {
+			xinc1 = -xinc1;
+			xinc2 = -xinc2;
+		}
+		if (p[i].y > p[i + 1].y) {
+			yinc1 = -yinc1;
+			yinc2 = -yinc2;
+		}
+		if (!drawLast) {
+			numpixels--;
+		}
+
+		x = p[i].x;
+		y = p[i].y;
+		for (k = 0; k < numpixels; k++) {
+			points[n].x = x;
+			points[n].y = y;
+			n++;
+			if (d < 0) {
+				d += dinc1;
+				x += xinc1;
+				y += yinc1;
+			} else {
+				d += dinc2;
+				x += xinc2;
+				y += yinc2;
+			}
+		}
+		drewLine = 1;
+	}
+
+	return n;
+}
+#endif
+
+/*!
+\brief Internal function to draw a group of batch runs with one color.
+
+The rectangles, points and outlines of the runs are copied behind the recorded ones, so each
+kind is drawn with a single call; line strips are added to the points if SDL draws lines
+as points, and are drawn one call per strip otherwise.
+
+\param batch The batch holding the runs.
+\param state The shadowed state of the renderer or NULL.
+\param first The index of the first run of the group.
+\param linePoints Set to 1 to draw the line strips as points.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawBatchGroup(gfxBatch *batch, SDL2_gfxRendererState *state, int first, int linePoints)
+{
+	int result = 0;
+	int i, j, numRects = 0, numPoints = 0, numOutlines = 0, numStrips = 0;
+	SDL2_gfxBatchRun *run;
+	SDL2_gfxBatchStrip *strip;
+	SDL_Rect *rects, *outlines;
+	SDL_Point *points;
+#ifdef SDL2_GFX_STATS
+	gfxPrimitivesStats *stats = &gfxGetContext()->stats[GFX_STATS_BATCH];
+#endif
+
+	for (i = first; i >= 0; i = run->next) {
+		run = &batch->runs[i];
+		numRects += run->numRects;
+		numPoints += run->numPoints;
+		numOutlines += run->numOutlines;
+		numStrips += run->numStrips;
+#ifdef SDL2_GFX_HAVE_LINE_POINTS
+		if (linePoints) {
+			for (j = run->firstStrip; j < run->firstStrip + run->numStrips; j++) {
+				numPoints += _gfxBatchStripSize(batch, &batch->strips[j]);
+			}
+		}
+#endif
+	}
+	if (linePoints) {
+		numStrips = 0;
+	}
+
+	/*
+	* Collect the primitives of the group behind the recorded ones
+	*/
+	run = &batch->runs[first];
+	if ((run->next < 0) && (!linePoints)) {
+		rects = &batch->rects[run->firstRect];
+		points = &batch->points[run->firstPoint];
+		outlines = &batch->outlines[run->firstOutline];
+	} else {
+		if ((_gfxBatchGrow((void **)&batch->rects, batch->numRects, &batch->maxRects, numRects, sizeof(SDL_Rect))) ||
+			(_gfxBatchGrow((void **)&batch->points, batch->numPoints, &batch->maxPoints, numPoints, sizeof(SDL_Point))) ||
+			(_gfxBatchGrow((void **)&batch->outlines, batch->numOutlines, &batch->maxOutlines, numOutlines, sizeof(SDL_Rect)))) {
+			return -1;
+		}
+		rects = &batch->rects[batch->numRects];
+		points = &batch->points[batch->numPoints];
+		outlines = &batch->outlines[batch->numOutlines];
+		numRects = numPoints = numOutlines = 0;
+		for (i = first; i >= 0; i = run->next) {
+			run = &batch->runs[i];
+			for (j = 0; j < run->numRects; j++) {
+				rects[numRects++] = batch->rects[run->firstRect + j];
+			}
+			for (j = 0; j < run->numPoints; j++) {
+				points[numPoints++] = batch->points[run->firstPoint + j];
+			}
+			for (j = 0; j < run->numOutlines; j++) {
+				outlines[numOutlines++] = batch->outlines[run->firstOutline + j];
+			}
+#ifdef SDL2_GFX_HAVE_LINE_POINTS
+			if (linePoints) {
+				for (j = run->firstStrip; j < run->firstStrip + run->numStrips; j++) {
+					numPoints += _gfxBatchStripPoints(batch, &batch->strips[j], &points[numPoints]);
 				}
-			} 
-			else if (oct % 2) drawoct &= 255 - (1 << oct);
-			else			  drawoct |= (1 << oct);
-		} else if (oct != startoct) { /* already verified that it's != endoct */
-			drawoct |= (1 << oct); /* draw this entire segment */
+			}
+#endif
 		}
-	} while (oct != endoct);
+	}
+
+#ifdef SDL2_GFX_STATS
+	stats->renderCalls += (numRects > 0) + (numPoints > 0) + (numOutlines > 0) + numStrips;
+#endif
+	run = &batch->runs[first];
+	result |= _gfxSetBlendMode(batch->renderer, state, (run->a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+	result |= _gfxSetDrawColor(batch->renderer, state, run->r, run->g, run->b, run->a);
+	if (numRects > 0) {
+		result |= SDL_RenderFillRects(batch->renderer, rects, numRects);
+	}
+	if (numPoints > 0) {
+		result |= SDL_RenderDrawPoints(batch->renderer, points, numPoints);
+	}
+	if (numOutlines > 0) {
+		result |= SDL_RenderDrawRects(batch->renderer, outlines, numOutlines);
+	}
+	if (numStrips == 0) {
+		return result;
+	}
+
+	for (i = first; i >= 0; i = run->next) {
+		run = &batch->runs[i];
+		for (j = run->firstStrip; j < run->firstStrip + run->numStrips; j++) {
+			strip = &batch->strips[j];
+			if (strip->numPoints == 2) {
+				result |= SDL_RenderDrawLine(batch->renderer,
+					batch->lines[strip->firstPoint].x, batch->lines[strip->firstPoint].y,
+					batch->lines[strip->firstPoint + 1].x, batch->lines[strip->firstPoint + 1].y);
+			} else {
+				result |= SDL_RenderDrawLines(batch->renderer, &batch->lines[strip->firstPoint], strip->numPoints);
+			}
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Create a batch which records primitives drawn on a renderer.
+
+Once started with gfxBeginBatch(), all primitives drawn on the renderer of the batch
+are recorded instead of being drawn. When the batch is flushed, primitives using the same
+color and blend mode are grouped, also across other colors as long as they do not overlap
+the primitives drawn in between: the color is set once per group, pixels are drawn with one
+SDL_RenderDrawPoints call, and horizontal lines, vertical lines, boxes and rectangles with one
+SDL_RenderFillRects and SDL_RenderDrawRects call. With SDL 2.0.20 or newer, lines are added
+to the pixels as the points SDL draws for them, unless SDL_HINT_RENDER_LINE_METHOD selects
+another line method; otherwise each line or polyline is one call.
+
+\param renderer The renderer the batch draws on.
+
+\returns Returns the new batch or NULL on failure.
+*/
+gfxBatch *gfxCreateBatch(SDL_Renderer *renderer)
+{
+	gfxBatch *batch;
+
+	if (renderer == NULL) {
+		return NULL;
+	}
+
+	batch = (gfxBatch *)calloc(1, sizeof(gfxBatch));
+	if (batch == NULL) {
+		return NULL;
+	}
+	batch->renderer = renderer;
+
+	return batch;
+}
+
+/*!
+\brief Start recording primitives into a batch.
+
+The batch is activated in the current context (see gfxSetContext), so it only records
+primitives drawn from threads using that context.
+
+Only one batch can be active per renderer. Primitives which cannot be batched (i.e. text and
+textured polygons) flush the batch before they are drawn, so drawing order is preserved.
+Flush the batch before drawing on the renderer with other SDL functions.
+
+\param batch The batch to activate.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxBeginBatch(gfxBatch *batch)
+{
+	gfxContext *context;
+	gfxBatch *other;
+
+	if (batch == NULL) {
+		return -1;
+	}
+	if (batch->active) {
+		return 0;
+	}
+
+	context = gfxGetContext();
+	for (other = context->batches; other != NULL; other = other->next) {
+		if (other->renderer == batch->renderer) {
+			return -1;
+		}
+	}
+
+	batch->active = 1;
+	batch->context = context;
+	batch->next = context->batches;
+	context->batches = batch;
+
+	return 0;
+}
+
+static int _gfxCutDisplayList(gfxDisplayList *list);
+static int _gfxListCopy(gfxDisplayList *list, SDL_Texture *texture, const SDL_Rect *srcrect, const SDL_Rect *dstrect);
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+static int _gfxListGeometry(gfxDisplayList *list, SDL_Texture *texture, const SDL_Vertex *vertices, int numVertices, const int *indices, int numIndices);
+#endif
+
+/*!
+\brief Draw all primitives recorded in a batch and empty it.
+
+The batch of a display list is not drawn; its primitives become draw calls of the list.
+
+\param batch The batch to flush.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxFlushBatch(gfxBatch *batch)
+{
+	int result = 0;
+	int i, linePoints = 0;
+	SDL2_gfxRendererState *state;
+#ifdef SDL2_GFX_STATS
+	gfxPrimitivesStats *stats;
+	Uint64 start = SDL_GetPerformanceCounter();
+#endif
+
+	if (batch == NULL) {
+		return -1;
+	}
+	if (batch->list != NULL) {
+		return _gfxCutDisplayList(batch->list);
+	}
+	if (batch->numRuns == 0) {
+		return 0;
+	}
+
+#ifdef SDL2_GFX_STATS
+	stats = &gfxGetContext()->stats[GFX_STATS_BATCH];
+	stats->calls++;
+#endif
+	state = _gfxRendererState(batch->renderer);
+#ifdef SDL2_GFX_HAVE_LINE_POINTS
+	linePoints = _gfxLinesAsPoints();
+#endif
+	_gfxGroupBatchRuns(batch);
+	for (i = 0; i < batch->numRuns; i++) {
+		if (batch->runs[i].group == i) {
+			result |= _gfxDrawBatchGroup(batch, state, i, linePoints);
+		}
+	}
+
+#ifdef SDL2_GFX_STATS
+	stats->time += SDL_GetPerformanceCounter() - start;
+#endif
+	batch->numRuns = 0;
+	batch->numPoints = 0;
+	batch->numRects = 0;
+	batch->numOutlines = 0;
+	batch->numStrips = 0;
+	batch->numLines = 0;
+
+	return result;
+}
+
+/*!
+\brief Flush a batch and stop recording primitives into it.
+
+\param batch The batch to deactivate.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxEndBatch(gfxBatch *batch)
+{
+	gfxBatch **link;
+
+	if (batch == NULL) {
+		return -1;
+	}
+
+	if (batch->active) {
+		for (link = &batch->context->batches; *link != NULL; link = &(*link)->next) {
+			if (*link == batch) {
+				*link = batch->next;
+				break;
+			}
+		}
+		batch->active = 0;
+		batch->context = NULL;
+		batch->next = NULL;
+	}
+
+	return gfxFlushBatch(batch);
+}
+
+/*!
+\brief End a batch if required and free it.
+
+\param batch The batch to free.
+*/
+void gfxDestroyBatch(gfxBatch *batch)
+{
+	if (batch == NULL) {
+		return;
+	}
+
+	gfxEndBatch(batch);
+	free(batch->runs);
+	free(batch->points);
+	free(batch->rects);
+	free(batch->outlines);
+	free(batch->strips);
+	free(batch->lines);
+	free(batch);
+}
+
+/* ---- Surface */
+
+/*!
+\brief Internal function to blend the current target color into a 32bit pixel.
+
+Uses the same formula as the SDL software renderer with SDL_BLENDMODE_BLEND.
+
+\param dst The surface target with the current color.
+\param pixel The pixel value to blend into.
+
+\returns Returns the blended pixel value.
+*/
+static Uint32 _gfxSurfaceBlend32(SDL2_gfxTarget *dst, Uint32 pixel)
+{
+	SDL_PixelFormat *format = dst->surface->format;
+	Uint32 inva = 255 - dst->a;
+	Uint32 dR, dG, dB, dA;
+
+	dR = (pixel & format->Rmask) >> format->Rshift;
+	dG = (pixel & format->Gmask) >> format->Gshift;
+	dB = (pixel & format->Bmask) >> format->Bshift;
+	dR = (dst->r * dst->a) / 255 + (dR * inva) / 255;
+	dG = (dst->g * dst->a) / 255 + (dG * inva) / 255;
+	dB = (dst->b * dst->a) / 255 + (dB * inva) / 255;
+	pixel = (pixel & ~(format->Rmask | format->Gmask | format->Bmask)) |
+		(dR << format->Rshift) | (dG << format->Gshift) | (dB << format->Bshift);
+	if (format->Amask) {
+		dA = (pixel & format->Amask) >> format->Ashift;
+		dA = dst->a + (dA * inva) / 255;
+		pixel = (pixel & ~format->Amask) | (dA << format->Ashift);
+	}
+
+	return pixel;
+}
+
+/*!
+\brief Internal function to blend the current target color into an 8bit palettized pixel.
+
+\param dst The surface target with the current color.
+\param pixel The palette index to blend into.
+
+\returns Returns the palette index closest to the blended color.
+*/
+static Uint8 _gfxSurfaceBlend8(SDL2_gfxTarget *dst, Uint8 pixel)
+{
+	SDL_Color *color;
+	Uint32 inva;
+
+	/*
+	* SDL_MapRGB searches the whole palette, so the last mapped index is kept 
+	*/
+	if (dst->blendIndex == pixel) {
+		return dst->blendPixel;
+	}
+
+	color = &dst->surface->format->palette->colors[pixel];
+	inva = 255 - dst->a;
+	dst->blendIndex = pixel;
+	dst->blendPixel = (Uint8)SDL_MapRGB(dst->surface->format,
+		(Uint8)((dst->r * dst->a) / 255 + (color->r * inva) / 255),
+		(Uint8)((dst->g * dst->a) / 255 + (color->g * inva) / 255),
+		(Uint8)((dst->b * dst->a) / 255 + (color->b * inva) / 255));
+	return dst->blendPixel;
+}
+
+/*!
+\brief Internal function to fill a rectangle of a surface in the current target color.
+
+The rectangle is clipped against the clipping rectangle of the surface.
+
+\param dst The surface target to draw on.
+\param x X coordinate of the upper left corner of the rectangle.
+\param y Y coordinate of the upper left corner of the rectangle.
+\param w Width of the rectangle.
+\param h Height of the rectangle.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSurfaceFill(SDL2_gfxTarget *dst, int x, int y, int w, int h)
+{
+	SDL_Surface *surface = dst->surface;
+	SDL_Rect *clip = &surface->clip_rect;
+	Uint8 *row, *p8;
+	Uint32 *p32;
+	int ix, iy;
+
+	/*
+	* Clip 
+	*/
+	if (x < clip->x) {
+		w -= clip->x - x;
+		x = clip->x;
+	}
+	if (y < clip->y) {
+		h -= clip->y - y;
+		y = clip->y;
+	}
+	if (x + w > clip->x + clip->w) {
+		w = clip->x + clip->w - x;
+	}
+	if (y + h > clip->y + clip->h) {
+		h = clip->y + clip->h - y;
+	}
+	if ((w <= 0) || (h <= 0)) {
+		return 0;
+	}
+	_gfxDamage(dst, x, y, x + w - 1, y + h - 1);
+
+	row = (Uint8 *)surface->pixels + y * surface->pitch;
+	switch (surface->format->BytesPerPixel) {
+	case 1:
+		for (iy = 0; iy < h; iy++) {
+			p8 = row + x;
+			if (dst->a == 255) {
+				memset(p8, (int)dst->color, w);
+			} else {
+				for (ix = 0; ix < w; ix++) {
+					p8[ix] = _gfxSurfaceBlend8(dst, p8[ix]);
+				}
+			}
+			row += surface->pitch;
+		}
+		break;
+	case 4:
+		for (iy = 0; iy < h; iy++) {
+			p32 = (Uint32 *)row + x;
+			if (dst->a == 255) {
+				for (ix = 0; ix < w; ix++) {
+					p32[ix] = dst->color;
+				}
+			} else {
+				for (ix = 0; ix < w; ix++) {
+					p32[ix] = _gfxSurfaceBlend32(dst, p32[ix]);
+				}
+			}
+			row += surface->pitch;
+		}
+		break;
+	default:
+		return -1;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to divide rounding towards negative infinity.
+
+\param a The dividend.
+\param b The divisor. Must be >0.
+
+\returns Returns the largest integer not greater than a / b.
+*/
+static Sint64 _gfxFloorDiv(Sint64 a, Sint64 b)
+{
+	return (a >= 0) ? (a / b) : -((b - 1 - a) / b);
+}
+
+/*!
+\brief Internal function to draw a line on a surface in the current target color.
+
+The pixels are the ones of the Bresenham algorithm: pixel i along the major axis is
+offset by (2*minor*i + major) / (2*major) along the minor axis. Only the pixels inside
+the clipping rectangle of the surface are stepped.
+
+\param dst The surface target to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param draw_end Flag indicating if the second point of the line is drawn.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSurfaceLine(SDL2_gfxTarget *dst, int x1, int y1, int x2, int y2, int draw_end)
+{
+	SDL_Rect *clip = &dst->surface->clip_rect;
+	int result = 0;
+	int dx, dy, sx, sy, i, major, minor, offset, rem;
+	int x, y, xlo, xhi, ylo, yhi;
+	Sint64 first, last;
+
+	/*
+	* Straight lines are spans 
+	*/
+	if (y1 == y2) {
+		if (!draw_end) {
+			if (x1 == x2) {
+				return 0;
+			}
+			x2 += (x1 < x2) ? -1 : 1;
+		}
+		return _gfxSurfaceFill(dst, (x1 < x2) ? x1 : x2, y1, abs(x2 - x1) + 1, 1);
+	}
+	if (x1 == x2) {
+		if (!draw_end) {
+			y2 += (y1 < y2) ? -1 : 1;
+		}
+		return _gfxSurfaceFill(dst, x1, (y1 < y2) ? y1 : y2, 1, abs(y2 - y1) + 1);
+	}
+
+	_gfxDamage(dst, SDL_min(x1, x2), SDL_min(y1, y2), SDL_max(x1, x2), SDL_max(y1, y2));
+
+	/*
+	* Bresenham; the steps of the line in the coordinates of its major and minor axis 
+	*/
+	dx = abs(x2 - x1);
+	dy = abs(y2 - y1);
+	sx = (x1 < x2) ? 1 : -1;
+	sy = (y1 < y2) ? 1 : -1;
+	xlo = (sx > 0) ? clip->x - x1 : x1 - (clip->x + clip->w - 1);
+	xhi = (sx > 0) ? clip->x + clip->w - 1 - x1 : x1 - clip->x;
+	ylo = (sy > 0) ? clip->y - y1 : y1 - (clip->y + clip->h - 1);
+	yhi = (sy > 0) ? clip->y + clip->h - 1 - y1 : y1 - clip->y;
+	if (dx >= dy) {
+		major = dx;
+		minor = dy;
+	} else {
+		major = dy;
+		minor = dx;
+		i = xlo;
+		xlo = ylo;
+		ylo = i;
+		i = xhi;
+		xhi = yhi;
+		yhi = i;
+	}
+
+	/*
+	* Clip (Liang-Barsky on the steps): the major axis limits the steps directly,
+	* the minor axis through its offset 
+	*/
+	first = SDL_max(0, xlo);
+	last = SDL_min((draw_end) ? major : major - 1, xhi);
+	first = SDL_max(first, -_gfxFloorDiv(-(2 * (Sint64)major * ylo - major), 2 * (Sint64)minor));
+	last = SDL_min(last, _gfxFloorDiv(2 * (Sint64)major * (yhi + 1) - major - 1, 2 * (Sint64)minor));
+	if (first > last) {
+		return 0;
+	}
+
+	/*
+	* Step the visible pixels 
+	*/
+	offset = (int)((2 * (Sint64)minor * first + major) / (2 * (Sint64)major));
+	rem = (int)((2 * (Sint64)minor * first + major) % (2 * (Sint64)major));
+	for (i = (int)first; i <= (int)last; i++) {
+		if (dx >= dy) {
+			x = x1 + sx * i;
+			y = y1 + sy * offset;
+		} else {
+			x = x1 + sx * offset;
+			y = y1 + sy * i;
+		}
+		result |= _gfxSurfaceFill(dst, x, y, 1, 1);
+		rem += 2 * minor;
+		if (rem >= 2 * major) {
+			rem -= 2 * major;
+			offset++;
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to set up a drawing target for a surface.
+
+Locks the surface if required. Only 8bit palettized and 32bit surfaces are supported.
+
+\param dst The target to initialize.
+\param surface The surface to draw on.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSurfaceTarget(SDL2_gfxTarget *dst, SDL_Surface *surface)
+{
+	memset(dst, 0, sizeof(SDL2_gfxTarget));
+	dst->context = gfxGetContext();
+	if (surface == NULL) {
+		return -1;
+	}
+
+	switch (surface->format->BytesPerPixel) {
+	case 1:
+		if (surface->format->palette == NULL) {
+			return SDL_SetError("Unsupported 8bit surface without palette");
+		}
+		break;
+	case 4:
+		break;
+	default:
+		return SDL_SetError("Unsupported surface depth of %d bits", surface->format->BitsPerPixel);
+	}
+
+	if (SDL_MUSTLOCK(surface)) {
+		if (SDL_LockSurface(surface) < 0) {
+			return -1;
+		}
+		dst->locked = 1;
+	}
+	dst->surface = surface;
+	dst->clip = surface->clip_rect;
+	dst->cull = 1;
+	dst->blendIndex = -1;
+	_gfxTrackDamage(dst, 0, 0);
+
+	return 0;
+}
+
+/*!
+\brief Internal function to release a surface drawing target.
+
+\param dst The target to release.
+*/
+static void _gfxSurfaceTargetDone(SDL2_gfxTarget *dst)
+{
+	if (dst->locked) {
+		SDL_UnlockSurface(dst->surface);
+		dst->locked = 0;
+	}
+}
+
+/* ---- Target */
+
+/*!
+\brief Internal function to set up a drawing target for a renderer.
+
+The visible area is the viewport intersected with the clip rectangle of the
+renderer at the time of the call, also for primitives recorded into a batch.
+Primitives recorded into a display list are not culled, since the list can be
+drawn at any position.
+
+\param dst The target to initialize.
+\param renderer The renderer to draw on.
+*/
+static void _gfxTarget(SDL2_gfxTarget *dst, SDL_Renderer *renderer)
+{
+	gfxBatch *batch;
+	SDL_Rect viewport, clip;
+
+	memset(dst, 0, sizeof(SDL2_gfxTarget));
+	dst->renderer = renderer;
+	dst->context = gfxGetContext();
+	for (batch = dst->context->batches; batch != NULL; batch = batch->next) {
+		if (batch->renderer == renderer) {
+			dst->batch = batch;
+			break;
+		}
+	}
+
+	/*
+	* Visible area in drawing coordinates 
+	*/
+	if (renderer == NULL) {
+		return;
+	}
+	dst->state = _gfxRendererState(renderer);
+	if ((dst->batch) && (dst->batch->list)) {
+		return;
+	}
+	SDL_RenderGetViewport(renderer, &viewport);
+	if ((viewport.w <= 0) || (viewport.h <= 0)) {
+		return;
+	}
+	dst->clip.x = 0;
+	dst->clip.y = 0;
+	dst->clip.w = viewport.w;
+	dst->clip.h = viewport.h;
+	if (SDL_RenderIsClipEnabled(renderer)) {
+		SDL_RenderGetClipRect(renderer, &clip);
+		if (!SDL_IntersectRect(&dst->clip, &clip, &dst->clip)) {
+			dst->clip.w = 0;
+			dst->clip.h = 0;
+		}
+	}
+	dst->cull = 1;
+	_gfxTrackDamage(dst, viewport.x, viewport.y);
+}
+
+/*!
+\brief Internal function to test if a rectangle lies outside of the visible area of a target.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the left edge of the rectangle.
+\param y1 Y coordinate of the top edge of the rectangle.
+\param x2 X coordinate of the right edge of the rectangle (inclusive).
+\param y2 Y coordinate of the bottom edge of the rectangle (inclusive).
+
+\returns Returns 1 if no pixel of the rectangle is visible, 0 otherwise.
+*/
+static int _gfxCull(const SDL2_gfxTarget *dst, int x1, int y1, int x2, int y2)
+{
+	if (!dst->cull) {
+		return 0;
+	}
+
+	return ((x2 < dst->clip.x) || (y2 < dst->clip.y) ||
+		(x1 >= dst->clip.x + dst->clip.w) || (y1 >= dst->clip.y + dst->clip.h));
+}
+
+/*!
+\brief Internal function to test if the bounding box of points lies outside of the visible area of a target.
+
+\param dst The target to draw on.
+\param vx Array of the X coordinates of the points.
+\param vy Array of the Y coordinates of the points.
+\param n Number of points.
+\param margin Number of pixels the shape may extend beyond its points.
+
+\returns Returns 1 if no pixel of the shape is visible, 0 otherwise.
+*/
+static int _gfxCullPoints(const SDL2_gfxTarget *dst, const Sint16 *vx, const Sint16 *vy, int n, int margin)
+{
+	int i, minx, miny, maxx, maxy;
+
+	if ((!dst->cull) || (n <= 0)) {
+		return 0;
+	}
+
+	minx = maxx = vx[0];
+	miny = maxy = vy[0];
+	for (i = 1; i < n; i++) {
+		if (vx[i] < minx) {
+			minx = vx[i];
+		} else if (vx[i] > maxx) {
+			maxx = vx[i];
+		}
+		if (vy[i] < miny) {
+			miny = vy[i];
+		} else if (vy[i] > maxy) {
+			maxy = vy[i];
+		}
+	}
+
+	return _gfxCull(dst, minx - margin, miny - margin, maxx + margin, maxy + margin);
+}
+
+/*!
+\brief Internal function to test if a pixel lies inside of the visible area of a target.
+
+\param dst The target to draw on.
+\param x X coordinate of the pixel.
+\param y Y coordinate of the pixel.
+
+\returns Returns 1 if the pixel is visible or the target does not cull, 0 otherwise.
+*/
+static int _gfxVisible(const SDL2_gfxTarget *dst, int x, int y)
+{
+	return ((!dst->cull) ||
+		((x >= dst->clip.x) && (y >= dst->clip.y) && (x < dst->clip.x + dst->clip.w) && (y < dst->clip.y + dst->clip.h)));
+}
+
+/*!
+\brief Internal function to get the Cohen-Sutherland outcode of a point.
+
+\param dst The target to draw on; must cull.
+\param x X coordinate of the point.
+\param y Y coordinate of the point.
+
+\returns Returns a bit mask of the sides of the visible area the point lies beyond (1 left, 2 right, 4 top, 8 bottom).
+*/
+static int _gfxOutcode(const SDL2_gfxTarget *dst, int x, int y)
+{
+	int code = 0;
+
+	if (x < dst->clip.x) {
+		code |= 1;
+	} else if (x >= dst->clip.x + dst->clip.w) {
+		code |= 2;
+	}
+	if (y < dst->clip.y) {
+		code |= 4;
+	} else if (y >= dst->clip.y + dst->clip.h) {
+		code |= 8;
+	}
+
+	return code;
+}
+
+/*!
+\brief Internal function to set the color used by the following target drawing calls.
+
+Enables blending if a<255.
+
+\param dst The target to draw on.
+\param r The red value of the color.
+\param g The green value of the color.
+\param b The blue value of the color.
+\param a The alpha value of the color.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxColor(SDL2_gfxTarget *dst, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+
+	if (dst->surface) {
+		dst->r = r;
+		dst->g = g;
+		dst->b = b;
+		dst->a = a;
+		dst->blendIndex = -1;
+		if (dst->surface->format->BytesPerPixel == 1) {
+			dst->color = SDL_MapRGB(dst->surface->format, r, g, b);
+		} else {
+			dst->color = SDL_MapRGBA(dst->surface->format, r, g, b, a);
+		}
+		return 0;
+	}
+
+	if (dst->batch) {
+		dst->batch->r = r;
+		dst->batch->g = g;
+		dst->batch->b = b;
+		dst->batch->a = a;
+		return 0;
+	}
+
+	result |= _gfxSetBlendMode(dst->renderer, dst->state, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+	result |= _gfxSetDrawColor(dst->renderer, dst->state, r, g, b, a);
+	return result;
+}
+
+/*!
+\brief Internal function to draw a pixel on a target in the current color.
+
+\param dst The target to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxPixel(SDL2_gfxTarget *dst, Sint16 x, Sint16 y)
+{
+	SDL_Point point;
+
+	if (!_gfxVisible(dst, x, y)) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, pixels, 1);
+	if (dst->surface) {
+		return _gfxSurfaceFill(dst, x, y, 1, 1);
+	}
+
+	_gfxDamage(dst, x, y, x, y);
+	if (dst->batch) {
+		point.x = x;
+		point.y = y;
+		return _gfxBatchPoints(dst->batch, &point, 1);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawPoint(dst->renderer, x, y);
+}
+
+/*!
+\brief Internal function to draw pixels on a target in the current color.
+
+\param dst The target to draw on.
+\param points Array of points.
+\param n Number of points in the array.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxPixels(SDL2_gfxTarget *dst, const SDL_Point *points, int n)
+{
+	int result = 0;
+	int i;
+
+	SDL2_GFX_STATS_ADD(dst->context, pixels, n);
+	if (dst->surface) {
+		for (i = 0; i < n; i++) {
+			result |= _gfxSurfaceFill(dst, points[i].x, points[i].y, 1, 1);
+		}
+		return result;
+	}
+
+	_gfxDamagePoints(dst, points, n);
+	if (dst->batch) {
+		return _gfxBatchPoints(dst->batch, points, n);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawPoints(dst->renderer, points, n);
+}
+
+/*!
+\brief Internal function to draw a horizontal line on a target in the current color.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y Y coordinate of the points of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxHline(SDL2_gfxTarget *dst, Sint16 x1, Sint16 x2, Sint16 y)
+{
+	if (_gfxCull(dst, SDL_min(x1, x2), y, SDL_max(x1, x2), y)) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, 1);
+	if (dst->surface) {
+		return _gfxSurfaceLine(dst, x1, y, x2, y, 1);
+	}
+
+	_gfxDamage(dst, SDL_min(x1, x2), y, SDL_max(x1, x2), y);
+	if (dst->batch) {
+		if (x1 > x2) {
+			return _gfxBatchRect(dst->batch, x2, y, x1 - x2 + 1, 1);
+		}
+		return _gfxBatchRect(dst->batch, x1, y, x2 - x1 + 1, 1);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawLine(dst->renderer, x1, y, x2, y);
+}
+
+/*!
+\brief Internal function to draw a vertical line on a target in the current color.
+
+\param dst The target to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point of the line.
+\param y2 Y coordinate of the second point of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxVline(SDL2_gfxTarget *dst, Sint16 x, Sint16 y1, Sint16 y2)
+{
+	if (_gfxCull(dst, x, SDL_min(y1, y2), x, SDL_max(y1, y2))) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, 1);
+	if (dst->surface) {
+		return _gfxSurfaceLine(dst, x, y1, x, y2, 1);
+	}
+
+	_gfxDamage(dst, x, SDL_min(y1, y2), x, SDL_max(y1, y2));
+	if (dst->batch) {
+		if (y1 > y2) {
+			return _gfxBatchRect(dst->batch, x, y2, 1, y1 - y2 + 1);
+		}
+		return _gfxBatchRect(dst->batch, x, y1, 1, y2 - y1 + 1);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawLine(dst->renderer, x, y1, x, y2);
+}
+
+/*!
+\brief Internal function to draw a line on a target in the current color.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxLine(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2)
+{
+	SDL_Point points[2];
+
+	/*
+	* Trivially reject lines with both ends beyond the same side 
+	*/
+	if ((dst->cull) && (_gfxOutcode(dst, x1, y1) & _gfxOutcode(dst, x2, y2))) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, 1);
+	if (dst->surface) {
+		return _gfxSurfaceLine(dst, x1, y1, x2, y2, 1);
+	}
+
+	_gfxDamage(dst, SDL_min(x1, x2), SDL_min(y1, y2), SDL_max(x1, x2), SDL_max(y1, y2));
+	if (dst->batch) {
+		points[0].x = x1;
+		points[0].y = y1;
+		points[1].x = x2;
+		points[1].y = y2;
+		return _gfxBatchLines(dst->batch, points, 2);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawLine(dst->renderer, x1, y1, x2, y2);
+}
+
+/*!
+\brief Internal function to draw connected lines on a target in the current color.
+
+\param dst The target to draw on.
+\param points Array of points of the lines.
+\param n Number of points in the array.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxLines(SDL2_gfxTarget *dst, const SDL_Point *points, int n)
+{
+	int result = 0;
+	int i;
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, SDL_max(n - 1, 1));
+	if (dst->surface) {
+		/* Joints are drawn once, like the SDL software renderer does */
+		for (i = 1; i < n; i++) {
+			result |= _gfxSurfaceLine(dst, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, 0);
+		}
+		if ((n == 1) || ((n > 1) && ((points[0].x != points[n - 1].x) || (points[0].y != points[n - 1].y)))) {
+			result |= _gfxSurfaceFill(dst, points[n - 1].x, points[n - 1].y, 1, 1);
+		}
+		return result;
+	}
+
+	_gfxDamagePoints(dst, points, n);
+	if (dst->batch) {
+		return _gfxBatchLines(dst->batch, points, n);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawLines(dst->renderer, points, n);
+}
+
+/*!
+\brief Internal function to draw a filled rectangle on a target in the current color.
+
+\param dst The target to draw on.
+\param rect The rectangle to fill.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillRect(SDL2_gfxTarget *dst, const SDL_Rect *rect)
+{
+	if (_gfxCull(dst, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1)) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, 1);
+	if (dst->surface) {
+		return _gfxSurfaceFill(dst, rect->x, rect->y, rect->w, rect->h);
+	}
+
+	_gfxDamage(dst, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1);
+	if (dst->batch) {
+		return _gfxBatchRect(dst->batch, rect->x, rect->y, rect->w, rect->h);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderFillRect(dst->renderer, rect);
+}
+
+/*!
+\brief Internal function to draw filled rectangles on a target in the current color.
+
+\param dst The target to draw on.
+\param rects The rectangles to fill.
+\param n Number of rectangles.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillRects(SDL2_gfxTarget *dst, const SDL_Rect *rects, int n)
+{
+	int result = 0;
+	int i;
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, n);
+	if (dst->surface) {
+		for (i = 0; i < n; i++) {
+			result |= _gfxSurfaceFill(dst, rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+		}
+		return result;
+	}
+
+	if (dst->damage) {
+		for (i = 0; i < n; i++) {
+			_gfxDamage(dst, rects[i].x, rects[i].y, rects[i].x + rects[i].w - 1, rects[i].y + rects[i].h - 1);
+		}
+	}
+	if (dst->batch) {
+		for (i = 0; i < n; i++) {
+			result |= _gfxBatchRect(dst->batch, rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+		}
+		return result;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderFillRects(dst->renderer, rects, n);
+}
+
+/*!
+\brief Internal function to draw a rectangle outline on a target in the current color.
+
+\param dst The target to draw on.
+\param rect The rectangle to outline.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawRect(SDL2_gfxTarget *dst, const SDL_Rect *rect)
+{
+	int result = 0;
+
+	if (_gfxCull(dst, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1)) {
+		return 0;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, spans, 4);
+	if (dst->surface) {
+		/* Draw the edges without overlapping corners */
+		result |= _gfxSurfaceFill(dst, rect->x, rect->y, rect->w, 1);
+		if (rect->h > 1) {
+			result |= _gfxSurfaceFill(dst, rect->x, rect->y + rect->h - 1, rect->w, 1);
+		}
+		if (rect->h > 2) {
+			result |= _gfxSurfaceFill(dst, rect->x, rect->y + 1, 1, rect->h - 2);
+			if (rect->w > 1) {
+				result |= _gfxSurfaceFill(dst, rect->x + rect->w - 1, rect->y + 1, 1, rect->h - 2);
+			}
+		}
+		return result;
+	}
+
+	_gfxDamage(dst, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1);
+	if (dst->batch) {
+		return _gfxBatchOutline(dst->batch, rect);
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	return SDL_RenderDrawRect(dst->renderer, rect);
+}
+
+/*!
+\brief Internal function to copy a texture onto a target.
+
+Flushes an active batch first, since texture copies cannot be batched; display lists record the copy.
+
+\param dst The target to draw on.
+\param texture The texture to copy.
+\param srcrect The source rectangle in the texture.
+\param dstrect The destination rectangle on the target.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCopy(SDL2_gfxTarget *dst, SDL_Texture *texture, const SDL_Rect *srcrect, const SDL_Rect *dstrect)
+{
+	int result = 0;
+
+	if (dst->surface) {
+		return SDL_SetError("Cannot copy textures onto a surface");
+	}
+
+	if ((dstrect != NULL) && 
+		(_gfxCull(dst, dstrect->x, dstrect->y, dstrect->x + dstrect->w - 1, dstrect->y + dstrect->h - 1))) {
+		return 0;
+	}
+
+	if (dstrect != NULL) {
+		_gfxDamage(dst, dstrect->x, dstrect->y, dstrect->x + dstrect->w - 1, dstrect->y + dstrect->h - 1);
+	} else {
+		_gfxDamage(dst, dst->clip.x, dst->clip.y, dst->clip.x + dst->clip.w - 1, dst->clip.y + dst->clip.h - 1);
+	}
+	if (dst->batch) {
+		if (dst->batch->list) {
+			return _gfxListCopy(dst->batch->list, texture, srcrect, dstrect);
+		}
+		result |= gfxFlushBatch(dst->batch);
+	}
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	result |= SDL_RenderCopy(dst->renderer, texture, srcrect, dstrect);
+
+	return result;
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief Internal function to render triangles onto a target.
+
+Flushes an active batch first, since geometry cannot be batched; display lists record the triangles.
+
+\param dst The target to draw on.
+\param texture The texture to map onto the triangles or NULL.
+\param vertices The vertices of the triangles.
+\param numVertices Number of vertices.
+\param indices The vertex indices of the triangles or NULL.
+\param numIndices Number of indices.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxGeometry(SDL2_gfxTarget *dst, SDL_Texture *texture, const SDL_Vertex *vertices, int numVertices, const int *indices, int numIndices)
+{
+	int result = 0;
+	int i;
+
+	if (dst->surface) {
+		return SDL_SetError("Cannot render geometry onto a surface");
+	}
+
+	if (dst->damage) {
+		for (i = 0; i < numVertices; i++) {
+			_gfxDamage(dst, (int)floor(vertices[i].position.x), (int)floor(vertices[i].position.y),
+				(int)ceil(vertices[i].position.x) - 1, (int)ceil(vertices[i].position.y) - 1);
+		}
+	}
+	if (dst->batch) {
+		if (dst->batch->list) {
+			return _gfxListGeometry(dst->batch->list, texture, vertices, numVertices, indices, numIndices);
+		}
+		result |= gfxFlushBatch(dst->batch);
+	}
+	SDL2_GFX_STATS_ADD(dst->context, renderCalls, 1);
+	SDL2_GFX_STATS_ADD(dst->context, triangles, numIndices / 3);
+	result |= SDL_RenderGeometry(dst->renderer, texture, vertices, numVertices, indices, numIndices);
+
+	return result;
+}
+
+/*!
+\brief The structure collecting triangles for a single _gfxGeometry call.
+
+The vertex and index arrays are the geometry scratch buffers of the context.
+*/
+typedef struct {
+	gfxContext *context;
+	SDL_Vertex *vertices;
+	int numVertices;
+	int *indices;
+	int numIndices;
+} SDL2_gfxGeometry;
+
+/*!
+\brief Internal function to start collecting triangles.
+
+\param geometry The geometry to initialize.
+\param dst The target the triangles will be drawn on.
+*/
+static void _gfxBeginGeometry(SDL2_gfxGeometry *geometry, SDL2_gfxTarget *dst)
+{
+	geometry->context = dst->context;
+	geometry->vertices = NULL;
+	geometry->numVertices = 0;
+	geometry->indices = NULL;
+	geometry->numIndices = 0;
+}
+
+/*!
+\brief Internal function to reserve room for more vertices and indices.
+
+\param geometry The geometry to grow.
+\param numVertices Number of vertices to add.
+\param numIndices Number of indices to add.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxReserveGeometry(SDL2_gfxGeometry *geometry, int numVertices, int numIndices)
+{
+	geometry->vertices = (SDL_Vertex *)_gfxScratch(&geometry->context->geometry, (geometry->numVertices + numVertices) * sizeof(SDL_Vertex));
+	geometry->indices = (int *)_gfxScratch(&geometry->context->indices, (geometry->numIndices + numIndices) * sizeof(int));
+	if ((geometry->vertices == NULL) || (geometry->indices == NULL)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add a vertex to the geometry. Room must have been reserved.
+
+\param geometry The geometry to add to.
+\param x X coordinate of the vertex.
+\param y Y coordinate of the vertex.
+\param u Horizontal texture coordinate of the vertex.
+\param v Vertical texture coordinate of the vertex.
+\param color The color of the vertex.
+
+\returns Returns the index of the vertex.
+*/
+static int _gfxGeometryVertex(SDL2_gfxGeometry *geometry, float x, float y, float u, float v, SDL_Color color)
+{
+	SDL_Vertex *vertex = &geometry->vertices[geometry->numVertices];
+
+	vertex->position.x = x;
+	vertex->position.y = y;
+	vertex->tex_coord.x = u;
+	vertex->tex_coord.y = v;
+	vertex->color = color;
+
+	return geometry->numVertices++;
+}
+
+/*!
+\brief Internal function to add a triangle to the geometry. Room must have been reserved.
+
+\param geometry The geometry to add to.
+\param a Index of the first vertex.
+\param b Index of the second vertex.
+\param c Index of the third vertex.
+*/
+static void _gfxGeometryTriangle(SDL2_gfxGeometry *geometry, int a, int b, int c)
+{
+	int *index = &geometry->indices[geometry->numIndices];
+
+	index[0] = a;
+	index[1] = b;
+	index[2] = c;
+	geometry->numIndices += 3;
+}
+#endif
+
+/* ---- Display list */
+
+/*!
+\brief Internal function to grow the bounds of a display list.
+
+\param list The display list.
+\param x1 X coordinate of the left edge of the recorded area.
+\param y1 Y coordinate of the top edge of the recorded area.
+\param x2 X coordinate of the right edge of the recorded area (inclusive).
+\param y2 Y coordinate of the bottom edge of the recorded area (inclusive).
+*/
+static void _gfxListBounds(gfxDisplayList *list, int x1, int y1, int x2, int y2)
+{
+	if (list->empty) {
+		list->x1 = x1;
+		list->y1 = y1;
+		list->x2 = x2;
+		list->y2 = y2;
+		list->empty = 0;
+		return;
+	}
+
+	list->x1 = SDL_min(list->x1, x1);
+	list->y1 = SDL_min(list->y1, y1);
+	list->x2 = SDL_max(list->x2, x2);
+	list->y2 = SDL_max(list->y2, y2);
+}
+
+/*!
+\brief Internal function to add a draw call to a display list.
+
+\param list The display list.
+\param type The type of the draw call.
+
+\returns Returns the new draw call or NULL on failure.
+*/
+static SDL2_gfxListOp *_gfxListOp(gfxDisplayList *list, int type)
+{
+	SDL2_gfxListOp *op;
+
+	if (_gfxBatchGrow((void **)&list->ops, list->numOps, &list->maxOps, 1, sizeof(SDL2_gfxListOp))) {
+		return NULL;
+	}
+	op = &list->ops[list->numOps++];
+	memset(op, 0, sizeof(SDL2_gfxListOp));
+	op->type = type;
+
+	return op;
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief Internal function to get the geometry draw call that triangles are appended to.
+
+The last draw call of the list is continued if it is geometry with the same texture.
+Untextured triangles are drawn blended if any of them are blended; this does not
+change the opaque ones.
+
+\param list The display list.
+\param texture The texture of the triangles or NULL.
+\param blend The draw blend mode of untextured triangles.
+\param numVertices Number of vertices to reserve.
+\param numIndices Number of indices to reserve.
+
+\returns Returns the draw call or NULL on failure.
+*/
+static SDL2_gfxListOp *_gfxListGeometryOp(gfxDisplayList *list, SDL_Texture *texture, SDL_BlendMode blend, int numVertices, int numIndices)
+{
+	SDL2_gfxListOp *op = NULL;
+
+	if ((_gfxBatchGrow((void **)&list->vertices, list->numVertices, &list->maxVertices, numVertices, sizeof(SDL_Vertex))) ||
+		(_gfxBatchGrow((void **)&list->indices, list->numIndices, &list->maxIndices, numIndices, sizeof(int)))) {
+		return NULL;
+	}
+
+	if (list->numOps > 0) {
+		op = &list->ops[list->numOps - 1];
+		if ((op->type != SDL2_GFX_LIST_GEOMETRY) || (op->texture != texture)) {
+			op = NULL;
+		}
+	}
+	if (op == NULL) {
+		op = _gfxListOp(list, SDL2_GFX_LIST_GEOMETRY);
+		if (op == NULL) {
+			return NULL;
+		}
+		op->texture = texture;
+		op->blend = SDL_BLENDMODE_NONE;
+		op->first = list->numVertices;
+		op->firstIndex = list->numIndices;
+	}
+	if ((texture == NULL) && (blend != SDL_BLENDMODE_NONE)) {
+		op->blend = blend;
+	}
+
+	return op;
+}
+
+/*!
+\brief Internal function to append a rectangle as two triangles to a geometry draw call. Room must have been reserved.
+
+\param list The display list.
+\param op The geometry draw call, which must be the last one of the list.
+\param x X coordinate of the upper left corner of the rectangle.
+\param y Y coordinate of the upper left corner of the rectangle.
+\param w Width of the rectangle.
+\param h Height of the rectangle.
+\param u1 Horizontal texture coordinate of the left edge.
+\param v1 Vertical texture coordinate of the top edge.
+\param u2 Horizontal texture coordinate of the right edge.
+\param v2 Vertical texture coordinate of the bottom edge.
+\param color The color of the rectangle.
+*/
+static void _gfxListQuad(gfxDisplayList *list, SDL2_gfxListOp *op, int x, int y, int w, int h,
+	float u1, float v1, float u2, float v2, SDL_Color color)
+{
+	SDL_Vertex *vertex = &list->vertices[list->numVertices];
+	int *index = &list->indices[list->numIndices];
+	int v = list->numVertices - op->first;
+	int i;
+
+	vertex[0].position.x = (float)x;
+	vertex[0].position.y = (float)y;
+	vertex[0].tex_coord.x = u1;
+	vertex[0].tex_coord.y = v1;
+	vertex[1].position.x = (float)(x + w);
+	vertex[1].position.y = (float)y;
+	vertex[1].tex_coord.x = u2;
+	vertex[1].tex_coord.y = v1;
+	vertex[2].position.x = (float)(x + w);
+	vertex[2].position.y = (float)(y + h);
+	vertex[2].tex_coord.x = u2;
+	vertex[2].tex_coord.y = v2;
+	vertex[3].position.x = (float)x;
+	vertex[3].position.y = (float)(y + h);
+	vertex[3].tex_coord.x = u1;
+	vertex[3].tex_coord.y = v2;
+	for (i = 0; i < 4; i++) {
+		vertex[i].color = color;
+	}
+	index[0] = v;
+	index[1] = v + 1;
+	index[2] = v + 2;
+	index[3] = v;
+	index[4] = v + 2;
+	index[5] = v + 3;
+
+	list->numVertices += 4;
+	list->numIndices += 6;
+	op->count += 4;
+	op->numIndices += 6;
+}
+#endif
+
+/*!
+\brief Internal function to turn the runs recorded in the batch of a display list into draw calls.
+
+Called instead of drawing whenever the batch of a display list is flushed, i.e. before
+geometry or a texture copy is recorded, so the recording order is kept.
+
+\param list The display list.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCutDisplayList(gfxDisplayList *list)
+{
+	gfxBatch *batch = &list->batch;
+	SDL2_gfxBatchRun *run;
+	SDL2_gfxBatchStrip *strip;
+	SDL2_gfxListOp *op;
+	SDL_Rect *rect;
+	SDL_Point *point;
+	int i, j, k;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL_Color color;
+	int quads;
+#endif
+
+	for (i = batch->numSealedRuns; i < batch->numRuns; i++) {
+		run = &batch->runs[i];
+		for (j = run->firstRect; j < run->firstRect + run->numRects; j++) {
+			rect = &batch->rects[j];
+			_gfxListBounds(list, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1);
+		}
+		for (j = run->firstPoint; j < run->firstPoint + run->numPoints; j++) {
+			point = &batch->points[j];
+			_gfxListBounds(list, point->x, point->y, point->x, point->y);
+		}
+		for (j = run->firstOutline; j < run->firstOutline + run->numOutlines; j++) {
+			rect = &batch->outlines[j];
+			_gfxListBounds(list, rect->x, rect->y, rect->x + rect->w - 1, rect->y + rect->h - 1);
+		}
+		for (j = run->firstStrip; j < run->firstStrip + run->numStrips; j++) {
+			strip = &batch->strips[j];
+			for (k = strip->firstPoint; k < strip->firstPoint + strip->numPoints; k++) {
+				point = &batch->lines[k];
+				_gfxListBounds(list, point->x, point->y, point->x, point->y);
+			}
+		}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+		/*
+		* Pixels, rectangles and the edges of outlines become triangles, in the order the batch draws them
+		*/
+		quads = run->numRects + run->numPoints + 4 * run->numOutlines;
+		if (quads > 0) {
+			op = _gfxListGeometryOp(list, NULL, (run->a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND, 4 * quads, 6 * quads);
+			if (op == NULL) {
+				return -1;
+			}
+			color.r = run->r;
+			color.g = run->g;
+			color.b = run->b;
+			color.a = run->a;
+			for (j = run->firstRect; j < run->firstRect + run->numRects; j++) {
+				rect = &batch->rects[j];
+				_gfxListQuad(list, op, rect->x, rect->y, rect->w, rect->h, 0.0f, 0.0f, 0.0f, 0.0f, color);
+			}
+			for (j = run->firstPoint; j < run->firstPoint + run->numPoints; j++) {
+				point = &batch->points[j];
+				_gfxListQuad(list, op, point->x, point->y, 1, 1, 0.0f, 0.0f, 0.0f, 0.0f, color);
+			}
+			for (j = run->firstOutline; j < run->firstOutline + run->numOutlines; j++) {
+				rect = &batch->outlines[j];
+				if ((rect->w <= 0) || (rect->h <= 0)) {
+					continue;
+				}
+				_gfxListQuad(list, op, rect->x, rect->y, rect->w, 1, 0.0f, 0.0f, 0.0f, 0.0f, color);
+				if (rect->h > 1) {
+					_gfxListQuad(list, op, rect->x, rect->y + rect->h - 1, rect->w, 1, 0.0f, 0.0f, 0.0f, 0.0f, color);
+				}
+				if (rect->h > 2) {
+					_gfxListQuad(list, op, rect->x, rect->y + 1, 1, rect->h - 2, 0.0f, 0.0f, 0.0f, 0.0f, color);
+					if (rect->w > 1) {
+						_gfxListQuad(list, op, rect->x + rect->w - 1, rect->y + 1, 1, rect->h - 2, 0.0f, 0.0f, 0.0f, 0.0f, color);
+					}
+				}
+			}
+		}
+
+		/*
+		* Only lines stay in the batch
+		*/
+		if (run->numStrips == 0) {
+			continue;
+		}
+#endif
+		op = (list->numOps > 0) ? &list->ops[list->numOps - 1] : NULL;
+		if ((op == NULL) || (op->type != SDL2_GFX_LIST_RUNS) || (op->first + op->count != i)) {
+			op = _gfxListOp(list, SDL2_GFX_LIST_RUNS);
+			if (op == NULL) {
+				return -1;
+			}
+			op->first = i;
+		}
+		op->count++;
+	}
+	batch->numSealedRuns = batch->numRuns;
+
+	return 0;
+}
+
+/*!
+\brief Internal function to record a texture copy into a display list.
+
+With SDL 2.0.18 or newer the copy becomes two textured triangles colored with the
+current color and alpha modulation of the texture.
+
+\param list The display list.
+\param texture The texture to copy.
+\param srcrect The source rectangle in the texture or NULL for the whole texture.
+\param dstrect The destination rectangle.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxListCopy(gfxDisplayList *list, SDL_Texture *texture, const SDL_Rect *srcrect, const SDL_Rect *dstrect)
+{
+	SDL2_gfxListOp *op;
+	SDL_Rect src;
+	Uint8 r, g, b, a;
+	int w, h;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL_Color color;
+#endif
+
+	if (dstrect == NULL) {
+		return SDL_SetError("Cannot record a texture copy without destination rectangle");
+	}
+	if ((SDL_QueryTexture(texture, NULL, NULL, &w, &h)) ||
+		(SDL_GetTextureColorMod(texture, &r, &g, &b)) ||
+		(SDL_GetTextureAlphaMod(texture, &a))) {
+		return -1;
+	}
+	if (srcrect != NULL) {
+		src = *srcrect;
+	} else {
+		src.x = 0;
+		src.y = 0;
+		src.w = w;
+		src.h = h;
+	}
+
+	if (_gfxCutDisplayList(list)) {
+		return -1;
+	}
+	_gfxListBounds(list, dstrect->x, dstrect->y, dstrect->x + dstrect->w - 1, dstrect->y + dstrect->h - 1);
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	op = _gfxListGeometryOp(list, texture, SDL_BLENDMODE_NONE, 4, 6);
+	if (op == NULL) {
+		return -1;
+	}
+	color.r = r;
+	color.g = g;
+	color.b = b;
+	color.a = a;
+	_gfxListQuad(list, op, dstrect->x, dstrect->y, dstrect->w, dstrect->h,
+		(float)src.x / w, (float)src.y / h, (float)(src.x + src.w) / w, (float)(src.y + src.h) / h, color);
+#else
+	op = _gfxListOp(list, SDL2_GFX_LIST_COPY);
+	if (op == NULL) {
+		return -1;
+	}
+	op->texture = texture;
+	op->srcrect = src;
+	op->dstrect = *dstrect;
+	op->r = r;
+	op->g = g;
+	op->b = b;
+	op->a = a;
+#endif
+
+	return 0;
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief Internal function to record triangles into a display list.
+
+Untextured triangles are drawn with the blend mode currently set on the renderer.
+
+\param list The display list.
+\param texture The texture to map onto the triangles or NULL.
+\param vertices The vertices of the triangles.
+\param numVertices Number of vertices.
+\param indices The vertex indices of the triangles or NULL.
+\param numIndices Number of indices.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxListGeometry(gfxDisplayList *list, SDL_Texture *texture, const SDL_Vertex *vertices, int numVertices, const int *indices, int numIndices)
+{
+	SDL2_gfxListOp *op;
+	SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+	int i, v;
+
+	if ((texture == NULL) && (SDL_GetRenderDrawBlendMode(list->batch.renderer, &blend))) {
+		return -1;
+	}
+	if (_gfxCutDisplayList(list)) {
+		return -1;
+	}
+	if (indices == NULL) {
+		numIndices = numVertices;
+	}
+	op = _gfxListGeometryOp(list, texture, blend, numVertices, numIndices);
+	if (op == NULL) {
+		return -1;
+	}
+
+	v = list->numVertices - op->first;
+	memcpy(&list->vertices[list->numVertices], vertices, numVertices * sizeof(SDL_Vertex));
+	for (i = 0; i < numIndices; i++) {
+		list->indices[list->numIndices + i] = v + ((indices != NULL) ? indices[i] : i);
+	}
+	for (i = 0; i < numVertices; i++) {
+		_gfxListBounds(list, (int)floor(vertices[i].position.x), (int)floor(vertices[i].position.y),
+			(int)ceil(vertices[i].position.x), (int)ceil(vertices[i].position.y));
+	}
+	list->numVertices += numVertices;
+	list->numIndices += numIndices;
+	op->count += numVertices;
+	op->numIndices += numIndices;
+
+	return 0;
+}
+#endif
+
+/*!
+\brief Internal function to get the texture of a surface for the textured polygons of a display list.
+
+The surface is uploaded once per recording. The texture belongs to the list, so unlike a
+texture of the texture cache it cannot be evicted before the list is drawn.
+
+\param list The display list being recorded.
+\param surface The surface to get the texture of.
+
+\returns Returns the texture or NULL on failure.
+*/
+static SDL_Texture *_gfxListTexture(gfxDisplayList *list, SDL_Surface *surface)
+{
+	SDL_Texture *texture;
+	int i;
+
+	for (i = 0; i < list->numTextures; i++) {
+		if (list->textures[i].surface == surface) {
+			return list->textures[i].texture;
+		}
+	}
+
+	if (_gfxBatchGrow((void **)&list->textures, list->numTextures, &list->maxTextures, 1, sizeof(SDL2_gfxListTexture))) {
+		return NULL;
+	}
+	texture = SDL_CreateTextureFromSurface(list->batch.renderer, surface);
+	if (texture == NULL) {
+		return NULL;
+	}
+	SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+	list->textures[list->numTextures].surface = surface;
+	list->textures[list->numTextures].texture = texture;
+	list->numTextures++;
+
+	return texture;
+}
+
+/*!
+\brief Internal function to destroy the textures of a display list.
+
+\param list The display list.
+*/
+static void _gfxClearListTextures(gfxDisplayList *list)
+{
+	int i;
+
+	for (i = 0; i < list->numTextures; i++) {
+		SDL_DestroyTexture(list->textures[i].texture);
+	}
+	list->numTextures = 0;
+}
+
+/*!
+\brief Create a display list which records primitives drawn on a renderer.
+
+The primitives recorded between gfxBeginDisplayList() and gfxEndDisplayList() are kept
+tessellated and can be drawn any number of times and at any position with
+gfxDrawDisplayList(). With SDL 2.0.18 or newer pixels, spans, boxes, rectangles,
+meshes and text are kept as colored triangles and drawn with one SDL_RenderGeometry
+call per texture, so a list of untextured shapes is one call plus one
+SDL_RenderDrawLines call per recorded line or outline. Otherwise the list is drawn
+like a batch.
+
+\param renderer The renderer the display list draws on.
+
+\returns Returns the new display list or NULL on failure.
+*/
+gfxDisplayList *gfxCreateDisplayList(SDL_Renderer *renderer)
+{
+	gfxDisplayList *list;
+
+	if (renderer == NULL) {
+		return NULL;
+	}
+
+	list = (gfxDisplayList *)calloc(1, sizeof(gfxDisplayList));
+	if (list == NULL) {
+		return NULL;
+	}
+	list->batch.renderer = renderer;
+	list->batch.list = list;
+	list->empty = 1;
+
+	return list;
+}
+
+/*!
+\brief Start recording primitives into a display list, replacing its content.
+
+The list is activated in the current context like a batch (see gfxBeginBatch) and fails
+to start if a batch or display list is already active for its renderer. Primitives drawn
+with an explicit color are recorded, not drawn. Primitives are not clipped to the visible
+area when recorded, so the list can be drawn anywhere. The exceptions are pixel, line and
+polygon, which use the color currently set on the renderer: they are never recorded and
+draw immediately. Textured polygons upload their surface into a texture owned by the list,
+so later changes to the surface are not drawn until the list is recorded again. Textures
+passed to texturedPolygonTexture and fonts used by recorded primitives must stay valid as
+long as the list is drawn.
+
+\param list The display list to record into.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxBeginDisplayList(gfxDisplayList *list)
+{
+	gfxBatch *batch;
+
+	if (list == NULL) {
+		return -1;
+	}
+	batch = &list->batch;
+	if (batch->active) {
+		return 0;
+	}
+
+	batch->numRuns = 0;
+	batch->numSealedRuns = 0;
+	batch->numPoints = 0;
+	batch->numRects = 0;
+	batch->numOutlines = 0;
+	batch->numStrips = 0;
+	batch->numLines = 0;
+	list->numOps = 0;
+	_gfxClearListTextures(list);
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	list->numVertices = 0;
+	list->numIndices = 0;
+#endif
+	list->empty = 1;
+
+	return gfxBeginBatch(batch);
+}
+
+/*!
+\brief Stop recording primitives into a display list.
+
+\param list The display list.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxEndDisplayList(gfxDisplayList *list)
+{
+	if (list == NULL) {
+		return -1;
+	}
+
+	return gfxEndBatch(&list->batch);
+}
+
+/*!
+\brief Internal function to draw the runs of a display list, translated.
+
+With SDL 2.0.18 or newer only the lines of the runs are drawn, since everything else
+has been turned into triangles.
+
+\param dst The target to draw on.
+\param list The display list.
+\param op The draw call selecting the runs.
+\param x Horizontal translation.
+\param y Vertical translation.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawListRuns(SDL2_gfxTarget *dst, gfxDisplayList *list, const SDL2_gfxListOp *op, int x, int y)
+{
+	int result = 0;
+	int i, j, k;
+	gfxBatch *batch = &list->batch;
+	SDL2_gfxBatchRun *run;
+	SDL2_gfxBatchStrip *strip;
+	SDL_Point *points;
+#ifndef SDL2_GFX_HAVE_GEOMETRY
+	SDL_Rect *rects;
+	SDL_Rect rect;
+#endif
+
+	for (i = op->first; i < op->first + op->count; i++) {
+		run = &batch->runs[i];
+		result |= _gfxColor(dst, run->r, run->g, run->b, run->a);
+#ifndef SDL2_GFX_HAVE_GEOMETRY
+		if (run->numRects > 0) {
+			rects = (SDL_Rect *)_gfxScratch(&dst->context->spans, run->numRects * sizeof(SDL_Rect));
+			if (rects == NULL) {
+				return -1;
+			}
+			for (k = 0; k < run->numRects; k++) {
+				rects[k] = batch->rects[run->firstRect + k];
+				rects[k].x += x;
+				rects[k].y += y;
+			}
+			result |= _gfxFillRects(dst, rects, run->numRects);
+		}
+		if (run->numPoints > 0) {
+			points = (SDL_Point *)_gfxScratch(&dst->context->points, run->numPoints * sizeof(SDL_Point));
+			if (points == NULL) {
+				return -1;
+			}
+			for (k = 0; k < run->numPoints; k++) {
+				points[k].x = batch->points[run->firstPoint + k].x + x;
+				points[k].y = batch->points[run->firstPoint + k].y + y;
+			}
+			result |= _gfxPixels(dst, points, run->numPoints);
+		}
+		for (k = run->firstOutline; k < run->firstOutline + run->numOutlines; k++) {
+			rect = batch->outlines[k];
+			rect.x += x;
+			rect.y += y;
+			result |= _gfxDrawRect(dst, &rect);
+		}
+#endif
+		for (j = run->firstStrip; j < run->firstStrip + run->numStrips; j++) {
+			strip = &batch->strips[j];
+			points = (SDL_Point *)_gfxScratch(&dst->context->points, strip->numPoints * sizeof(SDL_Point));
+			if (points == NULL) {
+				return -1;
+			}
+			for (k = 0; k < strip->numPoints; k++) {
+				points[k].x = batch->lines[strip->firstPoint + k].x + x;
+				points[k].y = batch->lines[strip->firstPoint + k].y + y;
+			}
+			result |= _gfxLines(dst, points, strip->numPoints);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw a display list, translated.
+
+\param dst The target to draw on.
+\param list The display list.
+\param x Horizontal translation.
+\param y Vertical translation.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawDisplayList(SDL2_gfxTarget *dst, gfxDisplayList *list, int x, int y)
+{
+	int result = 0;
+	int i;
+	SDL2_gfxListOp *op;
+	SDL2_gfxDamage *damage;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL_Vertex *vertices;
+	int k;
+#else
+	SDL_Rect rect;
+#endif
+
+	if ((list->empty) || (_gfxCull(dst, list->x1 + x, list->y1 + y, list->x2 + x, list->y2 + y))) {
+		return 0;
+	}
+
+	/*
+	* The bounds of the list are its damage, so the draw calls need not be tracked
+	*/
+	_gfxDamage(dst, list->x1 + x, list->y1 + y, list->x2 + x, list->y2 + y);
+	damage = dst->damage;
+	dst->damage = NULL;
+
+	for (i = 0; i < list->numOps; i++) {
+		op = &list->ops[i];
+		switch (op->type) {
+		case SDL2_GFX_LIST_RUNS:
+			result |= _gfxDrawListRuns(dst, list, op, x, y);
+			break;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+		case SDL2_GFX_LIST_GEOMETRY:
+			vertices = &list->vertices[op->first];
+			if ((x != 0) || (y != 0)) {
+				vertices = (SDL_Vertex *)_gfxScratch(&dst->context->geometry, op->count * sizeof(SDL_Vertex));
+				if (vertices == NULL) {
+					return -1;
+				}
+				for (k = 0; k < op->count; k++) {
+					vertices[k] = list->vertices[op->first + k];
+					vertices[k].position.x += (float)x;
+					vertices[k].position.y += (float)y;
+				}
+			}
+			if (op->texture == NULL) {
+				/* Flush first, so the batch does not change the blend mode set here */
+				if (dst->batch) {
+					result |= gfxFlushBatch(dst->batch);
+				}
+				result |= _gfxSetBlendMode(dst->renderer, dst->state, op->blend);
+			}
+			result |= _gfxGeometry(dst, op->texture, vertices, op->count, &list->indices[op->firstIndex], op->numIndices);
+			break;
+#else
+		case SDL2_GFX_LIST_COPY:
+			rect = op->dstrect;
+			rect.x += x;
+			rect.y += y;
+			result |= SDL_SetTextureColorMod(op->texture, op->r, op->g, op->b);
+			result |= SDL_SetTextureAlphaMod(op->texture, op->a);
+			result |= _gfxCopy(dst, op->texture, &op->srcrect, &rect);
+			break;
+#endif
+		}
+	}
+	dst->damage = damage;
+
+	return result;
+}
+
+/*!
+\brief Draw a display list.
+
+The list is drawn through the current batch or display list of its renderer, if one is active.
+
+\param list The display list to draw.
+\param x Horizontal offset added to all recorded coordinates.
+\param y Vertical offset added to all recorded coordinates.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxDrawDisplayList(gfxDisplayList *list, int x, int y)
+{
+	SDL2_gfxTarget dst;
+
+	if (list == NULL) {
+		return -1;
+	}
+	if (list->batch.active) {
+		return SDL_SetError("Cannot draw a display list while recording it");
+	}
+
+	_gfxTarget(&dst, list->batch.renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BATCH, _gfxDrawDisplayList(&dst, list, x, y));
+}
+
+/*!
+\brief Stop recording if required and free a display list.
+
+\param list The display list to free.
+*/
+void gfxDestroyDisplayList(gfxDisplayList *list)
+{
+	if (list == NULL) {
+		return;
+	}
+
+	gfxEndBatch(&list->batch);
+	free(list->batch.runs);
+	free(list->batch.points);
+	free(list->batch.rects);
+	free(list->batch.outlines);
+	free(list->batch.strips);
+	free(list->batch.lines);
+	free(list->ops);
+	_gfxClearListTextures(list);
+	free(list->textures);
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	free(list->vertices);
+	free(list->indices);
+#endif
+	free(list);
+}
+
+/* ---- Mesh */
+
+/*!
+\brief Internal callback used by the scanline fillers to draw one span.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data User data passed through from _gfxFillPolygonSpans() or _gfxFillMeshTriangle().
+
+\returns Returns 0 on success, -1 on failure.
+*/
+typedef int (*SDL2_gfxSpanFunc)(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data);
+
+/*!
+\brief A list of triangles of a single color in the scratch memory of a context.
+
+Points are x,y pairs with pixel centers at +0.5; a mesh covers the pixels whose
+center lies inside one of its triangles.
+*/
+typedef struct {
+	gfxContext *context;
+	float *points;
+	int numPoints;
+	int *indices;
+	int numIndices;
+} SDL2_gfxMesh;
+
+/*!
+\brief Internal function to start an empty mesh.
+
+\param mesh The mesh to initialize.
+\param dst The target the mesh will be drawn on.
+*/
+static void _gfxBeginMesh(SDL2_gfxMesh *mesh, SDL2_gfxTarget *dst)
+{
+	mesh->context = dst->context;
+	mesh->points = NULL;
+	mesh->numPoints = 0;
+	mesh->indices = NULL;
+	mesh->numIndices = 0;
+}
+
+/*!
+\brief Internal function to reserve room for more points and indices in a mesh.
+
+\param mesh The mesh to grow.
+\param numPoints Number of points to add.
+\param numIndices Number of indices to add.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxReserveMesh(SDL2_gfxMesh *mesh, int numPoints, int numIndices)
+{
+	mesh->points = (float *)_gfxScratch(&mesh->context->vertices, (mesh->numPoints + numPoints) * 2 * sizeof(float));
+	mesh->indices = (int *)_gfxScratch(&mesh->context->polyInts, (mesh->numIndices + numIndices) * sizeof(int));
+	if ((mesh->points == NULL) || (mesh->indices == NULL)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add a point to a mesh. Room must have been reserved.
+
+\param mesh The mesh to add to.
+\param x X coordinate of the point.
+\param y Y coordinate of the point.
+
+\returns Returns the index of the point.
+*/
+static int _gfxMeshPoint(SDL2_gfxMesh *mesh, double x, double y)
+{
+	mesh->points[2 * mesh->numPoints] = (float)x;
+	mesh->points[2 * mesh->numPoints + 1] = (float)y;
+
+	return mesh->numPoints++;
+}
+
+/*!
+\brief Internal function to add a triangle to a mesh. Room must have been reserved.
+
+\param mesh The mesh to add to.
+\param a Index of the first point.
+\param b Index of the second point.
+\param c Index of the third point.
+*/
+static void _gfxMeshTriangle(SDL2_gfxMesh *mesh, int a, int b, int c)
+{
+	int *index = &mesh->indices[mesh->numIndices];
+
+	index[0] = a;
+	index[1] = b;
+	index[2] = c;
+	mesh->numIndices += 3;
+}
+
+/*!
+\brief Internal function to calculate the X coordinate of an edge at a given Y coordinate.
+
+\param p The upper point of the edge.
+\param q The lower point of the edge.
+\param y The Y coordinate, between the Y coordinates of the points.
+
+\returns Returns the X coordinate.
+*/
+static double _gfxMeshEdgeX(const float *p, const float *q, double y)
+{
+	return p[0] + (q[0] - p[0]) * (y - p[1]) / (q[1] - p[1]);
+}
+
+/*!
+\brief Internal function to split a triangle into horizontal spans.
+
+Pixels are filled when their center is inside the triangle; centers on a left or top
+edge are inside, on a right or bottom edge outside, so triangles sharing an edge
+never draw a pixel twice.
+
+\param dst The target to draw on.
+\param a The first point as x,y pair.
+\param b The second point as x,y pair.
+\param c The third point as x,y pair.
+\param span The callback drawing each span.
+\param data User data passed to the callback.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillMeshTriangle(SDL2_gfxTarget *dst, const float *a, const float *b, const float *c, SDL2_gfxSpanFunc span, void *data)
+{
+	int result = 0;
+	const float *p0 = a, *p1 = b, *p2 = c, *t;
+	int y, ystart, yend, xstart, xend;
+	double yc, xa, xb;
+
+	/*
+	* Sort points by Y 
+	*/
+	if (p1[1] < p0[1]) {
+		t = p0; p0 = p1; p1 = t;
+	}
+	if (p2[1] < p1[1]) {
+		t = p1; p1 = p2; p2 = t;
+	}
+	if (p1[1] < p0[1]) {
+		t = p0; p0 = p1; p1 = t;
+	}
+
+	ystart = (int)SDL_ceil(p0[1] - 0.5);
+	yend = (int)SDL_ceil(p2[1] - 0.5);
+	for (y = ystart; y < yend; y++) {
+		yc = y + 0.5;
+		xa = _gfxMeshEdgeX(p0, p2, yc);
+		if (yc < p1[1]) {
+			xb = _gfxMeshEdgeX(p0, p1, yc);
+		} else {
+			xb = _gfxMeshEdgeX(p1, p2, yc);
+		}
+		xstart = (int)SDL_ceil(SDL_min(xa, xb) - 0.5);
+		xend = (int)SDL_ceil(SDL_max(xa, xb) - 0.5) - 1;
+		if (xstart <= xend) {
+			result |= span(dst, xstart, xend, y, data);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal span callback drawing a mesh row as a horizontal line in the current color.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data Unused.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxMeshSpan(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data)
+{
+	return _gfxHline(dst, (Sint16)xa, (Sint16)xb, (Sint16)y);
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief The state of the span callback collecting mesh rows as geometry.
+*/
+typedef struct {
+	SDL2_gfxGeometry geometry;
+	SDL_Color color;
+} SDL2_gfxMeshGeometry;
+
+/*!
+\brief Internal span callback adding a mesh row as a quad on the pixel edges to a geometry.
+
+The renderer then draws exactly the pixels of the row, whatever its fill rule for
+edges through pixel centers.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data The SDL2_gfxMeshGeometry to add to.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxMeshGeometrySpan(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data)
+{
+	SDL2_gfxMeshGeometry *mesh = (SDL2_gfxMeshGeometry *) data;
+	int first;
+
+	if (_gfxCull(dst, xa, y, xb, y)) {
+		return 0;
+	}
+	if (_gfxReserveGeometry(&mesh->geometry, 4, 6) < 0) {
+		return -1;
+	}
+	first = _gfxGeometryVertex(&mesh->geometry, (float)xa, (float)y, 0.0f, 0.0f, mesh->color);
+	_gfxGeometryVertex(&mesh->geometry, (float)(xb + 1), (float)y, 0.0f, 0.0f, mesh->color);
+	_gfxGeometryVertex(&mesh->geometry, (float)(xb + 1), (float)(y + 1), 0.0f, 0.0f, mesh->color);
+	_gfxGeometryVertex(&mesh->geometry, (float)xa, (float)(y + 1), 0.0f, 0.0f, mesh->color);
+	_gfxGeometryTriangle(&mesh->geometry, first, first + 1, first + 2);
+	_gfxGeometryTriangle(&mesh->geometry, first, first + 2, first + 3);
+
+	return 0;
+}
+#endif
+
+/*!
+\brief Internal function to draw a mesh in one color.
+
+The triangles are split into rows of pixels on every target. With SDL_RenderGeometry
+available the rows become quads on the pixel edges drawn with a single call, so
+renderers cover the same pixels as surfaces and older SDL versions, which draw the
+rows as horizontal lines.
+
+\param dst The target to draw on.
+\param mesh The mesh to draw.
+\param r The red value of the mesh.
+\param g The green value of the mesh.
+\param b The blue value of the mesh.
+\param a The alpha value of the mesh.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawMesh(SDL2_gfxTarget *dst, const SDL2_gfxMesh *mesh, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	int i;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL2_gfxMeshGeometry geometry;
+#endif
+
+	if (mesh->numIndices == 0) {
+		return 0;
+	}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	if (!dst->surface) {
+		/* Flush first, so the batch does not change the blend mode set here */
+		if (dst->batch) {
+			result |= gfxFlushBatch(dst->batch);
+		}
+		result |= _gfxSetBlendMode(dst->renderer, dst->state, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+
+		_gfxBeginGeometry(&geometry.geometry, dst);
+		geometry.color.r = r;
+		geometry.color.g = g;
+		geometry.color.b = b;
+		geometry.color.a = a;
+		for (i = 0; i < mesh->numIndices; i += 3) {
+			if (_gfxFillMeshTriangle(dst,
+				&mesh->points[2 * mesh->indices[i]],
+				&mesh->points[2 * mesh->indices[i + 1]],
+				&mesh->points[2 * mesh->indices[i + 2]], _gfxMeshGeometrySpan, &geometry)) {
+				return -1;
+			}
+		}
+		if (geometry.geometry.numVertices == 0) {
+			return result;
+		}
+
+		result |= _gfxGeometry(dst, NULL, geometry.geometry.vertices, geometry.geometry.numVertices,
+			geometry.geometry.indices, geometry.geometry.numIndices);
+		return result;
+	}
+#endif
+
+	result |= _gfxColor(dst, r, g, b, a);
+	for (i = 0; i < mesh->numIndices; i += 3) {
+		result |= _gfxFillMeshTriangle(dst,
+			&mesh->points[2 * mesh->indices[i]],
+			&mesh->points[2 * mesh->indices[i + 1]],
+			&mesh->points[2 * mesh->indices[i + 2]], _gfxMeshSpan, NULL);
+	}
+
+	return result;
+}
+
+/* ---- Spans */
+
+/*!
+\brief A list of rectangles of a single color in the scratch memory of a context.
+
+Filled shapes collect their horizontal spans (or columns) here and draw them
+with a single rectangle fill.
+*/
+typedef struct {
+	SDL2_gfxScratch *scratch;
+	SDL_Rect *rects;
+	int numRects;
+} SDL2_gfxSpans;
+
+/*!
+\brief Internal function to start an empty span list.
+
+\param spans The span list to initialize.
+\param dst The target whose context provides the memory.
+*/
+static void _gfxBeginSpans(SDL2_gfxSpans *spans, SDL2_gfxTarget *dst)
+{
+	spans->scratch = &dst->context->spans;
+	spans->rects = (SDL_Rect *)spans->scratch->data;
+	spans->numRects = 0;
+}
+
+/*!
+\brief Internal function to add a rectangle to a span list.
+
+\param spans The span list.
+\param x X coordinate of the upper left corner of the rectangle.
+\param y Y coordinate of the upper left corner of the rectangle.
+\param w Width of the rectangle.
+\param h Height of the rectangle.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSpanRect(SDL2_gfxSpans *spans, int x, int y, int w, int h)
+{
+	SDL_Rect *rect;
+
+	if ((w <= 0) || (h <= 0)) {
+		return 0;
+	}
+
+	spans->rects = (SDL_Rect *)_gfxScratch(spans->scratch, sizeof(SDL_Rect) * (spans->numRects + 1));
+	if (spans->rects == NULL) {
+		return -1;
+	}
+	rect = &spans->rects[spans->numRects++];
+	rect->x = x;
+	rect->y = y;
+	rect->w = w;
+	rect->h = h;
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add a horizontal span to a span list.
+
+\param spans The span list.
+\param x1 X coordinate of the first point of the span.
+\param x2 X coordinate of the second point of the span.
+\param y Y coordinate of the span.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxSpan(SDL2_gfxSpans *spans, int x1, int x2, int y)
+{
+	if (x1 > x2) {
+		return _gfxSpanRect(spans, x2, y, x1 - x2 + 1, 1);
+	}
+	return _gfxSpanRect(spans, x1, y, x2 - x1 + 1, 1);
+}
+
+/*!
+\brief Internal function used for sorting rectangles by Y, height and X coordinate.
+
+\param a The first rectangle.
+\param b The second rectangle.
+
+\returns Returns a negative, zero or positive value as for qsort.
+*/
+static int _gfxCompareSpan(const void *a, const void *b)
+{
+	const SDL_Rect *ra = (const SDL_Rect *)a;
+	const SDL_Rect *rb = (const SDL_Rect *)b;
+
+	if (ra->y != rb->y) {
+		return (ra->y < rb->y) ? -1 : 1;
+	}
+	if (ra->h != rb->h) {
+		return (ra->h < rb->h) ? -1 : 1;
+	}
+	if (ra->x != rb->x) {
+		return (ra->x < rb->x) ? -1 : 1;
+	}
+	return 0;
+}
+
+/*!
+\brief Internal function to merge the rectangles of a span list.
+
+Rectangles with the same vertical extent which overlap or touch are merged first, so no
+pixel of a row is blended twice; then rectangles which continue the previous one downwards
+are merged in a separate pass.
+
+\param spans The span list.
+*/
+static void _gfxMergeSpans(SDL2_gfxSpans *spans)
+{
+	SDL_Rect *rects = spans->rects;
+	SDL_Rect *last;
+	int i, n;
+
+	if (spans->numRects == 0) {
+		return;
+	}
+
+	qsort(rects, spans->numRects, sizeof(SDL_Rect), _gfxCompareSpan);
+
+	/*
+	* Merge overlapping or touching rectangles of a row 
+	*/
+	n = 1;
+	for (i = 1; i < spans->numRects; i++) {
+		last = &rects[n - 1];
+		if ((rects[i].y == last->y) && (rects[i].h == last->h) && (rects[i].x <= last->x + last->w)) {
+			if (rects[i].x + rects[i].w > last->x + last->w) {
+				last->w = rects[i].x + rects[i].w - last->x;
+			}
+		} else {
+			rects[n++] = rects[i];
+		}
+	}
+	spans->numRects = n;
+
+	/*
+	* Join rectangles continuing the previous one downwards 
+	*/
+	n = 1;
+	for (i = 1; i < spans->numRects; i++) {
+		last = &rects[n - 1];
+		if ((rects[i].x == last->x) && (rects[i].w == last->w) && (rects[i].y == last->y + last->h)) {
+			last->h += rects[i].h;
+		} else {
+			rects[n++] = rects[i];
+		}
+	}
+	spans->numRects = n;
+}
+
+/*!
+\brief Internal function to draw a span list in the current color.
+
+The merged rectangles are drawn with a single fill.
+
+\param dst The target to draw on.
+\param spans The span list.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawSpans(SDL2_gfxTarget *dst, SDL2_gfxSpans *spans)
+{
+	_gfxMergeSpans(spans);
+	if (spans->numRects == 0) {
+		return 0;
+	}
+
+	return _gfxFillRects(dst, spans->rects, spans->numRects);
+}
+
+/* ---- Coverage */
+
+/*!
+\brief Flag to collect anti-aliased pixels into per-alpha point sets.
+*/
+static int gfxPrimitivesAABatching = SDL2_GFX_AA_BATCHING;
+
+/*!
+\brief Sets how anti-aliased lines, circles, ellipses and polygons are drawn.
+
+When enabled, the pixels of an anti-aliased primitive are collected and drawn with one
+SDL_RenderDrawPoints call per alpha level instead of setting the color and drawing
+each pixel separately. The output is equivalent since all pixels use the same color.
+
+\param enable Set to 1 to enable or 0 to disable collecting of anti-aliased pixels.
+*/
+void gfxPrimitivesSetAABatching(int enable)
+{
+	gfxPrimitivesAABatching = enable;
+}
+
+/*!
+\brief Internal function to start collecting anti-aliased pixels on a target.
+
+Calls can be nested; pixels are drawn when the outermost collection ends.
+
+\param dst The target to collect pixels for.
+*/
+static void _gfxBeginCoverage(SDL2_gfxTarget *dst)
+{
+	if ((gfxPrimitivesAABatching) || (dst->coverage > 0)) {
+		dst->coverage++;
+	}
+}
+
+/*!
+\brief Internal function to collect a pixel with an alpha value.
+
+\param dst The target collecting pixels.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param a The alpha value of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCoverage(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Uint8 a)
+{
+	SDL2_gfxCoverage *coverage = &dst->context->coverage;
+	int newMax;
+	void *newPoints, *newSorted, *newAlphas;
+
+	if (!_gfxVisible(dst, x, y)) {
+		return 0;
+	}
+
+	if (coverage->numPoints == coverage->maxPoints) {
+		newMax = (coverage->maxPoints > 0) ? coverage->maxPoints * 2 : 1024;
+		newPoints = realloc(coverage->points, newMax * sizeof(SDL_Point));
+		if (newPoints == NULL) {
+			return -1;
+		}
+		coverage->points = (SDL_Point *)newPoints;
+		newSorted = realloc(coverage->sorted, newMax * sizeof(SDL_Point));
+		if (newSorted == NULL) {
+			return -1;
+		}
+		coverage->sorted = (SDL_Point *)newSorted;
+		newAlphas = realloc(coverage->alphas, newMax * sizeof(Uint8));
+		if (newAlphas == NULL) {
+			return -1;
+		}
+		coverage->alphas = (Uint8 *)newAlphas;
+		SDL2_GFX_STATS_ADD(dst->context, bytesAllocated, (newMax - coverage->maxPoints) * (2 * sizeof(SDL_Point) + sizeof(Uint8)));
+		coverage->maxPoints = newMax;
+	}
+
+	SDL2_GFX_STATS_ADD(dst->context, pixels, 1);
+	coverage->points[coverage->numPoints].x = x;
+	coverage->points[coverage->numPoints].y = y;
+	coverage->alphas[coverage->numPoints] = a;
+	coverage->numPoints++;
+
+	return 0;
+}
+
+/*!
+\brief Internal function to stop collecting anti-aliased pixels and draw them.
+
+The collected pixels are sorted by alpha value and each alpha level is drawn
+with a single color change and call.
+
+\param dst The target collecting pixels.
+\param r The red value of the pixels.
+\param g The green value of the pixels.
+\param b The blue value of the pixels.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxEndCoverage(SDL2_gfxTarget *dst, Uint8 r, Uint8 g, Uint8 b)
+{
+	SDL2_gfxCoverage *coverage = &dst->context->coverage;
+	int result = 0;
+	int i, level;
+	int start[257];
+
+	if (dst->coverage == 0) {
+		return 0;
+	}
+	dst->coverage--;
+	if ((dst->coverage > 0) || (coverage->numPoints == 0)) {
+		return 0;
+	}
+
+	/*
+	* Counting sort by alpha level 
+	*/
+	memset(start, 0, sizeof(start));
+	for (i = 0; i < coverage->numPoints; i++) {
+		start[coverage->alphas[i] + 1]++;
+	}
+	for (level = 1; level <= 256; level++) {
+		start[level] += start[level - 1];
+	}
+	for (i = 0; i < coverage->numPoints; i++) {
+		coverage->sorted[start[coverage->alphas[i]]++] = coverage->points[i];
+	}
+
+	/*
+	* Draw levels; start[level] now holds the end of each level 
+	*/
+	for (level = 0; level < 256; level++) {
+		i = (level > 0) ? start[level - 1] : 0;
+		if ((level > 0) && (start[level] > i)) {
+			result |= _gfxColor(dst, r, g, b, (Uint8)level);
+			result |= _gfxPixels(dst, &coverage->sorted[i], start[level] - i);
+		}
+	}
+
+	coverage->numPoints = 0;
+
+	return result;
+}
+
+/* ---- Shape cache */
+
+/*!
+\brief Default maximum number of tessellated shapes kept by the shape cache of a context.
+*/
+#ifndef SDL2_GFX_SHAPE_CACHE_SIZE
+#define SDL2_GFX_SHAPE_CACHE_SIZE 256
+#endif
+
+/*!
+\brief Shape types of the shape cache.
+*/
+#define SDL2_GFX_SHAPE_ELLIPSE			0
+#define SDL2_GFX_SHAPE_ARC				1
+#define SDL2_GFX_SHAPE_ROUNDED_RECTANGLE	2
+#define SDL2_GFX_SHAPE_ROUNDED_BOX		3
+#define SDL2_GFX_SHAPE_AA_ELLIPSE		4
+
+/*!
+\brief The pixels and rectangles of a shape while it is tessellated into scratch memory.
+
+The shape scratch buffers of the context are only used by tessellations, so a
+tessellated shape can be drawn several times.
+*/
+typedef struct {
+	gfxContext *context;
+	SDL_Point *points;
+	Uint16 *weights;
+	int numPoints;
+	int weighted;
+	SDL2_gfxSpans spans;
+} SDL2_gfxTessellation;
+
+/*!
+\brief Function tessellating the shape described by the key fields of a shape relative to its origin.
+*/
+typedef int (*SDL2_gfxTessellateFunc)(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key);
+
+/*!
+\brief Internal function to start an empty tessellation.
+
+\param tessellation The tessellation to initialize.
+\param dst The target whose context provides the memory.
+*/
+static void _gfxBeginTessellation(SDL2_gfxTessellation *tessellation, SDL2_gfxTarget *dst)
+{
+	tessellation->context = dst->context;
+	tessellation->points = (SDL_Point *)dst->context->shapePoints.data;
+	tessellation->weights = (Uint16 *)dst->context->shapeWeights.data;
+	tessellation->numPoints = 0;
+	tessellation->weighted = 0;
+	tessellation->spans.scratch = &dst->context->shapeRects;
+	tessellation->spans.rects = (SDL_Rect *)dst->context->shapeRects.data;
+	tessellation->spans.numRects = 0;
+}
+
+/*!
+\brief Internal function to add a pixel with an alpha weight to a tessellation.
+
+\param tessellation The tessellation.
+\param x X coordinate of the pixel.
+\param y Y coordinate of the pixel.
+\param weight The weight of the alpha value of the pixel (0 to 256).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellationWeightedPoint(SDL2_gfxTessellation *tessellation, int x, int y, Uint16 weight)
+{
+	tessellation->points = (SDL_Point *)_gfxScratch(&tessellation->context->shapePoints, sizeof(SDL_Point) * (tessellation->numPoints + 1));
+	tessellation->weights = (Uint16 *)_gfxScratch(&tessellation->context->shapeWeights, sizeof(Uint16) * (tessellation->numPoints + 1));
+	if ((tessellation->points == NULL) || (tessellation->weights == NULL)) {
+		return -1;
+	}
+	tessellation->points[tessellation->numPoints].x = x;
+	tessellation->points[tessellation->numPoints].y = y;
+	tessellation->weights[tessellation->numPoints] = weight;
+	tessellation->numPoints++;
+	if (weight != 256) {
+		tessellation->weighted = 1;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add a pixel to a tessellation.
+
+\param tessellation The tessellation.
+\param x X coordinate of the pixel.
+\param y Y coordinate of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellationPoint(SDL2_gfxTessellation *tessellation, int x, int y)
+{
+	return _gfxTessellationWeightedPoint(tessellation, x, y, 256);
+}
+
+/*!
+\brief Internal function to get the maximum number of shapes of a shape cache.
+
+\param cache The shape cache.
+
+\returns Returns the maximum number of shapes.
+*/
+static int _gfxShapeCacheSize(const SDL2_gfxShapeCache *cache)
+{
+	return (cache->sizeSet) ? cache->size : SDL2_GFX_SHAPE_CACHE_SIZE;
+}
+
+/*!
+\brief Internal function to free the least recently used shapes of a shape cache.
+
+\param cache The shape cache.
+\param keep Number of shapes to keep.
+*/
+static void _gfxTrimShapeCache(SDL2_gfxShapeCache *cache, int keep)
+{
+	SDL2_gfxShape **link, *shape;
+	int i;
+
+	link = &cache->shapes;
+	for (i = 0; (i < keep) && (*link != NULL); i++) {
+		link = &(*link)->next;
+	}
+	while (*link != NULL) {
+		shape = *link;
+		*link = shape->next;
+		free(shape);
+		cache->count--;
+	}
+}
+
+/*!
+\brief Internal function to store a copy of a tessellation in a shape cache.
+
+The shape, its pixels and its rectangles are a single allocation.
+
+\param cache The shape cache.
+\param key The shape type and parameters.
+\param tessellation The tessellated shape.
+*/
+static void _gfxStoreShape(SDL2_gfxShapeCache *cache, const SDL2_gfxShape *key, const SDL2_gfxTessellation *tessellation)
+{
+	SDL2_gfxShape *shape;
+
+	size_t numWeights = (tessellation->weighted) ? tessellation->numPoints : 0;
+
+	shape = (SDL2_gfxShape *)malloc(sizeof(SDL2_gfxShape) + tessellation->numPoints * sizeof(SDL_Point) +
+		tessellation->spans.numRects * sizeof(SDL_Rect) + numWeights * sizeof(Uint16));
+	if (shape == NULL) {
+		return;
+	}
+	SDL2_GFX_STATS_ADD(gfxGetContext(), bytesAllocated, sizeof(SDL2_gfxShape) + tessellation->numPoints * sizeof(SDL_Point) +
+		tessellation->spans.numRects * sizeof(SDL_Rect) + numWeights * sizeof(Uint16));
+	*shape = *key;
+	shape->points = (SDL_Point *)(shape + 1);
+	shape->numPoints = tessellation->numPoints;
+	shape->rects = (SDL_Rect *)(shape->points + shape->numPoints);
+	shape->numRects = tessellation->spans.numRects;
+	shape->weights = (numWeights > 0) ? (Uint16 *)(shape->rects + shape->numRects) : NULL;
+	if (shape->numPoints > 0) {
+		memcpy(shape->points, tessellation->points, shape->numPoints * sizeof(SDL_Point));
+	}
+	if (numWeights > 0) {
+		memcpy(shape->weights, tessellation->weights, numWeights * sizeof(Uint16));
+	}
+	if (shape->numRects > 0) {
+		memcpy(shape->rects, tessellation->spans.rects, shape->numRects * sizeof(SDL_Rect));
+	}
+
+	shape->next = cache->shapes;
+	cache->shapes = shape;
+	cache->count++;
+	_gfxTrimShapeCache(cache, _gfxShapeCacheSize(cache));
+}
+
+/*!
+\brief Internal function to get a tessellated shape from the shape cache, tessellating it on a miss.
+
+A shape which is not cached stays valid until the next tessellation in the same context.
+
+\param dst The target whose context tessellates and caches the shape.
+\param key The shape type and parameters.
+\param tessellate The function tessellating the shape relative to its origin.
+\param shape Returns the tessellated shape when it is not cached.
+
+\returns Returns the tessellated shape or NULL on failure.
+*/
+static const SDL2_gfxShape *_gfxGetShape(SDL2_gfxTarget *dst, const SDL2_gfxShape *key, SDL2_gfxTessellateFunc tessellate, SDL2_gfxShape *shape)
+{
+	SDL2_gfxShapeCache *cache = &dst->context->shapes;
+	SDL2_gfxShape **link, *cached;
+	SDL2_gfxTessellation tessellation;
+	int caching;
+
+	caching = (_gfxShapeCacheSize(cache) > 0);
+	if (caching) {
+		for (link = &cache->shapes; *link != NULL; link = &(*link)->next) {
+			cached = *link;
+			if ((cached->type == key->type) && (cached->rx == key->rx) && (cached->ry == key->ry) &&
+				(cached->start == key->start) && (cached->end == key->end) && (cached->filled == key->filled)) {
+				/* Move to front */
+				*link = cached->next;
+				cached->next = cache->shapes;
+				cache->shapes = cached;
+				cache->hits++;
+				return cached;
+			}
+		}
+		cache->misses++;
+	}
+
+	_gfxBeginTessellation(&tessellation, dst);
+	if (tessellate(&tessellation, key)) {
+		return NULL;
+	}
+	_gfxMergeSpans(&tessellation.spans);
+	if (caching) {
+		_gfxStoreShape(cache, key, &tessellation);
+	}
+
+	*shape = *key;
+	shape->points = tessellation.points;
+	shape->weights = (tessellation.weighted) ? tessellation.weights : NULL;
+	shape->numPoints = tessellation.numPoints;
+	shape->rects = tessellation.spans.rects;
+	shape->numRects = tessellation.spans.numRects;
+	shape->next = NULL;
+
+	return shape;
+}
+
+/*!
+\brief Internal function to draw a tessellated shape at an offset in the current color.
+
+Pixels and rectangles outside of the visible area are skipped.
+
+\param dst The target to draw on.
+\param shape The tessellated shape; its weights are ignored.
+\param x X offset.
+\param y Y offset.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawTessellated(SDL2_gfxTarget *dst, const SDL2_gfxShape *shape, Sint16 x, Sint16 y)
+{
+	int result = 0;
+	int i, n;
+	SDL_Point *p;
+	SDL_Rect *rect;
+
+	if (shape->numPoints > 0) {
+		p = (SDL_Point *)_gfxScratch(&dst->context->points, sizeof(SDL_Point) * shape->numPoints);
+		if (p == NULL) {
+			return -1;
+		}
+		for (i = 0, n = 0; i < shape->numPoints; i++) {
+			p[n].x = shape->points[i].x + x;
+			p[n].y = shape->points[i].y + y;
+			if (_gfxVisible(dst, p[n].x, p[n].y)) {
+				n++;
+			}
+		}
+		if (n > 0) {
+			result |= _gfxPixels(dst, p, n);
+		}
+	}
+
+	if (shape->numRects > 0) {
+		rect = (SDL_Rect *)_gfxScratch(&dst->context->spans, sizeof(SDL_Rect) * shape->numRects);
+		if (rect == NULL) {
+			return -1;
+		}
+		for (i = 0, n = 0; i < shape->numRects; i++) {
+			rect[n].x = shape->rects[i].x + x;
+			rect[n].y = shape->rects[i].y + y;
+			rect[n].w = shape->rects[i].w;
+			rect[n].h = shape->rects[i].h;
+			if (!_gfxCull(dst, rect[n].x, rect[n].y, rect[n].x + rect[n].w - 1, rect[n].y + rect[n].h - 1)) {
+				n++;
+			}
+		}
+		if (n > 0) {
+			result |= _gfxFillRects(dst, rect, n);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw the weighted pixels of a tessellated shape at an offset.
+
+The pixels are collected by alpha level like all anti-aliased pixels.
+
+\param dst The target to draw on.
+\param shape The tessellated shape; its rectangles are ignored.
+\param x X offset.
+\param y Y offset.
+\param r The red value of the shape.
+\param g The green value of the shape.
+\param b The blue value of the shape.
+\param a The alpha value of the shape; weighted per pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawWeighted(SDL2_gfxTarget *dst, const SDL2_gfxShape *shape, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	int i;
+	Uint8 alpha;
+
+	_gfxBeginCoverage(dst);
+	for (i = 0; i < shape->numPoints; i++) {
+		alpha = (shape->weights) ? (Uint8)((a * shape->weights[i]) >> 8) : a;
+		if (dst->coverage) {
+			result |= _gfxCoverage(dst, shape->points[i].x + x, shape->points[i].y + y, alpha);
+		} else {
+			result |= _gfxColor(dst, r, g, b, alpha);
+			result |= _gfxPixel(dst, shape->points[i].x + x, shape->points[i].y + y);
+		}
+	}
+	result |= _gfxEndCoverage(dst, r, g, b);
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw a shape in the current color, tessellating it unless it is cached.
+
+\param dst The target to draw on.
+\param key The shape type and parameters.
+\param x X coordinate of the origin of the shape.
+\param y Y coordinate of the origin of the shape.
+\param tessellate The function tessellating the shape relative to its origin.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawShape(SDL2_gfxTarget *dst, const SDL2_gfxShape *key, Sint16 x, Sint16 y, SDL2_gfxTessellateFunc tessellate)
+{
+	SDL2_gfxShape tessellated;
+	const SDL2_gfxShape *shape;
+
+	shape = _gfxGetShape(dst, key, tessellate, &tessellated);
+	if (shape == NULL) {
+		return -1;
+	}
+
+	return _gfxDrawTessellated(dst, shape, x, y);
+}
+
+/*!
+\brief Set the maximum number of tessellated shapes cached by the current context.
+
+Circles, ellipses, arcs, rounded rectangles and rounded boxes keep their pixels and spans
+for a radius, size and angle range in the cache and only translate them when drawn again.
+The default size is SDL2_GFX_SHAPE_CACHE_SIZE.
+
+\param size Maximum number of shapes; 0 disables the cache and frees the cached shapes.
+*/
+void gfxSetShapeCacheSize(int size)
+{
+	SDL2_gfxShapeCache *cache = &gfxGetContext()->shapes;
+
+	if (size < 0) {
+		size = 0;
+	}
+	cache->size = size;
+	cache->sizeSet = 1;
+	_gfxTrimShapeCache(cache, size);
+}
+
+/*!
+\brief Get the size and the statistics of the shape cache of the current context.
+
+The hit rate of the cache is hits / (hits + misses).
+
+\param size Returns the maximum number of shapes (may be NULL).
+\param count Returns the number of cached shapes (may be NULL).
+\param hits Returns the number of shapes drawn from the cache (may be NULL).
+\param misses Returns the number of shapes which had to be tessellated (may be NULL).
+*/
+void gfxGetShapeCacheStats(int *size, int *count, Uint32 *hits, Uint32 *misses)
+{
+	SDL2_gfxShapeCache *cache = &gfxGetContext()->shapes;
+
+	if (size) {
+		*size = _gfxShapeCacheSize(cache);
+	}
+	if (count) {
+		*count = cache->count;
+	}
+	if (hits) {
+		*hits = cache->hits;
+	}
+	if (misses) {
+		*misses = cache->misses;
+	}
+}
+
+/*!
+\brief Free all shapes cached by the current context and reset its statistics.
+*/
+void gfxClearShapeCache(void)
+{
+	SDL2_gfxShapeCache *cache = &gfxGetContext()->shapes;
+
+	_gfxTrimShapeCache(cache, 0);
+	cache->hits = 0;
+	cache->misses = 0;
+}
+
+/* ---- Internal drawing functions used before their definition */
+
+static int _boxRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+static int _arcRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+static int _gfxArcPoints(SDL2_gfxTessellation *tessellation, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end);
+static int _ellipseRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Sint32 f);
+static int _aaellipseRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+static int _polygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+static int _aapolygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+static int _filledPolygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+/* ---- Pixel */
+
+/*!
+\brief Draw pixel  in currently set color.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pixel(SDL_Renderer *renderer, Sint16 x, Sint16 y)
+{
+	return SDL_RenderDrawPoint(renderer, x, y);
+}
+
+/*!
+\brief Draw pixel with blending enabled if a<255.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param color The color value of the pixel to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pixelColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return pixelRGBA(renderer, x, y, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw pixel with blending enabled if a<255.
+
+\param dst The target to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param r The red color value of the pixel to draw.
+\param g The green color value of the pixel to draw.
+\param b The blue color value of the pixel to draw.
+\param a The alpha value of the pixel to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _pixelRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+
+	if (dst->coverage) {
+		return _gfxCoverage(dst, x, y, a);
+	}
+
+	result |= _gfxColor(dst, r, g, b, a);
+	result |= _gfxPixel(dst, x, y);
+	return result;
+}
+
+/*!
+\brief Draw pixel with blending enabled if a<255.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param r The red color value of the pixel to draw. 
+\param g The green color value of the pixel to draw.
+\param b The blue color value of the pixel to draw.
+\param a The alpha value of the pixel to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pixelRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_PIXEL, _pixelRGBA(&dst, x, y, r, g, b, a));
+}
+
+/*!
+\brief Internal function to draw pixel with blending enabled and using alpha weight on color.
+
+\param dst The target to draw on.
+\param x The horizontal coordinate of the pixel.
+\param y The vertical position of the pixel.
+\param r The red color value of the pixel to draw.
+\param g The green color value of the pixel to draw.
+\param b The blue color value of the pixel to draw.
+\param a The alpha value of the pixel to draw.
+\param weight The weight multiplied into the alpha value of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _pixelRGBAWeight(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Uint32 weight)
+{
+	/*
+	* Modify Alpha by weight 
+	*/
+	Uint32 ax = a;
+	ax = ((ax * weight) >> 8);
+	if (ax > 255) {
+		a = 255;
+	} else {
+		a = (Uint8)(ax & 0x000000ff);
+	}
+
+	return _pixelRGBA(dst, x, y, r, g, b, a);
+}
+
+/*!
+\brief Draw pixel with blending enabled and using alpha weight on color.
+
+\param renderer The renderer to draw on.
+\param x The horizontal coordinate of the pixel.
+\param y The vertical position of the pixel.
+\param r The red color value of the pixel to draw. 
+\param g The green color value of the pixel to draw.
+\param b The blue color value of the pixel to draw.
+\param a The alpha value of the pixel to draw.
+\param weight The weight multiplied into the alpha value of the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pixelRGBAWeight(SDL_Renderer * renderer, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Uint32 weight)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_PIXEL, _pixelRGBAWeight(&dst, x, y, r, g, b, a, weight));
+}
+
+/* ---- Hline */
+
+/*!
+\brief Draw horizontal line in currently set color
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int hline(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y)
+{
+	return SDL_RenderDrawLine(renderer, x1, y, x2, y);;
+}
+
+
+/*!
+\brief Draw horizontal line with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int hlineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return hlineRGBA(renderer, x1, x2, y, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw horizontal line with blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _hlineRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 x2, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+	result |= _gfxHline(dst, x1, x2, y);
+	return result;
+}
+
+/*!
+\brief Draw horizontal line with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int hlineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 x2, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _hlineRGBA(&dst, x1, x2, y, r, g, b, a));
+}
+
+/* ---- Vline */
+
+/*!
+\brief Draw vertical line in currently set color
+
+\param renderer The renderer to draw on.
+\param x X coordinate of points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int vline(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2)
+{
+	return SDL_RenderDrawLine(renderer, x, y1, x, y2);;
+}
+
+/*!
+\brief Draw vertical line with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int vlineColor(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return vlineRGBA(renderer, x, y1, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw vertical line with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _vlineRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y1, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+	result |= _gfxVline(dst, x, y1, y2);
+	return result;
+}
+
+/*!
+\brief Draw vertical line with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int vlineRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y1, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _vlineRGBA(&dst, x, y1, y2, r, g, b, a));
+}
+
+/* ---- Rectangle */
+
+/*!
+\brief Draw rectangle with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int rectangleColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return rectangleRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw rectangle with blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _rectangleRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	Sint16 tmp;
+	SDL_Rect rect;
+
+	/*
+	* Test for special cases of straight lines or single point 
+	*/
+	if (x1 == x2) {
+		if (y1 == y2) {
+			return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+		} else {
+			return (_vlineRGBA(dst, x1, y1, y2, r, g, b, a));
+		}
+	} else {
+		if (y1 == y2) {
+			return (_hlineRGBA(dst, x1, x2, y1, r, g, b, a));
+		}
+	}
+
+	/*
+	* Swap x1, x2 if required 
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required 
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	/* 
+	* Create destination rect
+	*/	
+	rect.x = x1;
+	rect.y = y1;
+	rect.w = x2 - x1;
+	rect.h = y2 - y1;
+	
+	/*
+	* Draw
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);	
+	result |= _gfxDrawRect(dst, &rect);
+	return result;
+}
+
+/*!
+\brief Draw rectangle with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int rectangleRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _rectangleRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+}
+
+/* ---- Rounded Rectangle */
+
+/*!
+\brief Draw rounded-corner rectangle with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param rad The radius of the corner arc.
+\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedRectangleColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return roundedRectangleRGBA(renderer, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to tessellate a rounded-corner rectangle with its top left corner at the origin.
+
+\param tessellation The tessellation to add to.
+\param key The shape; rx and ry are the width and height, start is the radius of the corner arcs.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellateRoundedRectangle(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key)
+{
+	int result = 0;
+	Sint16 w = key->rx;
+	Sint16 h = key->ry;
+	Sint16 rad = key->start;
+
+	/*
+	* Corners
+	*/
+	result |= _gfxArcPoints(tessellation, rad, rad, rad, 180, 270);
+	result |= _gfxArcPoints(tessellation, w - rad, rad, rad, 270, 0);
+	result |= _gfxArcPoints(tessellation, rad, h - rad, rad,  90, 180);
+	result |= _gfxArcPoints(tessellation, w - rad, h - rad, rad,   0,  90);
+
+	/*
+	* Lines
+	*/
+	if (rad <= w - rad) {
+		result |= _gfxSpanRect(&tessellation->spans, rad, 0, w - rad - rad + 1, 1);
+		result |= _gfxSpanRect(&tessellation->spans, rad, h, w - rad - rad + 1, 1);
+	}
+	if (rad <= h - rad) {
+		result |= _gfxSpanRect(&tessellation->spans, 0, rad, 1, h - rad - rad + 1);
+		result |= _gfxSpanRect(&tessellation->spans, w, rad, 1, h - rad - rad + 1);
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw rounded-corner rectangle with blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param rad The radius of the corner arc.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _roundedRectangleRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	Sint16 tmp;
+	Sint16 w, h;
+	SDL2_gfxShape key;
+	
+	/*
+	* Check renderer
+	*/
+	if ((dst->renderer == NULL) && (dst->surface == NULL))
+	{
+		return -1;
+	}
+
+	/*
+	* Check radius vor valid range
+	*/
+	if (rad < 0) {
+		return -1;
+	}
+
+	/*
+	* Special case - no rounding
+	*/
+	if (rad <= 1) {
+		return _rectangleRGBA(dst, x1, y1, x2, y2, r, g, b, a);
+	}
+
+	/*
+	* Test for special cases of straight lines or single point 
+	*/
+	if (x1 == x2) {
+		if (y1 == y2) {
+			return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+		} else {
+			return (_vlineRGBA(dst, x1, y1, y2, r, g, b, a));
+		}
+	} else {
+		if (y1 == y2) {
+			return (_hlineRGBA(dst, x1, x2, y1, r, g, b, a));
+		}
+	}
+
+	/*
+	* Swap x1, x2 if required 
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required 
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	/*
+	* Skip rectangles outside of the visible area
+	*/
+	if (_gfxCull(dst, x1, y1, x2, y2)) {
+		return (0);
+	}
+
+	/*
+	* Calculate width&height 
+	*/
+	w = x2 - x1;
+	h = y2 - y1;
+
+	/*
+	* Maybe adjust radius
+	*/
+	if ((rad * 2) > w)  
+	{
+		rad = w / 2;
+	}
+	if ((rad * 2) > h)
+	{
+		rad = h / 2;
+	}
+
+	/*
+	* Set color
+	*/
+	result |= _gfxColor(dst, r, g, b, a);
+
+	/*
+	* Draw corners and lines
+	*/
+	key.type = SDL2_GFX_SHAPE_ROUNDED_RECTANGLE;
+	key.rx = w;
+	key.ry = h;
+	key.start = rad;
+	key.end = 0;
+	key.filled = 0;
+	result |= _gfxDrawShape(dst, &key, x1, y1, _gfxTessellateRoundedRectangle);
+
+	return result;
+}
+
+/*!
+\brief Draw rounded-corner rectangle with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param rad The radius of the corner arc.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedRectangleRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedRectangleRGBA(&dst, x1, y1, x2, y2, rad, r, g, b, a));
+}
+
+/* ---- Rounded Box */
+
+/*!
+\brief Draw rounded-corner box (filled rectangle) with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param color The color value of the box to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return roundedBoxRGBA(renderer, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to tessellate a rounded-corner box with its top left corner at the origin.
+
+Rows of the corners overlap for even sizes; they are merged when the shape is drawn.
+
+\param tessellation The tessellation to add to.
+\param key The shape; rx and ry are the width and height, start is the radius of the corner arcs fitted to the box.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellateRoundedBox(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key)
+{
+	int result = 0;
+	Sint16 w = key->rx;
+	Sint16 h = key->ry;
+	Sint16 rad = key->start;
+	Sint16 cx = 0;
+	Sint16 cy = key->start;
+	Sint16 ocx = (Sint16) 0xffff;
+	Sint16 ocy = (Sint16) 0xffff;
+	Sint16 df = 1 - key->start;
+	Sint16 d_e = 3;
+	Sint16 d_se = -2 * key->start + 5;
+	Sint16 xpcx, xmcx, xpcy, xmcy;
+	Sint16 ypcy, ymcy, ypcx, ymcx;
+	Sint16 x, y, dx, dy;
+
+	/* Setup filled circle drawing for corners */
+	x = rad;
+	y = rad;
+	dx = w - 1 - rad - rad;
+	dy = h - 1 - rad - rad;
+
+	/*
+	* Collect the rows of the corners
+	*/
+	do {
+		xpcx = x + cx;
+		xmcx = x - cx;
+		xpcy = x + cy;
+		xmcy = x - cy;
+		if (ocy != cy) {
+			if (cy > 0) {
+				ypcy = y + cy;
+				ymcy = y - cy;
+				result |= _gfxSpan(&tessellation->spans, xmcx, xpcx + dx, ypcy + dy);
+				result |= _gfxSpan(&tessellation->spans, xmcx, xpcx + dx, ymcy);
+			} else {
+				result |= _gfxSpan(&tessellation->spans, xmcx, xpcx + dx, y);
+			}
+			ocy = cy;
+		}
+		if (ocx != cx) {
+			if (cx != cy) {
+				if (cx > 0) {
+					ypcx = y + cx;
+					ymcx = y - cx;
+					result |= _gfxSpan(&tessellation->spans, xmcy, xpcy + dx, ymcx);
+					result |= _gfxSpan(&tessellation->spans, xmcy, xpcy + dx, ypcx + dy);
+				} else {
+					result |= _gfxSpan(&tessellation->spans, xmcy, xpcy + dx, y);
+				}
+			}
+			ocx = cx;
+		}
+
+		/*
+		* Update 
+		*/
+		if (df < 0) {
+			df += d_e;
+			d_e += 2;
+			d_se += 2;
+		} else {
+			df += d_se;
+			d_e += 2;
+			d_se += 4;
+			cy--;
+		}
+		cx++;
+	} while (cx <= cy);
+
+	/* Inside */
+	if (dx > 0 && dy > 0) {
+		result |= _gfxSpanRect(&tessellation->spans, 0, rad + 1, w, dy);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal function to fit the radius of the corner arcs into a rounded-corner box.
+
+\param w Width of the box.
+\param h Height of the box.
+\param rad The requested radius of the corner arcs.
+
+\returns Returns the radius, at most half the width and half the height of the box.
+*/
+static Sint16 _gfxRoundedBoxRadius(Sint16 w, Sint16 h, Sint16 rad)
+{
+	Sint16 r2;
+
+	r2 = rad + rad;
+	if (r2 > w) {
+		rad = w / 2;
+		r2 = rad + rad;
+	}
+	if (r2 > h) {
+		rad = h / 2;
+	}
+
+	return rad;
+}
+
+/*!
+\brief Internal function to draw rounded-corner box (filled rectangle) with blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _roundedBoxRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2,
+	Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	Sint16 w, h, tmp;
+	SDL2_gfxShape key;
+
+	/* 
+	* Check destination renderer 
+	*/
+	if ((dst->renderer == NULL) && (dst->surface == NULL))
+	{
+		return -1;
+	}
+
+	/*
+	* Check radius vor valid range
+	*/
+	if (rad < 0) {
+		return -1;
+	}
+
+	/*
+	* Special case - no rounding
+	*/
+	if (rad <= 1) {
+		return _rectangleRGBA(dst, x1, y1, x2, y2, r, g, b, a);
+	}
+
+	/*
+	* Test for special cases of straight lines or single point 
+	*/
+	if (x1 == x2) {
+		if (y1 == y2) {
+			return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+		} else {
+			return (_vlineRGBA(dst, x1, y1, y2, r, g, b, a));
+		}
+	} else {
+		if (y1 == y2) {
+			return (_hlineRGBA(dst, x1, x2, y1, r, g, b, a));
+		}
+	}
+
+	/*
+	* Swap x1, x2 if required 
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required 
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	/*
+	* Skip rectangles outside of the visible area
+	*/
+	if (_gfxCull(dst, x1, y1, x2, y2)) {
+		return (0);
+	}
+
+	/*
+	* Calculate width&height and maybe adjust radius
+	*/
+	w = x2 - x1 + 1;
+	h = y2 - y1 + 1;
+	rad = _gfxRoundedBoxRadius(w, h, rad);
+
+	/*
+	* Set color
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+
+	/*
+	* Draw corners and inside
+	*/
+	key.type = SDL2_GFX_SHAPE_ROUNDED_BOX;
+	key.rx = w;
+	key.ry = h;
+	key.start = rad;
+	key.end = 0;
+	key.filled = 1;
+	result |= _gfxDrawShape(dst, &key, x1, y1, _gfxTessellateRoundedBox);
+
+	return (result);
+}
+
+/*!
+\brief Draw rounded-corner box (filled rectangle) with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2,
+	Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedBoxRGBA(&dst, x1, y1, x2, y2, rad, r, g, b, a));
+}
+
+/* ---- Box */
+
+/*!
+\brief Draw box (filled rectangle) with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param color The color value of the box to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return boxRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw box (filled rectangle) with blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _boxRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	Sint16 tmp;
+	SDL_Rect rect;
+
+	/*
+	* Test for special cases of straight lines or single point 
+	*/
+	if (x1 == x2) {
+		if (y1 == y2) {
+			return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+		} else {
+			return (_vlineRGBA(dst, x1, y1, y2, r, g, b, a));
+		}
+	} else {
+		if (y1 == y2) {
+			return (_hlineRGBA(dst, x1, x2, y1, r, g, b, a));
+		}
+	}
+
+	/*
+	* Swap x1, x2 if required 
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required 
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	/* 
+	* Create destination rect
+	*/	
+	rect.x = x1;
+	rect.y = y1;
+	rect.w = x2 - x1 + 1;
+	rect.h = y2 - y1 + 1;
+	
+	/*
+	* Draw
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);	
+	result |= _gfxFillRect(dst, &rect);
+	return result;
+}
+
+/*!
+\brief Draw box (filled rectangle) with blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+}
+
+/* ----- Line */
+
+/*!
+\brief Draw line with alpha blending using the currently set color.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int line(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2)
+{
+	/*
+	* Draw
+	*/
+	return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+}
+
+/*!
+\brief Draw line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the seond point of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int lineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return lineRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw line with alpha blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _lineRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	/*
+	* Draw
+	*/
+	int result = 0;
+	result |= _gfxColor(dst, r, g, b, a);	
+	result |= _gfxLine(dst, x1, y1, x2, y2);
+	return result;
+}
+
+/*!
+\brief Draw line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int lineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _lineRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+}
+
+/* ---- AA Line */
+
+#define AAlevels 256
+#define AAbits 8
+
+/*!
+\brief Internal function to advance the error accumulator of an anti-aliased line over several pixels.
+
+\param erracc The error accumulator to advance.
+\param erradj The 32-bit fixed point increment per pixel; 0 stands for a full pixel.
+\param steps Number of pixels to skip.
+
+\returns Returns how often the accumulator turned over, i.e. how far the minor axis advanced.
+*/
+static int _gfxSkipAALine(Uint32 *erracc, Uint32 erradj, int steps)
+{
+	Uint64 total;
+
+	if (erradj == 0) {
+		return steps;
+	}
+	total = (Uint64)*erracc + (Uint64)erradj * (Uint64)steps;
+	*erracc = (Uint32)total;
+
+	return (int)(total >> 32);
+}
+
+/*!
+\brief Internal function to draw anti-aliased line with alpha blending and endpoint control.
+
+This implementation of the Wu antialiasing code is based on Mike Abrash's
+DDJ article which was reprinted as Chapter 42 of his Graphics Programming
+Black Book, but has been optimized to work with SDL and utilizes 32-bit
+fixed-point arithmetic by A. Schiffler. The endpoint control allows the
+supression to draw the last pixel useful for rendering continous aa-lines
+with alpha<255.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the aa-line.
+\param y1 Y coordinate of the first point of the aa-line.
+\param x2 X coordinate of the second point of the aa-line.
+\param y2 Y coordinate of the second point of the aa-line.
+\param r The red value of the aa-line to draw. 
+\param g The green value of the aa-line to draw. 
+\param b The blue value of the aa-line to draw. 
+\param a The alpha value of the aa-line to draw.
+\param draw_endpoint Flag indicating if the endpoint should be drawn; draw if non-zero.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aalineRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a, int draw_endpoint)
+{
+	Sint32 xx0, yy0, xx1, yy1;
+	int result;
+	Uint32 intshift, erracc, erradj;
+	Uint32 erracctmp, wgt, wgtcompmask;
+	int dx, dy, tmp, xdir, y0p1, x0pxdir;
+	int first, last, steps;
+
+	/*
+	* Keep on working with 32bit numbers 
+	*/
+	xx0 = x1;
+	yy0 = y1;
+	xx1 = x2;
+	yy1 = y2;
+
+	/*
+	* Reorder points to make dy positive 
+	*/
+	if (yy0 > yy1) {
+		tmp = yy0;
+		yy0 = yy1;
+		yy1 = tmp;
+		tmp = xx0;
+		xx0 = xx1;
+		xx1 = tmp;
+	}
+
+	/*
+	* Calculate distance 
+	*/
+	dx = xx1 - xx0;
+	dy = yy1 - yy0;
+
+	/*
+	* Adjust for negative dx and set xdir 
+	*/
+	if (dx >= 0) {
+		xdir = 1;
+	} else {
+		xdir = -1;
+		dx = (-dx);
+	}
+	
+	/*
+	* Nothing to draw if the bounding box is invisible; paired pixels may be one off 
+	*/
+	if (_gfxCull(dst, SDL_min(x1, x2) - 1, yy0 - 1, SDL_max(x1, x2) + 1, yy1 + 1)) {
+		return (0);
+	}
+
+	/*
+	* Check for special cases 
+	*/
+	if (dx == 0) {
+		/*
+		* Vertical line 
+		*/
+		if (draw_endpoint)
+		{
+			return (_vlineRGBA(dst, x1, y1, y2, r, g, b, a));
+		} else {
+			if (dy > 0) {
+				return (_vlineRGBA(dst, x1, yy0, yy0+dy, r, g, b, a));
+			} else {
+				return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+			}
+		}
+	} else if (dy == 0) {
+		/*
+		* Horizontal line 
+		*/
+		if (draw_endpoint)
+		{
+			return (_hlineRGBA(dst, x1, x2, y1, r, g, b, a));
+		} else {
+			if (dx > 0) {
+				return (_hlineRGBA(dst, xx0, xx0+dx, y1, r, g, b, a));
+			} else {
+				return (_pixelRGBA(dst, x1, y1, r, g, b, a));
+			}
+		}
+	} else if ((dx == dy) && (draw_endpoint)) {
+		/*
+		* Diagonal line (with endpoint)
+		*/
+		return (_lineRGBA(dst, x1, y1, x2, y2,  r, g, b, a));
+	}
+
+
+	/*
+	* Line is not horizontal, vertical or diagonal (with endpoint)
+	*/
+	result = 0;
+
+	/*
+	* Zero accumulator 
+	*/
+	erracc = 0;
+
+	/*
+	* # of bits by which to shift erracc to get intensity level 
+	*/
+	intshift = 32 - AAbits;
+
+	/*
+	* Mask used to flip all bits in an intensity weighting 
+	*/
+	wgtcompmask = AAlevels - 1;
+
+	/*
+	* Collect pixels to draw them per alpha level 
+	*/
+	_gfxBeginCoverage(dst);
+
+	/*
+	* Draw the initial pixel in the foreground color 
+	*/
+	result |= _pixelRGBA(dst, x1, y1, r, g, b, a);
+
+	/*
+	* x-major or y-major? 
+	*/
+	if (dy > dx) {
+
+		/*
+		* y-major.  Calculate 16-bit fixed point fractional part of a pixel that
+		* X advances every time Y advances 1 pixel, truncating the result so that
+		* we won't overrun the endpoint along the X axis 
+		*/
+		/*
+		* Not-so-portable version: erradj = ((Uint64)dx << 32) / (Uint64)dy; 
+		*/
+		erradj = ((dx << 16) / dy) << 16;
+
+		/*
+		* Only step the visible rows 
+		*/
+		first = 1;
+		last = dy - 1;
+		if (dst->cull) {
+			first = SDL_max(first, dst->clip.y - yy0);
+			last = SDL_min(last, dst->clip.y + dst->clip.h - 1 - yy0);
+		}
+		if (first > 1) {
+			steps = _gfxSkipAALine(&erracc, erradj, first - 1);
+			xx0 += xdir * steps;
+			yy0 += first - 1;
+		}
+		dy = (last >= first) ? last - first + 2 : 1;
+
+		/*
+		* draw all pixels other than the first and last 
+		*/
+		x0pxdir = xx0 + xdir;
+		while (--dy) {
+			erracctmp = erracc;
+			erracc += erradj;
+			if (erracc <= erracctmp) {
+				/*
+				* rollover in error accumulator, x coord advances 
+				*/
+				xx0 = x0pxdir;
+				x0pxdir += xdir;
+			}
+			yy0++;		/* y-major so always advance Y */
+
+			/*
+			* the AAbits most significant bits of erracc give us the intensity
+			* weighting for this pixel, and the complement of the weighting for
+			* the paired pixel. 
+			*/
+			wgt = (erracc >> intshift) & 255;
+			result |= _pixelRGBAWeight(dst, xx0, yy0, r, g, b, a, 255 - wgt);
+			result |= _pixelRGBAWeight(dst, x0pxdir, yy0, r, g, b, a, wgt);
+		}
+
+	} else {
+
+		/*
+		* x-major line.  Calculate 16-bit fixed-point fractional part of a pixel
+		* that Y advances each time X advances 1 pixel, truncating the result so
+		* that we won't overrun the endpoint along the X axis. 
+		*/
+		/*
+		* Not-so-portable version: erradj = ((Uint64)dy << 32) / (Uint64)dx; 
+		*/
+		erradj = ((dy << 16) / dx) << 16;
+
+		/*
+		* Only step the visible columns 
+		*/
+		first = 1;
+		last = dx - 1;
+		if (dst->cull) {
+			if (xdir > 0) {
+				first = SDL_max(first, dst->clip.x - xx0);
+				last = SDL_min(last, dst->clip.x + dst->clip.w - 1 - xx0);
+			} else {
+				first = SDL_max(first, xx0 - (dst->clip.x + dst->clip.w - 1));
+				last = SDL_min(last, xx0 - dst->clip.x);
+			}
+		}
+		if (first > 1) {
+			steps = _gfxSkipAALine(&erracc, erradj, first - 1);
+			yy0 += steps;
+			xx0 += xdir * (first - 1);
+		}
+		dx = (last >= first) ? last - first + 2 : 1;
+
+		/*
+		* draw all pixels other than the first and last 
+		*/
+		y0p1 = yy0 + 1;
+		while (--dx) {
+
+			erracctmp = erracc;
+			erracc += erradj;
+			if (erracc <= erracctmp) {
+				/*
+				* Accumulator turned over, advance y 
+				*/
+				yy0 = y0p1;
+				y0p1++;
+			}
+			xx0 += xdir;	/* x-major so always advance X */
+			/*
+			* the AAbits most significant bits of erracc give us the intensity
+			* weighting for this pixel, and the complement of the weighting for
+			* the paired pixel. 
+			*/
+			wgt = (erracc >> intshift) & 255;
+			result |= _pixelRGBAWeight(dst, xx0, yy0, r, g, b, a, 255 - wgt);
+			result |= _pixelRGBAWeight(dst, xx0, y0p1, r, g, b, a, wgt);
+		}
+	}
+
+	/*
+	* Do we have to draw the endpoint 
+	*/
+	if (draw_endpoint) {
+		/*
+		* Draw final pixel, always exactly intersected by the line and doesn't
+		* need to be weighted. 
+		*/
+		result |= _pixelRGBA(dst, x2, y2, r, g, b, a);
+	}
+
+	result |= _gfxEndCoverage(dst, r, g, b);
+
+	return (result);
+}
+
+/*!
+\brief Draw anti-aliased line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the aa-line.
+\param y1 Y coordinate of the first point of the aa-line.
+\param x2 X coordinate of the second point of the aa-line.
+\param y2 Y coordinate of the second point of the aa-line.
+\param color The color value of the aa-line to draw (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aalineColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aalineRGBA(renderer, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw anti-aliased line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the aa-line.
+\param y1 Y coordinate of the first point of the aa-line.
+\param x2 X coordinate of the second point of the aa-line.
+\param y2 Y coordinate of the second point of the aa-line.
+\param r The red value of the aa-line to draw. 
+\param g The green value of the aa-line to draw. 
+\param b The blue value of the aa-line to draw. 
+\param a The alpha value of the aa-line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aalineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_AALINE, _aalineRGBA(&dst, x1, y1, x2, y2, r, g, b, a, 1));
+}
+
+/* ----- Circle */
+
+/*!
+\brief Draw circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param rad Radius in pixels of the circle.
+\param color The color value of the circle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int circleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return ellipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw circle with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param rad Radius in pixels of the circle.
+\param r The red value of the circle to draw. 
+\param g The green value of the circle to draw. 
+\param b The blue value of the circle to draw. 
+\param a The alpha value of the circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _circleRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	return _ellipseRGBA(dst, x, y, rad, rad, r, g, b, a, 0);
+}
+
+/*!
+\brief Draw circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param rad Radius in pixels of the circle.
+\param r The red value of the circle to draw. 
+\param g The green value of the circle to draw. 
+\param b The blue value of the circle to draw. 
+\param a The alpha value of the circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int circleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _circleRGBA(&dst, x, y, rad, r, g, b, a));
+}
+
+/* ----- Arc */
+
+/*!
+\brief Arc with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param color The color value of the arc to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int arcColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return arcRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Sine of the whole angles from 0 to 90 degrees scaled by 2^30.
+*/
+static const Sint32 _gfxSinTable[91] = {
+	0, 18739379, 37473049, 56195305, 74900443, 93582766,
+	112236583, 130856211, 149435979, 167970228, 186453311, 204879599,
+	223243478, 241539355, 259761657, 277904834, 295963357, 313931728,
+	331804471, 349576144, 367241333, 384794656, 402230767, 419544355,
+	436730145, 453782903, 470697435, 487468587, 504091252, 520560366,
+	536870912, 553017922, 568996477, 584801711, 600428808, 615873009,
+	631129609, 646193961, 661061475, 675727625, 690187940, 704438018,
+	718473518, 732290163, 745883746, 759250125, 772385229, 785285058,
+	797945680, 810363241, 822533958, 834454122, 846120104, 857528349,
+	868675383, 879557810, 890172315, 900515665, 910584710, 920376381,
+	929887697, 939115760, 948057759, 956710970, 965072759, 973140576,
+	980911966, 988384560, 995556083, 1002424350, 1008987269, 1015242840,
+	1021189159, 1026824413, 1032146887, 1037154959, 1041847103, 1046221891,
+	1050277989, 1054014162, 1057429273, 1060522280, 1063292242, 1065738315,
+	1067859754, 1069655912, 1071126243, 1072270298, 1073087729, 1073578288,
+	1073741824
+};
+
+/*!
+\brief Internal function to look up the sine of a whole angle.
+
+\param deg The angle in degrees (any value).
+
+\returns Returns the sine scaled by 2^30.
+*/
+static Sint32 _gfxSin(int deg)
+{
+	deg %= 360;
+	if (deg < 0) {
+		deg += 360;
+	}
+	if (deg <= 90) {
+		return _gfxSinTable[deg];
+	} else if (deg <= 180) {
+		return _gfxSinTable[180 - deg];
+	} else if (deg <= 270) {
+		return -_gfxSinTable[deg - 180];
+	}
+	return -_gfxSinTable[360 - deg];
+}
+
+/*!
+\brief Internal function to look up the cosine of a whole angle.
+
+\param deg The angle in degrees (any value).
+
+\returns Returns the cosine scaled by 2^30.
+*/
+static Sint32 _gfxCos(int deg)
+{
+	return _gfxSin(deg + 90);
+}
+
+/*!
+\brief Internal function to add the pixels of an arc to a tessellation.
+
+\param tessellation The tessellation to add to.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc (0 to 359). 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc (0 to 359). 0 degrees is down, increasing counterclockwise.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxArcPoints(SDL2_gfxTessellation *tessellation, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end)
+{
+	int result;
+	Sint16 cx = 0;
+	Sint16 cy = rad;
+	Sint16 df = 1 - rad;
+	Sint16 d_e = 3;
+	Sint16 d_se = -2 * rad + 5;
+	Sint16 xpcx, xmcx, xpcy, xmcy;
+	Sint16 ypcy, ymcy, ypcx, ymcx;
+	Uint8 drawoct;
+	int startoct, endoct, oct, stopval_start = 0, stopval_end = 0;
+	Sint64 temp = 0;
+
+	/*
+	* Special case for rad=0 - a point 
+	*/
+	if (rad == 0) {
+		return (_gfxTessellationPoint(tessellation, x, y));
+	}
+
+	/*
+	 Octant labeling
+	      
+	  \ 5 | 6 /
+	   \  |  /
+	  4 \ | / 7
+	     \|/
+	------+------ +x
+	     /|\
+	  3 / | \ 0
+	   /  |  \
+	  / 2 | 1 \
+	      +y
+
+	 Initially reset bitmask to 0x00000000
+	 the set whether or not to keep drawing a given octant.
+	 For example: 0x00111100 means we're drawing in octants 2-5
+	*/
+	drawoct = 0; 
+
+	/* now, we find which octants we're drawing in. */
+	startoct = start / 45;
+	endoct = end / 45;
+	oct = startoct - 1;
+
+	/* stopval_start, stopval_end; what values of cx to stop at. */
+	do {
+		oct = (oct + 1) % 8;
+
+		if (oct == startoct) {
+			/* need to compute stopval_start for this octant.  Look at picture above if this is unclear */
+			switch (oct) 
+			{
+			case 0:
+			case 3:
+				temp = _gfxSin(start);
+				break;
+			case 1:
+			case 6:
+				temp = _gfxCos(start);
+				break;
+			case 2:
+			case 5:
+				temp = -_gfxCos(start);
+				break;
+			case 4:
+			case 7:
+				temp = -_gfxSin(start);
+				break;
+			}
+			stopval_start = (int)((temp * rad) / (1 << 30));
+
+			/* 
+			This isn't arbitrary, but requires graph paper to explain well.
+			The basic idea is that we're always changing drawoct after we draw, so we
+			stop immediately after we render the last sensible pixel at x = ((int)temp).
+			and whether to draw in this octant initially
+			*/
+			if (oct % 2) drawoct |= (1 << oct);			/* this is basically like saying drawoct[oct] = true, if drawoct were a bool array */
+			else		 drawoct &= 255 - (1 << oct);	/* this is basically like saying drawoct[oct] = false */
+		}
+		if (oct == endoct) {
+			/* need to compute stopval_end for this octant */
+			switch (oct)
+			{
+			case 0:
+			case 3:
+				temp = _gfxSin(end);
+				break;
+			case 1:
+			case 6:
+				temp = _gfxCos(end);
+				break;
+			case 2:
+			case 5:
+				temp = -_gfxCos(end);
+				break;
+			case 4:
+			case 7:
+				temp = -_gfxSin(end);
+				break;
+			}
+			stopval_end = (int)((temp * rad) / (1 << 30));
+
+			/* and whether to draw in this octant initially */
+			if (startoct == endoct)	{
+				/* note:      we start drawing, stop, then start again in this case */
+				/* otherwise: we only draw in this octant, so initialize it to false, it will get set back to true */
+				if (start > end) {
+					/* unfortunately, if we're in the same octant and need to draw over the whole circle, */
+					/* we need to set the rest to true, because the while loop will end at the bottom. */
+					drawoct = 255;
+				} else {
+					drawoct &= 255 - (1 << oct);
+				}
+			} 
+			else if (oct % 2) drawoct &= 255 - (1 << oct);
+			else			  drawoct |= (1 << oct);
+		} else if (oct != startoct) { /* already verified that it's != endoct */
+			drawoct |= (1 << oct); /* draw this entire segment */
+		}
+	} while (oct != endoct);
+
+	/* so now we have what octants to draw and when to draw them. all that's left is the actual raster code. */
+
+	/*
+	* Add arc pixels 
+	*/
+	result = 0;
+	do {
+		ypcy = y + cy;
+		ymcy = y - cy;
+		if (cx > 0) {
+			xpcx = x + cx;
+			xmcx = x - cx;
+
+			/* always check if we're drawing a certain octant before adding a pixel to that octant. */
+			if (drawoct & 4)  result |= _gfxTessellationPoint(tessellation, xmcx, ypcy);
+			if (drawoct & 2)  result |= _gfxTessellationPoint(tessellation, xpcx, ypcy);
+			if (drawoct & 32) result |= _gfxTessellationPoint(tessellation, xmcx, ymcy);
+			if (drawoct & 64) result |= _gfxTessellationPoint(tessellation, xpcx, ymcy);
+		} else {
+			if (drawoct & 96) result |= _gfxTessellationPoint(tessellation, x, ymcy);
+			if (drawoct & 6)  result |= _gfxTessellationPoint(tessellation, x, ypcy);
+		}
+
+		xpcy = x + cy;
+		xmcy = x - cy;
+		if (cx > 0 && cx != cy) {
+			ypcx = y + cx;
+			ymcx = y - cx;
+			if (drawoct & 8)   result |= _gfxTessellationPoint(tessellation, xmcy, ypcx);
+			if (drawoct & 1)   result |= _gfxTessellationPoint(tessellation, xpcy, ypcx);
+			if (drawoct & 16)  result |= _gfxTessellationPoint(tessellation, xmcy, ymcx);
+			if (drawoct & 128) result |= _gfxTessellationPoint(tessellation, xpcy, ymcx);
+		} else if (cx == 0) {
+			if (drawoct & 24)  result |= _gfxTessellationPoint(tessellation, xmcy, y);
+			if (drawoct & 129) result |= _gfxTessellationPoint(tessellation, xpcy, y);
+		}
+
+		/*
+		* Update whether we're drawing an octant
+		*/
+		if (stopval_start == cx) {
+			/* works like an on-off switch. */  
+			/* This is just in case start & end are in the same octant. */
+			if (drawoct & (1 << startoct)) drawoct &= 255 - (1 << startoct);		
+			else						   drawoct |= (1 << startoct);
+		}
+		if (stopval_end == cx) {
+			if (drawoct & (1 << endoct)) drawoct &= 255 - (1 << endoct);
+			else						 drawoct |= (1 << endoct);
+		}
+
+		/*
+		* Update pixels
+		*/
+		if (df < 0) {
+			df += d_e;
+			d_e += 2;
+			d_se += 2;
+		} else {
+			df += d_se;
+			d_e += 2;
+			d_se += 4;
+			cy--;
+		}
+		cx++;
+	} while (cx <= cy);
+
+	return (result);
+}
+
+/*!
+\brief Internal function to tessellate an arc around the origin.
+
+\param tessellation The tessellation to add to.
+\param key The shape; rx is the radius, start and end are the angles of the arc.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellateArc(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key)
+{
+	return (_gfxArcPoints(tessellation, 0, 0, key->rx, key->start, key->end));
+}
+
+/*!
+\brief Internal function to arc with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param r The red value of the arc to draw. 
+\param g The green value of the arc to draw. 
+\param b The blue value of the arc to draw. 
+\param a The alpha value of the arc to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _arcRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxShape key;
+
+	/*
+	* Sanity check radius 
+	*/
+	if (rad < 0) {
+		return (-1);
+	}
+
+	/*
+	* Special case for rad=0 - draw a point 
+	*/
+	if (rad == 0) {
+		return (_pixelRGBA(dst, x, y, r, g, b, a));
+	}
+
+	/*
+	* Skip arcs outside of the visible area
+	*/
+	if (_gfxCull(dst, x - rad, y - rad, x + rad, y + rad)) {
+		return (0);
+	}
+
+	/*
+	* Fixup angles
+	*/
+	start %= 360;
+	end %= 360;
+	/* 0 <= start & end < 360; note that sometimes start > end - if so, arc goes back through 0. */
+	while (start < 0) start += 360;
+	while (end < 0) end += 360;
+	start %= 360;
+	end %= 360;
+
+	/*
+	* Set color 
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+
+	/*
+	* Draw arc 
+	*/
+	key.type = SDL2_GFX_SHAPE_ARC;
+	key.rx = rad;
+	key.ry = rad;
+	key.start = start;
+	key.end = end;
+	key.filled = 0;
+	result |= _gfxDrawShape(dst, &key, x, y, _gfxTessellateArc);
+
+	return (result);
+}
+
+/*!
+\brief Arc with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param r The red value of the arc to draw. 
+\param g The green value of the arc to draw. 
+\param b The blue value of the arc to draw. 
+\param a The alpha value of the arc to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+/* TODO: rewrite algorithm; arc endpoints are not always drawn */
+int arcRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _arcRGBA(&dst, x, y, rad, start, end, r, g, b, a));
+}
+
+/* ----- AA Circle */
+
+/*!
+\brief Draw anti-aliased circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the aa-circle.
+\param y Y coordinate of the center of the aa-circle.
+\param rad Radius in pixels of the aa-circle.
+\param color The color value of the aa-circle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aacircleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aaellipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw anti-aliased circle with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the aa-circle.
+\param y Y coordinate of the center of the aa-circle.
+\param rad Radius in pixels of the aa-circle.
+\param r The red value of the aa-circle to draw. 
+\param g The green value of the aa-circle to draw. 
+\param b The blue value of the aa-circle to draw. 
+\param a The alpha value of the aa-circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aacircleRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	/*
+	* Draw 
+	*/
+	return _aaellipseRGBA(dst, x, y, rad, rad, r, g, b, a);
+}
+
+/*!
+\brief Draw anti-aliased circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the aa-circle.
+\param y Y coordinate of the center of the aa-circle.
+\param rad Radius in pixels of the aa-circle.
+\param r The red value of the aa-circle to draw. 
+\param g The green value of the aa-circle to draw. 
+\param b The blue value of the aa-circle to draw. 
+\param a The alpha value of the aa-circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aacircleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _aacircleRGBA(&dst, x, y, rad, r, g, b, a));
+}
+
+/* ----- Ellipse */
+
+/*!
+\brief Internal function to add pixels or lines in 4 quadrants to a tessellation.
+
+Filled quadrants are added as columns.
+
+\param tessellation The tessellation to add to.
+\param x X coordinate of the center of the quadrant.
+\param y Y coordinate of the center of the quadrant.
+\param dx X offset in pixels of the corners of the quadrant.
+\param dy Y offset in pixels of the corners of the quadrant.
+\param f Flag indicating if the quadrant should be filled (1) or not (0).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _drawQuadrants(SDL2_gfxTessellation *tessellation, Sint16 x, Sint16 y, Sint16 dx, Sint16 dy, Sint32 f)
+{
+	int result = 0;
+	Sint16 xpdx, xmdx;
+	Sint16 ypdy, ymdy;
+
+	if (dx == 0) {
+		if (dy == 0) {
+			result |= _gfxTessellationPoint(tessellation, x, y);
+		} else {
+			ypdy = y + dy;
+			ymdy = y - dy;
+			if (f) {
+				result |= _gfxSpanRect(&tessellation->spans, x, ymdy, 1, ypdy - ymdy + 1);
+			} else {
+				result |= _gfxTessellationPoint(tessellation, x, ypdy);
+				result |= _gfxTessellationPoint(tessellation, x, ymdy);
+			}
+		}
+	} else {	
+		xpdx = x + dx;
+		xmdx = x - dx;
+		ypdy = y + dy;
+		ymdy = y - dy;
+		if (f) {
+				result |= _gfxSpanRect(&tessellation->spans, xpdx, ymdy, 1, ypdy - ymdy + 1);
+				result |= _gfxSpanRect(&tessellation->spans, xmdx, ymdy, 1, ypdy - ymdy + 1);
+		} else {
+				result |= _gfxTessellationPoint(tessellation, xpdx, ypdy);
+				result |= _gfxTessellationPoint(tessellation, xmdx, ypdy);
+				result |= _gfxTessellationPoint(tessellation, xpdx, ymdy);
+				result |= _gfxTessellationPoint(tessellation, xmdx, ymdy);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to tessellate an ellipse or filled ellipse around the origin.
+
+\param tessellation The tessellation to add to.
+\param key The shape; rx and ry are the radii, filled selects a filled ellipse.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+#define ELLIPSE_OVERSCAN	4
+static int _gfxTessellateEllipse(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key)
+{
+	int result;
+	Sint16 x = 0, y = 0;
+	Sint16 rx = key->rx, ry = key->ry;
+	Sint32 f = key->filled;
+	Sint32 rx2, ry2, rx22, ry22; 
+    Sint32 error;
+    Sint32 curX, curY, curXp1, curYm1;
+	Sint32 scrX, scrY, oldX, oldY;
+    Sint32 deltaX, deltaY;
+
+	/*
+	 * Top/bottom center points.
+	 */
+	result = 0;
+	oldX = scrX = 0;
+	oldY = scrY = ry;
+	result |= _drawQuadrants(tessellation, x, y, 0, ry, f);
+
+	/* Midpoint ellipse algorithm with overdraw */
+	rx *= ELLIPSE_OVERSCAN;
+	ry *= ELLIPSE_OVERSCAN;
+	rx2 = rx * rx;
+	rx22 = rx2 + rx2;
+    ry2 = ry * ry;
+	ry22 = ry2 + ry2;
+    curX = 0;
+    curY = ry;
+    deltaX = 0;
+    deltaY = rx22 * curY;
+ 
+	/* Points in segment 1 */ 
+    error = ry2 - rx2 * ry + rx2 / 4;
+    while (deltaX <= deltaY)
+    {
+          curX++;
+          deltaX += ry22;
+ 
+          error +=  deltaX + ry2; 
+          if (error >= 0)
+          {
+               curY--;
+               deltaY -= rx22; 
+               error -= deltaY;
+          }
+
+		  scrX = curX/ELLIPSE_OVERSCAN;
+		  scrY = curY/ELLIPSE_OVERSCAN;
+		  if ((scrX != oldX && scrY == oldY) || (scrX != oldX && scrY != oldY)) {
+			result |= _drawQuadrants(tessellation, x, y, scrX, scrY, f);
+			oldX = scrX;
+			oldY = scrY;
+		  }
+    }
+
+	/* Points in segment 2 */
+	if (curY > 0) 
+	{
+		curXp1 = curX + 1;
+		curYm1 = curY - 1;
+		error = ry2 * curX * curXp1 + ((ry2 + 3) / 4) + rx2 * curYm1 * curYm1 - rx2 * ry2;
+		while (curY > 0)
+		{
+			curY--;
+			deltaY -= rx22;
+
+			error += rx2;
+			error -= deltaY;
+ 
+			if (error <= 0) 
+			{
+               curX++;
+               deltaX += ry22;
+               error += deltaX;
+			}
+
+		    scrX = curX/ELLIPSE_OVERSCAN;
+		    scrY = curY/ELLIPSE_OVERSCAN;
+		    if ((scrX != oldX && scrY == oldY) || (scrX != oldX && scrY != oldY)) {
+				oldY--;
+				for (;oldY >= scrY; oldY--) {
+					result |= _drawQuadrants(tessellation, x, y, scrX, oldY, f);
+					/* prevent overdraw */
+					if (f) {
+						oldY = scrY - 1;
+					}
+				}
+  				oldX = scrX;
+				oldY = scrY;
+		    }		
+		}
+
+		/* Remaining points in vertical */
+		if (!f) {
+			oldY--;
+			for (;oldY >= 0; oldY--) {
+				result |= _drawQuadrants(tessellation, x, y, scrX, oldY, f);
+			}
+		}
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal function to draw ellipse or filled ellipse with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the ellipse.
+\param y Y coordinate of the center of the ellipse.
+\param rx Horizontal radius in pixels of the ellipse.
+\param ry Vertical radius in pixels of the ellipse.
+\param r The red value of the ellipse to draw. 
+\param g The green value of the ellipse to draw. 
+\param b The blue value of the ellipse to draw. 
+\param a The alpha value of the ellipse to draw.
+\param f Flag indicating if the ellipse should be filled (1) or not (0).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _ellipseRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Sint32 f)
+{
+	int result;
+	SDL2_gfxShape key;
+
+	/*
+	* Sanity check radii 
+	*/
+	if ((rx < 0) || (ry < 0)) {
+		return (-1);
+	}
+
+	/*
+	* Skip ellipses outside of the visible area
+	*/
+	if (_gfxCull(dst, x - rx, y - ry, x + rx, y + ry)) {
+		return (0);
+	}
+
+	/*
+	* Set color
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+
+	/*
+	* Special cases for rx=0 and/or ry=0: draw a hline/vline/pixel 
+	*/
+	if (rx == 0) {
+		if (ry == 0) {
+			return (_gfxPixel(dst, x, y));
+		} else {
+			return (_gfxVline(dst, x, y - ry, y + ry));
+		}
+	} else {
+		if (ry == 0) {
+			return (_gfxHline(dst, x - rx, x + rx, y));
+		}
+	}
+
+	/*
+	* Draw the pixels (or columns) of the ellipse 
+	*/
+	key.type = SDL2_GFX_SHAPE_ELLIPSE;
+	key.rx = rx;
+	key.ry = ry;
+	key.start = 0;
+	key.end = 0;
+	key.filled = (f) ? 1 : 0;
+	result |= _gfxDrawShape(dst, &key, x, y, _gfxTessellateEllipse);
+
+	return (result);
+}
+
+/*!
+\brief Draw ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the ellipse.
+\param y Y coordinate of the center of the ellipse.
+\param rx Horizontal radius in pixels of the ellipse.
+\param ry Vertical radius in pixels of the ellipse.
+\param color The color value of the ellipse to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int ellipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return ellipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the ellipse.
+\param y Y coordinate of the center of the ellipse.
+\param rx Horizontal radius in pixels of the ellipse.
+\param ry Vertical radius in pixels of the ellipse.
+\param r The red value of the ellipse to draw. 
+\param g The green value of the ellipse to draw. 
+\param b The blue value of the ellipse to draw. 
+\param a The alpha value of the ellipse to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int ellipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _ellipseRGBA(&dst, x, y, rx, ry, r, g, b, a, 0));
+}
+
+/* ----- Filled Circle */
+
+/*!
+\brief Draw filled circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param color The color value of the filled circle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledCircleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return filledEllipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw filled circle with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r The red value of the filled circle to draw. 
+\param g The green value of the filled circle to draw. 
+\param b The blue value of the filled circle to draw. 
+\param a The alpha value of the filled circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledCircleRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	return _ellipseRGBA(dst, x, y, rad, rad, r, g ,b, a, 1);
+}
+
+/*!
+\brief Draw filled circle with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r The red value of the filled circle to draw. 
+\param g The green value of the filled circle to draw. 
+\param b The blue value of the filled circle to draw. 
+\param a The alpha value of the filled circle to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledCircleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCircleRGBA(&dst, x, y, rad, r, g, b, a));
+}
+
+
+/* ----- AA Ellipse */
+
+/* Windows targets do not have lrint, so provide a local inline version */
+#if defined(_MSC_VER)
+/* Detect 64bit and use intrinsic version */
+#ifdef _M_X64
+#include <emmintrin.h>
+static __inline long 
+	lrint(float f) 
+{
+	return _mm_cvtss_si32(_mm_load_ss(&f));
+}
+#elif defined(_M_IX86)
+__inline long int
+	lrint (double flt)
+{	
+	int intgr;
+	_asm
+	{
+		fld flt
+			fistp intgr
+	};
+	return intgr;
+}
+#elif defined(_M_ARM)
+#include <armintr.h>
+#pragma warning(push)
+#pragma warning(disable: 4716)
+__declspec(naked) long int
+	lrint (double flt)
+{
+	__emit(0xEC410B10); // fmdrr  d0, r0, r1
+	__emit(0xEEBD0B40); // ftosid s0, d0
+	__emit(0xEE100A10); // fmrs   r0, s0
+	__emit(0xE12FFF1E); // bx     lr
+}
+#pragma warning(pop)
+#else
+#error lrint needed for MSVC on non X86/AMD64/ARM targets.
+#endif
+#endif
+
+/*!
+\brief Draw anti-aliased ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the aa-ellipse.
+\param y Y coordinate of the center of the aa-ellipse.
+\param rx Horizontal radius in pixels of the aa-ellipse.
+\param ry Vertical radius in pixels of the aa-ellipse.
+\param color The color value of the aa-ellipse to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aaellipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aaellipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to tessellate an anti-aliased ellipse around the origin.
+
+\param tessellation The tessellation to add to.
+\param key The shape; rx and ry are the radii.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTessellateAAEllipse(SDL2_gfxTessellation *tessellation, const SDL2_gfxShape *key)
+{
+	int result;
+	int i;
+	int a2, b2, ds, dt, dxt, t, s, d;
+	Sint16 x = 0, y = 0;
+	Sint16 rx = key->rx, ry = key->ry;
+	Sint16 xp, yp, xs, ys, dyt, od, xx, yy, xc2, yc2;
+	float cp;
+	double sab;
+	Uint8 weight, iweight;
+
+	/* Variable setup */
+	a2 = rx * rx;
+	b2 = ry * ry;
+
+	ds = 2 * a2;
+	dt = 2 * b2;
+
+	xc2 = 2 * x;
+	yc2 = 2 * y;
+
+	sab = sqrt((double)(a2 + b2));
+	od = (Sint16)lrint(sab*0.01) + 1; /* introduce some overdraw */
+	dxt = (Sint16)lrint((double)a2 / sab) + od;
+
+	t = 0;
+	s = -2 * a2 * ry;
+	d = 0;
+
+	xp = x;
+	yp = y - ry;
+
+	/* Tessellate */
+	result = 0;
+
+	/* "End points" */
+	result |= _gfxTessellationWeightedPoint(tessellation, xp, yp, 256);
+	result |= _gfxTessellationWeightedPoint(tessellation, xc2 - xp, yp, 256);
+	result |= _gfxTessellationWeightedPoint(tessellation, xp, yc2 - yp, 256);
+	result |= _gfxTessellationWeightedPoint(tessellation, xc2 - xp, yc2 - yp, 256);
+
+	for (i = 1; i <= dxt; i++) {
+		xp--;
+		d += t - b2;
+
+		if (d >= 0)
+			ys = yp - 1;
+		else if ((d - s - a2) > 0) {
+			if ((2 * d - s - a2) >= 0)
+				ys = yp + 1;
+			else {
+				ys = yp;
+				yp++;
+				d -= s + a2;
+				s += ds;
+			}
+		} else {
+			yp++;
+			ys = yp + 1;
+			d -= s + a2;
+			s += ds;
+		}
+
+		t -= dt;
+
+		/* Calculate alpha */
+		if (s != 0) {
+			cp = (float) abs(d) / (float) abs(s);
+			if (cp > 1.0) {
+				cp = 1.0;
+			}
+		} else {
+			cp = 1.0;
+		}
+
+		/* Calculate weights */
+		weight = (Uint8) (cp * 255);
+		iweight = 255 - weight;
+
+		/* Upper half */
+		xx = xc2 - xp;
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, yp, iweight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yp, iweight);
+
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, ys, weight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, ys, weight);
+
+		/* Lower half */
+		yy = yc2 - yp;
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, yy, iweight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yy, iweight);
+
+		yy = yc2 - ys;
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, yy, weight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yy, weight);
+	}
+
+	/* Replaces original approximation code dyt = abs(yp - yc); */
+	dyt = (Sint16)lrint((double)b2 / sab ) + od;    
+
+	for (i = 1; i <= dyt; i++) {
+		yp++;
+		d -= s + a2;
+
+		if (d <= 0)
+			xs = xp + 1;
+		else if ((d + t - b2) < 0) {
+			if ((2 * d + t - b2) <= 0)
+				xs = xp - 1;
+			else {
+				xs = xp;
+				xp--;
+				d += t - b2;
+				t -= dt;
+			}
+		} else {
+			xp--;
+			xs = xp - 1;
+			d += t - b2;
+			t -= dt;
+		}
+
+		s += ds;
+
+		/* Calculate alpha */
+		if (t != 0) {
+			cp = (float) abs(d) / (float) abs(t);
+			if (cp > 1.0) {
+				cp = 1.0;
+			}
+		} else {
+			cp = 1.0;
+		}
+
+		/* Calculate weight */
+		weight = (Uint8) (cp * 255);
+		iweight = 255 - weight;
+
+		/* Left half */
+		xx = xc2 - xp;
+		yy = yc2 - yp;
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, yp, iweight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yp, iweight);
+
+		result |= _gfxTessellationWeightedPoint(tessellation, xp, yy, iweight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yy, iweight);
+
+		/* Right half */
+		xx = xc2 - xs;
+		result |= _gfxTessellationWeightedPoint(tessellation, xs, yp, weight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yp, weight);
+
+		result |= _gfxTessellationWeightedPoint(tessellation, xs, yy, weight);
+		result |= _gfxTessellationWeightedPoint(tessellation, xx, yy, weight);		
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal function to draw anti-aliased ellipse with blending.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the aa-ellipse.
+\param y Y coordinate of the center of the aa-ellipse.
+\param rx Horizontal radius in pixels of the aa-ellipse.
+\param ry Vertical radius in pixels of the aa-ellipse.
+\param r The red value of the aa-ellipse to draw. 
+\param g The green value of the aa-ellipse to draw. 
+\param b The blue value of the aa-ellipse to draw. 
+\param a The alpha value of the aa-ellipse to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aaellipseRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxShape key, tessellated;
+	const SDL2_gfxShape *shape;
+
+	/*
+	* Sanity check radii 
+	*/
+	if ((rx < 0) || (ry < 0)) {
+		return (-1);
+	}
+
+	/*
+	* Skip ellipses outside of the visible area, including the blended border
+	*/
+	if (_gfxCull(dst, x - rx - 1, y - ry - 1, x + rx + 1, y + ry + 1)) {
+		return (0);
+	}
+
+	/*
+	* Special cases for rx=0 and/or ry=0: draw a hline/vline/pixel 
+	*/
+	if (rx == 0) {
+		if (ry == 0) {
+			return (_pixelRGBA(dst, x, y, r, g, b, a));
+		} else {
+			return (_vlineRGBA(dst, x, y - ry, y + ry, r, g, b, a));
+		}
+	} else {
+		if (ry == 0) {
+			return (_hlineRGBA(dst, x - rx, x + rx, y, r, g, b, a));
+		}
+	}
+
+	/*
+	* Draw the weighted pixels of the ellipse 
+	*/
+	key.type = SDL2_GFX_SHAPE_AA_ELLIPSE;
+	key.rx = rx;
+	key.ry = ry;
+	key.start = 0;
+	key.end = 0;
+	key.filled = 0;
+	shape = _gfxGetShape(dst, &key, _gfxTessellateAAEllipse, &tessellated);
+	if (shape == NULL) {
+		return (-1);
+	}
+
+	return (_gfxDrawWeighted(dst, shape, x, y, r, g, b, a));
+}
+
+/*!
+\brief Draw anti-aliased ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the aa-ellipse.
+\param y Y coordinate of the center of the aa-ellipse.
+\param rx Horizontal radius in pixels of the aa-ellipse.
+\param ry Vertical radius in pixels of the aa-ellipse.
+\param r The red value of the aa-ellipse to draw. 
+\param g The green value of the aa-ellipse to draw. 
+\param b The blue value of the aa-ellipse to draw. 
+\param a The alpha value of the aa-ellipse to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aaellipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _aaellipseRGBA(&dst, x, y, rx, ry, r, g, b, a));
+}
+
+/* ---- Filled Ellipse */
+
+/*!
+\brief Draw filled ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled ellipse.
+\param y Y coordinate of the center of the filled ellipse.
+\param rx Horizontal radius in pixels of the filled ellipse.
+\param ry Vertical radius in pixels of the filled ellipse.
+\param color The color value of the filled ellipse to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledEllipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return filledEllipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw filled ellipse with blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled ellipse.
+\param y Y coordinate of the center of the filled ellipse.
+\param rx Horizontal radius in pixels of the filled ellipse.
+\param ry Vertical radius in pixels of the filled ellipse.
+\param r The red value of the filled ellipse to draw. 
+\param g The green value of the filled ellipse to draw. 
+\param b The blue value of the filled ellipse to draw. 
+\param a The alpha value of the filled ellipse to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledEllipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _ellipseRGBA(&dst, x, y, rx, ry, r, g, b, a, 1));
+}
+
+/* ----- Pie */
+
+/*!
+\brief Internal function to limit a row of a filled pie to the pixels X with a * X <= c.
+
+\param a The factor of the X coordinate.
+\param c The bound.
+\param lo First X coordinate of the row; updated.
+\param hi Last X coordinate of the row; updated. Becomes smaller than lo if no pixel is left.
+*/
+static void _gfxPieBound(Sint64 a, Sint64 c, int *lo, int *hi)
+{
+	Sint64 bound;
+
+	if (a == 0) {
+		if (c < 0) {
+			*lo = 1;
+			*hi = 0;
+		}
+	} else if (a > 0) {
+		bound = _gfxFloorDiv(c, a);
+		if (bound < *hi) {
+			*hi = (int)bound;
+		}
+	} else {
+		bound = -_gfxFloorDiv(c, -a);
+		if (bound > *lo) {
+			*lo = (int)bound;
+		}
+	}
+}
+
+/*!
+\brief Internal function to draw a filled pie in the current color.
+
+The rows of the circle are stepped incrementally and clipped against the two edges
+of the pie with integer half-plane tests, so neither trigonometry per pixel nor a
+polygon is needed. A pixel is drawn if its center lies within the circle, on or after
+the starting edge and before the ending edge, so pies sharing an edge do not overlap;
+the center pixel is always drawn.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie. Must be >0.
+\param start Starting angle in degrees of the pie.
+\param sweep Angle in degrees covered by the pie (1 to 359).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFilledPie(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, int start, int sweep)
+{
+	int result = 0;
+	SDL2_gfxSpans spans;
+	Sint64 sx, sy, ex, ey, r2;
+	int dy, row, side, half, lo, hi, elo, ehi;
+
+	/*
+	* Edge directions scaled by 2^30 
+	*/
+	sx = _gfxCos(start);
+	sy = _gfxSin(start);
+	ex = _gfxCos(start + sweep);
+	ey = _gfxSin(start + sweep);
+
+	_gfxBeginSpans(&spans, dst);
+	r2 = (Sint64)rad * rad + rad;
+	half = rad;
+	for (dy = 0; dy <= rad; dy++) {
+		/* Half width of the circle in this row */
+		while ((Sint64)half * half + (Sint64)dy * dy > r2) {
+			half--;
+		}
+
+		for (side = 0; side < 2; side++) {
+			row = (side) ? -dy : dy;
+			if (((side) && (dy == 0)) || (_gfxCull(dst, x - half, y + row, x + half, y + row))) {
+				continue;
+			}
+
+			lo = -half;
+			hi = half;
+			if (sweep >= 360) {
+				result |= _gfxSpan(&spans, x + lo, x + hi, y + row);
+			} else if (sweep <= 180) {
+				/* Pixels on or after the starting edge and before the ending edge */
+				_gfxPieBound(sy, sx * row, &lo, &hi);
+				_gfxPieBound(-ey, -ex * row - 1, &lo, &hi);
+				if (lo <= hi) {
+					result |= _gfxSpan(&spans, x + lo, x + hi, y + row);
+				}
+			} else {
+				/* Pixels except the ones before the starting edge and on or after the ending edge */
+				elo = lo;
+				ehi = hi;
+				_gfxPieBound(-sy, -sx * row - 1, &elo, &ehi);
+				_gfxPieBound(ey, ex * row, &elo, &ehi);
+				if (elo > ehi) {
+					result |= _gfxSpan(&spans, x + lo, x + hi, y + row);
+				} else {
+					if (elo > lo) {
+						result |= _gfxSpan(&spans, x + lo, x + elo - 1, y + row);
+					}
+					if (ehi < hi) {
+						result |= _gfxSpan(&spans, x + ehi + 1, x + hi, y + row);
+					}
+				}
+			}
+		}
+	}
+	if (!_gfxCull(dst, x, y, x, y)) {
+		/* Merged with the row of the center if it is already drawn */
+		result |= _gfxSpan(&spans, x, x, y);
+	}
+	result |= _gfxDrawSpans(dst, &spans);
+
+	return (result);
+}
+
+/*!
+\brief Internal function to draw a pie or filled pie.
+
+Filled pies are rasterized directly as circle rows clipped against the edges of
+the pie. Outlines are drawn as a polygon whose arc vertices are generated by
+rotating the first vertex, so only the first, the last and the step angle need
+trigonometry.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie.
+\param start Starting radius in degrees of the pie.
+\param end Ending radius in degrees of the pie.
+\param r The red value of the pie to draw. 
+\param g The green value of the pie to draw. 
+\param b The blue value of the pie to draw. 
+\param a The alpha value of the pie to draw.
+\param filled Flag indicating if the pie should be filled (=1) or not (=0).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _pieRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end,  Uint8 r, Uint8 g, Uint8 b, Uint8 a, Uint8 filled)
+{
+	int result;
+	double angle, start_angle, end_angle;
+	double deltaAngle;
+	double dr, c, s, cd, sd, t;
+	int numpoints, i, sweep;
+	Sint16 *vx, *vy;
+
+	/*
+	* Sanity check radii 
+	*/
+	if (rad < 0) {
+		return (-1);
+	}
+
+	/*
+	* Fixup angles
+	*/
+	start = start % 360;
+	end = end % 360;
+
+	/*
+	* Special case for rad=0 - draw a point 
+	*/
+	if (rad == 0) {
+		return (_pixelRGBA(dst, x, y, r, g, b, a));
+	}
+
+	/*
+	* Skip pies outside of the visible area
+	*/
+	if (_gfxCull(dst, x - rad, y - rad, x + rad, y + rad)) {
+		return (0);
+	}
+
+	/*
+	* Filled pies are drawn as clipped circle rows; a pie without angle is a line
+	*/
+	sweep = (end - start) % 360;
+	if (sweep < 0) {
+		sweep += 360;
+	}
+	if ((filled) && (sweep > 0)) {
+		result = _gfxColor(dst, r, g, b, a);
+		result |= _gfxFilledPie(dst, x, y, rad, start, sweep);
+		return (result);
+	}
+
+	/*
+	* Variable setup 
+	*/
+	dr = (double) rad;
+	deltaAngle = 3.0 / dr;
+	start_angle = (double) start *(2.0 * M_PI / 360.0);
+	end_angle = (double) end *(2.0 * M_PI / 360.0);
+	if (start > end) {
+		end_angle += (2.0 * M_PI);
+	}
+
+	/* We will always have at least 2 points */
+	numpoints = 2;
+
+	/* Count points (rather than calculating it) */
+	angle = start_angle;
+	while (angle < end_angle) {
+		angle += deltaAngle;
+		numpoints++;
+	}
+
+	/* Allocate combined vertex array */
+	vx = vy = (Sint16 *) _gfxScratch(&dst->context->vertices, 2 * sizeof(Uint16) * numpoints);
+	if (vx == NULL) {
+		return (-1);
+	}
+
+	/* Update point to start of vy */
+	vy += numpoints;
+
+	/* Center */
+	vx[0] = x;
+	vy[0] = y;
+
+	/* First vertex */
+	angle = start_angle;
+	c = cos(angle);
+	s = sin(angle);
+	vx[1] = x + (int) (dr * c);
+	vy[1] = y + (int) (dr * s);
+
+	if (numpoints<3)
+	{
+		result = _lineRGBA(dst, vx[0], vy[0], vx[1], vy[1], r, g, b, a);
+	}
+	else
+	{
+		/* Calculate other vertices by rotating the previous one; the last one is exact */
+		cd = cos(deltaAngle);
+		sd = sin(deltaAngle);
+		i = 2;
+		while (angle < end_angle) {
+			angle += deltaAngle;
+			if (angle>end_angle)
+			{
+				angle = end_angle;
+				c = cos(angle);
+				s = sin(angle);
+			} else {
+				t = c * cd - s * sd;
+				s = s * cd + c * sd;
+				c = t;
+			}
+			vx[i] = x + (int) (dr * c);
+			vy[i] = y + (int) (dr * s);
+			i++;
+		}
+
+		/* Draw */
+		result = _polygonRGBA(dst, vx, vy, numpoints, r, g, b, a);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Draw pie (outline) with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie.
+\param start Starting radius in degrees of the pie.
+\param end Ending radius in degrees of the pie.
+\param color The color value of the pie to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pieColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, 
+	Sint16 start, Sint16 end, Uint32 color) 
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return pieRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw pie (outline) with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie.
+\param start Starting radius in degrees of the pie.
+\param end Ending radius in degrees of the pie.
+\param r The red value of the pie to draw. 
+\param g The green value of the pie to draw. 
+\param b The blue value of the pie to draw. 
+\param a The alpha value of the pie to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int pieRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _pieRGBA(&dst, x, y, rad, start, end, r, g, b, a, 0));
+}
+
+/*!
+\brief Draw filled pie with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled pie.
+\param y Y coordinate of the center of the filled pie.
+\param rad Radius in pixels of the filled pie.
+\param start Starting radius in degrees of the filled pie.
+\param end Ending radius in degrees of the filled pie.
+\param color The color value of the filled pie to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPieColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return filledPieRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw filled pie with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled pie.
+\param y Y coordinate of the center of the filled pie.
+\param rad Radius in pixels of the filled pie.
+\param start Starting radius in degrees of the filled pie.
+\param end Ending radius in degrees of the filled pie.
+\param r The red value of the filled pie to draw. 
+\param g The green value of the filled pie to draw. 
+\param b The blue value of the filled pie to draw. 
+\param a The alpha value of the filled pie to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPieRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _pieRGBA(&dst, x, y, rad, start, end, r, g, b, a, 1));
+}
+
+/* ------ Trigon */
+
+/*!
+\brief Draw trigon (triangle outline) with alpha blending.
+
+Note: Creates vertex array and uses polygon routine to render.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the trigon.
+\param y1 Y coordinate of the first point of the trigon.
+\param x2 X coordinate of the second point of the trigon.
+\param y2 Y coordinate of the second point of the trigon.
+\param x3 X coordinate of the third point of the trigon.
+\param y3 Y coordinate of the third point of the trigon.
+\param color The color value of the trigon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int trigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(polygonColor(renderer,vx,vy,3,color));
+}
+
+/*!
+\brief Internal function to draw trigon (triangle outline) with alpha blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the trigon.
+\param y1 Y coordinate of the first point of the trigon.
+\param x2 X coordinate of the second point of the trigon.
+\param y2 Y coordinate of the second point of the trigon.
+\param x3 X coordinate of the third point of the trigon.
+\param y3 Y coordinate of the third point of the trigon.
+\param r The red value of the trigon to draw. 
+\param g The green value of the trigon to draw. 
+\param b The blue value of the trigon to draw. 
+\param a The alpha value of the trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _trigonRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(_polygonRGBA(dst,vx,vy,3,r,g,b,a));
+}
+
+/*!
+\brief Draw trigon (triangle outline) with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the trigon.
+\param y1 Y coordinate of the first point of the trigon.
+\param x2 X coordinate of the second point of the trigon.
+\param y2 Y coordinate of the second point of the trigon.
+\param x3 X coordinate of the third point of the trigon.
+\param y3 Y coordinate of the third point of the trigon.
+\param r The red value of the trigon to draw. 
+\param g The green value of the trigon to draw. 
+\param b The blue value of the trigon to draw. 
+\param a The alpha value of the trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int trigonRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _trigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+}
+			 
+
+/* ------ AA-Trigon */
+
+/*!
+\brief Draw anti-aliased trigon (triangle outline) with alpha blending.
+
+Note: Creates vertex array and uses aapolygon routine to render.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the aa-trigon.
+\param y1 Y coordinate of the first point of the aa-trigon.
+\param x2 X coordinate of the second point of the aa-trigon.
+\param y2 Y coordinate of the second point of the aa-trigon.
+\param x3 X coordinate of the third point of the aa-trigon.
+\param y3 Y coordinate of the third point of the aa-trigon.
+\param color The color value of the aa-trigon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aatrigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(aapolygonColor(renderer,vx,vy,3,color));
+}
+
+/*!
+\brief Internal function to draw anti-aliased trigon (triangle outline) with alpha blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the aa-trigon.
+\param y1 Y coordinate of the first point of the aa-trigon.
+\param x2 X coordinate of the second point of the aa-trigon.
+\param y2 Y coordinate of the second point of the aa-trigon.
+\param x3 X coordinate of the third point of the aa-trigon.
+\param y3 Y coordinate of the third point of the aa-trigon.
+\param r The red value of the aa-trigon to draw. 
+\param g The green value of the aa-trigon to draw. 
+\param b The blue value of the aa-trigon to draw. 
+\param a The alpha value of the aa-trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aatrigonRGBA(SDL2_gfxTarget *dst,  Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(_aapolygonRGBA(dst,vx,vy,3,r,g,b,a));
+}
+
+/*!
+\brief Draw anti-aliased trigon (triangle outline) with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the aa-trigon.
+\param y1 Y coordinate of the first point of the aa-trigon.
+\param x2 X coordinate of the second point of the aa-trigon.
+\param y2 Y coordinate of the second point of the aa-trigon.
+\param x3 X coordinate of the third point of the aa-trigon.
+\param y3 Y coordinate of the third point of the aa-trigon.
+\param r The red value of the aa-trigon to draw. 
+\param g The green value of the aa-trigon to draw. 
+\param b The blue value of the aa-trigon to draw. 
+\param a The alpha value of the aa-trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aatrigonRGBA(SDL_Renderer * renderer,  Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aatrigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+}
+			   
+
+/* ------ Filled Trigon */
+
+/*!
+\brief Draw filled trigon (triangle) with alpha blending.
+
+Note: Creates vertex array and uses aapolygon routine to render.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the filled trigon.
+\param y1 Y coordinate of the first point of the filled trigon.
+\param x2 X coordinate of the second point of the filled trigon.
+\param y2 Y coordinate of the second point of the filled trigon.
+\param x3 X coordinate of the third point of the filled trigon.
+\param y3 Y coordinate of the third point of the filled trigon.
+\param color The color value of the filled trigon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledTrigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(filledPolygonColor(renderer,vx,vy,3,color));
+}
+
+/*!
+\brief Internal function to draw filled trigon (triangle) with alpha blending.
+
+Note: Creates vertex array and uses aapolygon routine to render.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the filled trigon.
+\param y1 Y coordinate of the first point of the filled trigon.
+\param x2 X coordinate of the second point of the filled trigon.
+\param y2 Y coordinate of the second point of the filled trigon.
+\param x3 X coordinate of the third point of the filled trigon.
+\param y3 Y coordinate of the third point of the filled trigon.
+\param r The red value of the filled trigon to draw. 
+\param g The green value of the filled trigon to draw. 
+\param b The blue value of the filled trigon to draw. 
+\param a The alpha value of the filled trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledTrigonRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(_filledPolygonRGBA(dst,vx,vy,3,r,g,b,a));
+}
+
+/*!
+\brief Draw filled trigon (triangle) with alpha blending.
+
+Note: Creates vertex array and uses aapolygon routine to render.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the filled trigon.
+\param y1 Y coordinate of the first point of the filled trigon.
+\param x2 X coordinate of the second point of the filled trigon.
+\param y2 Y coordinate of the second point of the filled trigon.
+\param x3 X coordinate of the third point of the filled trigon.
+\param y3 Y coordinate of the third point of the filled trigon.
+\param r The red value of the filled trigon to draw. 
+\param g The green value of the filled trigon to draw. 
+\param b The blue value of the filled trigon to draw. 
+\param a The alpha value of the filled trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledTrigonRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledTrigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+}
+
+/* ---- Polygon */
+
+/*!
+\brief Draw polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the polygon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int polygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return polygonRGBA(renderer, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw polygon with the currently set color and blend mode.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _polygon(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n)
+{
+	/*
+	* Draw 
+	*/
+	int result = 0;
+	int i, nn;
+	SDL_Point* points;
+
+	/*
+	* Vertex array NULL check 
+	*/
+	if (vx == NULL) {
+		return (-1);
+	}
+	if (vy == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Sanity check 
+	*/
+	if (n < 3) {
+		return (-1);
+	}
+
+	/*
+	* Create array of points
+	*/
+	nn = n + 1;
+	points = (SDL_Point*)_gfxScratch(&dst->context->points, sizeof(SDL_Point) * nn);
+	if (points == NULL)
+	{
+		return -1;
+	}
+	for (i=0; i<n; i++)
+	{
+		points[i].x = vx[i];
+		points[i].y = vy[i];
+	}
+	points[n].x = vx[0];
+	points[n].y = vy[0];
+
+	/*
+	* Draw 
+	*/
+	result |= _gfxLines(dst, points, nn);
+
+	return (result);
+}
+
+/*!
+\brief Draw polygon with the currently set color and blend mode.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int polygon(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	dst.batch = NULL;
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _polygon(&dst, vx, vy, n));
+}
+
+/*!
+\brief Internal function to draw polygon with alpha blending.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the polygon to draw. 
+\param g The green value of the polygon to draw. 
+\param b The blue value of the polygon to draw. 
+\param a The alpha value of the polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _polygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	/*
+	* Draw 
+	*/
+	int result;
+	const Sint16 *x1, *y1, *x2, *y2;
+
+	/*
+	* Vertex array NULL check 
+	*/
+	if (vx == NULL) {
+		return (-1);
+	}
+	if (vy == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Sanity check 
+	*/
+	if (n < 3) {
+		return (-1);
+	}
+
+	/*
+	* Skip polygons outside of the visible area
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 0)) {
+		return (0);
+	}
+
+	/*
+	* Pointer setup 
+	*/
+	x1 = x2 = vx;
+	y1 = y2 = vy;
+	x2++;
+	y2++;
+
+	/*
+	* Set color 
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);	
+
+	/*
+	* Draw 
+	*/
+	result |= _polygon(dst, vx, vy, n);
+
+	return (result);
+}
+
+/*!
+\brief Draw polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the polygon to draw. 
+\param g The green value of the polygon to draw. 
+\param b The blue value of the polygon to draw. 
+\param a The alpha value of the polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int polygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _polygonRGBA(&dst, vx, vy, n, r, g, b, a));
+}
+
+/* ---- AA-Polygon */
+
+/*!
+\brief Draw anti-aliased polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the aa-polygon.
+\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the aa-polygon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aapolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aapolygonRGBA(renderer, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw anti-aliased polygon with alpha blending.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the aa-polygon.
+\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the aa-polygon to draw. 
+\param g The green value of the aa-polygon to draw. 
+\param b The blue value of the aa-polygon to draw. 
+\param a The alpha value of the aa-polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aapolygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	int i;
+	const Sint16 *x1, *y1, *x2, *y2;
+
+	/*
+	* Vertex array NULL check 
+	*/
+	if (vx == NULL) {
+		return (-1);
+	}
+	if (vy == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Sanity check 
+	*/
+	if (n < 3) {
+		return (-1);
+	}
+
+	/*
+	* Skip polygons outside of the visible area, including the blended border
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 1)) {
+		return (0);
+	}
+
+	/*
+	* Pointer setup 
+	*/
+	x1 = x2 = vx;
+	y1 = y2 = vy;
+	x2++;
+	y2++;
+
+	/*
+	* Draw 
+	*/
+	result = 0;
+	_gfxBeginCoverage(dst);
+	for (i = 1; i < n; i++) {
+		result |= _aalineRGBA(dst, *x1, *y1, *x2, *y2, r, g, b, a, 0);
+		x1 = x2;
+		y1 = y2;
+		x2++;
+		y2++;
+	}
+
+	result |= _aalineRGBA(dst, *x1, *y1, *vx, *vy, r, g, b, a, 0);
+	result |= _gfxEndCoverage(dst, r, g, b);
+
+	return (result);
+}
+
+/*!
+\brief Draw anti-aliased polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the aa-polygon.
+\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the aa-polygon to draw. 
+\param g The green value of the aa-polygon to draw. 
+\param b The blue value of the aa-polygon to draw. 
+\param a The alpha value of the aa-polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aapolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aapolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+}
+
+/* ---- Filled Polygon */
+
+/*!
+\brief Draws filled polygons as SDL_RenderGeometry triangles.
+
+Disabled by default. Define as 1 at compile time to draw filled polygons on renderers
+with SDL 2.0.18 or newer as triangles in one SDL_RenderGeometry call: convex polygons
+as a fan, other simple polygons ear-clipped. Self-intersecting and degenerate polygons
+and polygons drawn onto surfaces keep the scanline filler. Filled trigons and thick
+lines are drawn as polygons too. The triangles follow the fill rule of the renderer,
+which leaves out right and bottom boundary pixels the scanline filler draws, so they
+no longer cover the same pixels as texturedPolygon or the surface functions.
+*/
+#ifndef SDL2_GFX_TRIANGULATE_POLYGONS
+#define SDL2_GFX_TRIANGULATE_POLYGONS 0
+#endif
+
+/*!
+\brief Internal helper qsort callback functions used in filled polygon drawing.
+
+\param a The surface to draw on.
+\param b Vertex array containing X coordinates of the points of the polygon.
+
+\returns Returns 0 if a==b, a negative number if a<b or a positive number if a>b.
+*/
+int _gfxPrimitivesCompareInt(const void *a, const void *b)
+{
+	return (*(const int *) a) - (*(const int *) b);
+}
+
+/*!
+\brief Internal polygon edge used by the active edge table scanline filler.
+
+The edge runs from (x1,y1) to (x1+dx,y1+dy) with dy > 0. The X intersection is
+stepped with integer arithmetic only and matches the classic per-scanline
+formula ((65536*(y-y1))/dy)*dx + 65536*x1 exactly: q is the truncated
+quotient 65536*(y-y1)/dy and rem the matching remainder.
+
+All members are int so edges can be stored in the polyInts scratch array.
+*/
+typedef struct {
+	int y1, y2;
+	int x1, dx, dy;
+	int x;
+	int q, rem;
+	int qstep, remstep;
+} SDL2_gfxEdge;
+
+/*!
+\brief Number of ints of polygon scratch memory needed per vertex: one edge plus one active edge index.
+*/
+#define SDL2_GFX_EDGE_INTS ((int)(sizeof(SDL2_gfxEdge) / sizeof(int)) + 1)
+
+/*!
+\brief Internal helper qsort callback sorting polygon edges by their top Y coordinate.
+
+\param a The first edge.
+\param b The second edge.
+
+\returns Returns 0 if both edges start on the same row, a negative number if a starts above b or a positive number otherwise.
+*/
+static int _gfxCompareEdge(const void *a, const void *b)
+{
+	return ((const SDL2_gfxEdge *) a)->y1 - ((const SDL2_gfxEdge *) b)->y1;
+}
+
+/*!
+\brief Internal function to get the temporary polygon scratch array.
+
+Uses the array supplied by the caller if polyInts and polyAllocated are both
+given (the array is only ever grown), otherwise the scratch memory of the
+target context.
+
+\param dst The target to draw on.
+\param polyInts Preallocated, temporary array or NULL.
+\param polyAllocated Number of ints allocated in polyInts or NULL.
+\param size The number of ints required.
+
+\returns Returns the scratch array or NULL on failure.
+*/
+static int *_gfxPolyScratch(SDL2_gfxTarget *dst, int **polyInts, int *polyAllocated, int size)
+{
+	int *gfxPrimitivesPolyIntsNew = NULL;
+
+	if ((polyInts==NULL) || (polyAllocated==NULL)) {
+		return (int *) _gfxScratch(&dst->context->polyInts, sizeof(int) * size);
+	}
+
+	/*
+	* Allocate caller array, only grow array 
+	*/
+	if ((*polyInts == NULL) || (*polyAllocated < size)) {
+		gfxPrimitivesPolyIntsNew = (int *) realloc(*polyInts, sizeof(int) * size);
+		if (gfxPrimitivesPolyIntsNew == NULL) {
+			/* Realloc failed - keeps original memory block, but fails this operation */
+			return NULL;
+		}
+		SDL2_GFX_STATS_ADD(dst->context, bytesAllocated, sizeof(int) * (size - ((*polyInts == NULL) ? 0 : *polyAllocated)));
+		*polyInts = gfxPrimitivesPolyIntsNew;
+		*polyAllocated = size;
+	}
+
+	return *polyInts;
+}
+
+/*!
+\brief Internal function to check whether every scanline crosses a polygon in at most one span.
+
+Walking around the polygon, the Y direction of the non-horizontal edges may only
+change twice (once at the top and once at the bottom). All convex polygons like
+trigons, thick lines and boxes pass this test, as do many concave ones.
+
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array.
+
+\returns Returns 1 if the polygon is Y-monotone, 0 otherwise.
+*/
+static int _gfxMonotonePolygon(const Sint16 * vy, int n)
+{
+	int i, ind1;
+	int dir, first, last, changes;
+
+	first = 0;
+	last = 0;
+	changes = 0;
+	for (i = 0; (i < n); i++) {
+		ind1 = (i == 0) ? n - 1 : i - 1;
+		if (vy[ind1] == vy[i]) {
+			continue;
+		}
+		dir = (vy[ind1] < vy[i]) ? 1 : -1;
+		if (first == 0) {
+			first = dir;
+		} else if (dir != last) {
+			changes++;
+		}
+		last = dir;
+	}
+	if (first != last) {
+		changes++;
+	}
+
+	return (changes == 2);
+}
+
+/*!
+\brief Internal structure holding one side of a Y-monotone polygon while it is scanned.
+*/
+typedef struct {
+	SDL2_gfxEdge edge;
+	int v;
+	int step;
+} SDL2_gfxChain;
+
+/*!
+\brief Internal function to move a polygon side down to the edge crossing a row.
+
+Horizontal edges are skipped and an edge ending on the last row stays current
+for it, exactly like in the active edge table of _gfxFillPolygonSpans().
+
+\param c The polygon side; v is the top vertex of the current edge.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array.
+\param y The row.
+\param maxy The last row of the polygon.
+*/
+static void _gfxChainEdge(SDL2_gfxChain *c, const Sint16 * vx, const Sint16 * vy, int n, int y, int maxy)
+{
+	int next;
+	Sint64 dist;
+	SDL2_gfxEdge *e = &c->edge;
+
+	for (;;) {
+		next = c->v + c->step;
+		if (next >= n) {
+			next -= n;
+		}
+		if ((vy[next] > y) || ((vy[next] == maxy) && (vy[next] > vy[c->v]))) {
+			break;
+		}
+		c->v = next;
+	}
+
+	e->y1 = vy[c->v];
+	e->y2 = vy[next];
+	e->x1 = vx[c->v];
+	e->dx = vx[next] - vx[c->v];
+	e->dy = e->y2 - e->y1;
+	e->qstep = 65536 / e->dy;
+	e->remstep = 65536 % e->dy;
+	dist = (Sint64)65536 * (y - e->y1);
+	e->q = (int)(dist / e->dy);
+	e->rem = (int)(dist % e->dy);
+	e->x = e->q * e->dx + 65536 * e->x1;
+}
+
+/*!
+\brief Internal function to step a polygon edge to the next row.
+
+\param e The edge.
+*/
+static void _gfxStepEdge(SDL2_gfxEdge *e)
+{
+	e->q += e->qstep;
+	e->rem += e->remstep;
+	if (e->rem >= e->dy) {
+		e->q++;
+		e->rem -= e->dy;
+	}
+	e->x = e->q * e->dx + 65536 * e->x1;
+}
+
+/*!
+\brief Internal scanline filler for Y-monotone polygons.
+
+The two sides running down from the top vertex are followed edge by edge, so
+every row is one span between two edges without building, sorting or searching
+an edge table and without scratch memory. Spans are identical to the ones of
+the active edge table filler.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param span The callback drawing each span.
+\param data User data passed to the callback.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillMonotoneSpans(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n,
+	SDL2_gfxSpanFunc span, void *data)
+{
+	int result;
+	int i, top;
+	int y, xa, xb;
+	int miny, maxy, ystart, yend;
+	SDL2_gfxChain left, right;
+	SDL2_gfxEdge *ea, *eb;
+
+	top = 0;
+	maxy = vy[0];
+	for (i = 1; (i < n); i++) {
+		if (vy[i] < vy[top]) {
+			top = i;
+		} else if (vy[i] > maxy) {
+			maxy = vy[i];
+		}
+	}
+	miny = vy[top];
+
+	/*
+	* Only scan the visible rows
+	*/
+	ystart = miny;
+	yend = maxy;
+	if (dst->cull) {
+		ystart = SDL_max(ystart, dst->clip.y);
+		yend = SDL_min(yend, dst->clip.y + dst->clip.h - 1);
+	}
+	if (ystart > yend) {
+		return (0);
+	}
+
+	left.v = top;
+	left.step = 1;
+	right.v = top;
+	right.step = n - 1;
+	_gfxChainEdge(&left, vx, vy, n, ystart, maxy);
+	_gfxChainEdge(&right, vx, vy, n, ystart, maxy);
+
+	result = 0;
+	for (y = ystart; (y <= yend); y++) {
+		/*
+		* Switch to the next edge of a side at its bottom vertex
+		*/
+		if (y != maxy) {
+			if (left.edge.y2 <= y) {
+				_gfxChainEdge(&left, vx, vy, n, y, maxy);
+			}
+			if (right.edge.y2 <= y) {
+				_gfxChainEdge(&right, vx, vy, n, y, maxy);
+			}
+		}
+
+		if (left.edge.x <= right.edge.x) {
+			ea = &left.edge;
+			eb = &right.edge;
+		} else {
+			ea = &right.edge;
+			eb = &left.edge;
+		}
+		xa = ea->x + 1;
+		xa = (xa >> 16) + ((xa & 32768) >> 15);
+		xb = eb->x - 1;
+		xb = (xb >> 16) + ((xb & 32768) >> 15);
+		result |= span(dst, xa, xb, y, data);
+
+		_gfxStepEdge(&left.edge);
+		_gfxStepEdge(&right.edge);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal active edge table scanline filler shared by the filled and textured polygon functions.
+
+The non-horizontal edges are sorted once by their top row. While scanning, edges
+enter the active list when the scanline reaches their top and leave it past their
+bottom; the active list is kept sorted by insertion sort, which is linear for the
+nearly sorted lists produced by stepping. The cost is O((n+h) log n) instead of the
+O(n*h) of testing every edge on every scanline. Spans are identical to the ones of
+the previous per-scanline implementation. Rows outside of the visible area of the
+target are not scanned. Y-monotone polygons, which include all convex ones, are
+handed to _gfxFillMonotoneSpans() instead.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param polyInts Preallocated, temporary array used for the edge table or NULL.
+\param polyAllocated Number of ints allocated in polyInts or NULL.
+\param span The callback drawing each span.
+\param data User data passed to the callback.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillPolygonSpans(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n,
+	int **polyInts, int *polyAllocated, SDL2_gfxSpanFunc span, void *data)
+{
+	int result;
+	int i, j;
+	int y, xa, xb;
+	int miny, maxy, ystart, yend;
+	int ind1;
+	int edges, next, active;
+	Sint64 dist;
+	int *scratch;
+	int *aet;
+	SDL2_gfxEdge *et, *e;
+
+	if (_gfxMonotonePolygon(vy, n)) {
+		return _gfxFillMonotoneSpans(dst, vx, vy, n, span, data);
+	}
+
+	scratch = _gfxPolyScratch(dst, polyInts, polyAllocated, n * SDL2_GFX_EDGE_INTS);
+	if (scratch == NULL) {
+		return (-1);
+	}
+	et = (SDL2_gfxEdge *) scratch;
+	aet = scratch + n * (SDL2_GFX_EDGE_INTS - 1);
+
+	/*
+	* Build edge table, skipping horizontal edges
+	*/
+	miny = vy[0];
+	maxy = vy[0];
+	edges = 0;
+	for (i = 0; (i < n); i++) {
+		if (vy[i] < miny) {
+			miny = vy[i];
+		} else if (vy[i] > maxy) {
+			maxy = vy[i];
+		}
+		ind1 = (i == 0) ? n - 1 : i - 1;
+		if (vy[ind1] == vy[i]) {
+			continue;
+		}
+		e = &et[edges++];
+		if (vy[ind1] < vy[i]) {
+			e->y1 = vy[ind1];
+			e->y2 = vy[i];
+			e->x1 = vx[ind1];
+			e->dx = vx[i] - vx[ind1];
+		} else {
+			e->y1 = vy[i];
+			e->y2 = vy[ind1];
+			e->x1 = vx[i];
+			e->dx = vx[ind1] - vx[i];
+		}
+		e->dy = e->y2 - e->y1;
+		e->q = 0;
+		e->rem = 0;
+		e->qstep = 65536 / e->dy;
+		e->remstep = 65536 % e->dy;
+		e->x = 65536 * e->x1;
+	}
+	qsort(et, edges, sizeof(SDL2_gfxEdge), _gfxCompareEdge);
+
+	/*
+	* Only scan the visible rows
+	*/
+	ystart = miny;
+	yend = maxy;
+	if (dst->cull) {
+		ystart = SDL_max(ystart, dst->clip.y);
+		yend = SDL_min(yend, dst->clip.y + dst->clip.h - 1);
+	}
+	if (ystart > yend) {
+		return (0);
+	}
+
+	/*
+	* Start the edges crossing the first visible row where they would be after stepping
+	*/
+	next = 0;
+	active = 0;
+	while ((next < edges) && (et[next].y1 < ystart)) {
+		e = &et[next];
+		if ((e->y2 > ystart) || ((ystart == maxy) && (e->y2 == maxy))) {
+			dist = (Sint64)65536 * (ystart - e->y1);
+			e->q = (int)(dist / e->dy);
+			e->rem = (int)(dist % e->dy);
+			e->x = e->q * e->dx + 65536 * e->x1;
+			aet[active++] = next;
+		}
+		next++;
+	}
+
+	/*
+	* Draw, scanning y 
+	*/
+	result = 0;
+	for (y = ystart; (y <= yend); y++) {
+		/*
+		* Retire finished edges; edges ending on the last row stay active for it
+		*/
+		if (y != maxy) {
+			for (i = 0, j = 0; (i < active); i++) {
+				if (et[aet[i]].y2 > y) {
+					aet[j++] = aet[i];
+				}
+			}
+			active = j;
+		}
+
+		/*
+		* Add edges starting on this row
+		*/
+		while ((next < edges) && (et[next].y1 == y)) {
+			aet[active++] = next++;
+		}
+
+		/*
+		* Keep the active list sorted by X (insertion sort)
+		*/
+		for (i = 1; (i < active); i++) {
+			ind1 = aet[i];
+			for (j = i; (j > 0) && (et[aet[j - 1]].x > et[ind1].x); j--) {
+				aet[j] = aet[j - 1];
+			}
+			aet[j] = ind1;
+		}
+
+		for (i = 0; (i + 1 < active); i += 2) {
+			xa = et[aet[i]].x + 1;
+			xa = (xa >> 16) + ((xa & 32768) >> 15);
+			xb = et[aet[i+1]].x - 1;
+			xb = (xb >> 16) + ((xb & 32768) >> 15);
+			result |= span(dst, xa, xb, y, data);
+		}
+
+		/*
+		* Step active edges to the next row
+		*/
+		for (i = 0; (i < active); i++) {
+			_gfxStepEdge(&et[aet[i]]);
+		}
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal span callback for solid filled polygons.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data The span list collecting the spans.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFilledSpan(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data)
+{
+	if (_gfxCull(dst, SDL_min(xa, xb), y, SDL_max(xa, xb), y)) {
+		return 0;
+	}
+	return _gfxSpan((SDL2_gfxSpans *)data, xa, xb, y);
+}
+
+#if defined(SDL2_GFX_HAVE_GEOMETRY) && SDL2_GFX_TRIANGULATE_POLYGONS
+/*!
+\brief Internal function to get twice the signed area of a triangle.
+
+\returns Returns a positive value for clockwise (on screen) corners, a negative one for counterclockwise ones and 0 for collinear points.
+*/
+static Sint64 _gfxCross(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+	return (Sint64)(x2 - x1) * (y3 - y1) - (Sint64)(y2 - y1) * (x3 - x1);
+}
+
+/*!
+\brief Internal function to check whether two polygon edges touch or cross.
+
+\returns Returns 1 if the closed segments have a point in common, 0 otherwise.
+*/
+static int _gfxEdgesTouch(int ax, int ay, int bx, int by, int cx, int cy, int dx, int dy)
+{
+	Sint64 d1, d2, d3, d4;
+
+	d1 = _gfxCross(cx, cy, dx, dy, ax, ay);
+	d2 = _gfxCross(cx, cy, dx, dy, bx, by);
+	d3 = _gfxCross(ax, ay, bx, by, cx, cy);
+	d4 = _gfxCross(ax, ay, bx, by, dx, dy);
+	if ((((d1 > 0) && (d2 < 0)) || ((d1 < 0) && (d2 > 0))) && (((d3 > 0) && (d4 < 0)) || ((d3 < 0) && (d4 > 0)))) {
+		return 1;
+	}
+
+	/* Collinear end points on the other segment */
+	if ((d1 == 0) && (SDL_min(cx, dx) <= ax) && (ax <= SDL_max(cx, dx)) && (SDL_min(cy, dy) <= ay) && (ay <= SDL_max(cy, dy))) {
+		return 1;
+	}
+	if ((d2 == 0) && (SDL_min(cx, dx) <= bx) && (bx <= SDL_max(cx, dx)) && (SDL_min(cy, dy) <= by) && (by <= SDL_max(cy, dy))) {
+		return 1;
+	}
+	if ((d3 == 0) && (SDL_min(ax, bx) <= cx) && (cx <= SDL_max(ax, bx)) && (SDL_min(ay, by) <= cy) && (cy <= SDL_max(ay, by))) {
+		return 1;
+	}
+	if ((d4 == 0) && (SDL_min(ax, bx) <= dx) && (dx <= SDL_max(ax, bx)) && (SDL_min(ay, by) <= dy) && (dy <= SDL_max(ay, by))) {
+		return 1;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to check whether a polygon is simple.
+
+Non-adjacent edges may not touch, and adjacent edges may not fold back onto each other.
+
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array.
+
+\returns Returns 1 if the polygon is simple, 0 otherwise.
+*/
+static int _gfxSimplePolygon(const Sint16 * vx, const Sint16 * vy, int n)
+{
+	int i, j, i1, j1;
+
+	for (i = 0; i < n; i++) {
+		i1 = (i + 1) % n;
+		j1 = (i1 + 1) % n;
+		if ((vx[i] == vx[i1]) && (vy[i] == vy[i1])) {
+			return 0;
+		}
+		if ((_gfxCross(vx[i], vy[i], vx[i1], vy[i1], vx[j1], vy[j1]) == 0) &&
+			((Sint64)(vx[i1] - vx[i]) * (vx[j1] - vx[i1]) + (Sint64)(vy[i1] - vy[i]) * (vy[j1] - vy[i1]) < 0)) {
+			return 0;
+		}
+		for (j = i + 2; j < n; j++) {
+			j1 = (j + 1) % n;
+			if (j1 == i) {
+				continue;
+			}
+			if (_gfxEdgesTouch(vx[i], vy[i], vx[i1], vy[i1], vx[j], vy[j], vx[j1], vy[j1])) {
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+/*!
+\brief Internal function to triangulate a simple polygon.
+
+Convex polygons, whose corners all turn the same way and whose rows are crossed
+by a single span, become a triangle fan. Other polygons are checked to be simple
+and ear-clipped: a corner turning the way of the polygon whose triangle holds no
+other remaining vertex is cut off until a triangle is left.
+
+\param geometry The geometry to add the triangles to; room for n vertices must have been reserved.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array.
+\param color The color of the vertices.
+\param remaining Array of n ints used as temporary memory.
+
+\returns Returns 0 on success, -1 on failure and 1 if the polygon is self-intersecting or degenerate.
+*/
+static int _gfxTriangulatePolygon(SDL2_gfxGeometry *geometry, const Sint16 * vx, const Sint16 * vy, int n, SDL_Color color, int *remaining)
+{
+	int i, j, m, v, base, prev, cur, next, inside, sign, turns;
+	Sint64 area, cross;
+
+	/*
+	* Orientation; polygons without area are left to the scanline filler
+	*/
+	area = 0;
+	for (i = 0; i < n; i++) {
+		j = (i + 1) % n;
+		area += (Sint64)vx[i] * vy[j] - (Sint64)vx[j] * vy[i];
+	}
+	if (area == 0) {
+		return 1;
+	}
+	sign = (area > 0) ? 1 : -1;
+
+	/*
+	* Convex polygons
+	*/
+	turns = 0;
+	for (i = 0; i < n; i++) {
+		cross = _gfxCross(vx[(i + n - 1) % n], vy[(i + n - 1) % n], vx[i], vy[i], vx[(i + 1) % n], vy[(i + 1) % n]);
+		if (cross * sign < 0) {
+			break;
+		}
+		turns++;
+	}
+	if ((turns == n) && (_gfxMonotonePolygon(vy, n))) {
+		if (_gfxReserveGeometry(geometry, n, 3 * (n - 2))) {
+			return -1;
+		}
+		base = geometry->numVertices;
+		for (i = 0; i < n; i++) {
+			_gfxGeometryVertex(geometry, (float)vx[i] + 0.5f, (float)vy[i] + 0.5f, 0.0f, 0.0f, color);
+		}
+		for (i = 1; i + 1 < n; i++) {
+			_gfxGeometryTriangle(geometry, base, base + i, base + i + 1);
+		}
+		return 0;
+	}
+
+	/*
+	* Ear clipping of simple polygons
+	*/
+	if (!_gfxSimplePolygon(vx, vy, n)) {
+		return 1;
+	}
+	if (_gfxReserveGeometry(geometry, n, 3 * (n - 2))) {
+		return -1;
+	}
+	base = geometry->numVertices;
+	for (i = 0; i < n; i++) {
+		_gfxGeometryVertex(geometry, (float)vx[i] + 0.5f, (float)vy[i] + 0.5f, 0.0f, 0.0f, color);
+		remaining[i] = i;
+	}
+	m = n;
+	i = 0;
+	turns = 0;
+	while (m > 3) {
+		prev = remaining[(i + m - 1) % m];
+		cur = remaining[i];
+		next = remaining[(i + 1) % m];
+		cross = _gfxCross(vx[prev], vy[prev], vx[cur], vy[cur], vx[next], vy[next]);
+		inside = (cross * sign < 0);
+		for (j = 0; (j < m) && (!inside) && (cross != 0); j++) {
+			v = remaining[j];
+			if ((v == prev) || (v == cur) || (v == next)) {
+				continue;
+			}
+			inside = (_gfxCross(vx[prev], vy[prev], vx[cur], vy[cur], vx[v], vy[v]) * sign >= 0) &&
+				(_gfxCross(vx[cur], vy[cur], vx[next], vy[next], vx[v], vy[v]) * sign >= 0) &&
+				(_gfxCross(vx[next], vy[next], vx[prev], vy[prev], vx[v], vy[v]) * sign >= 0);
+		}
+		if (inside) {
+			/* No ear after a whole round: leave the polygon to the scanline filler */
+			if (++turns > m) {
+				return 1;
+			}
+			i = (i + 1) % m;
+			continue;
+		}
+
+		/* Cut off the ear; a straight corner is dropped without a triangle */
+		if (cross != 0) {
+			_gfxGeometryTriangle(geometry, base + prev, base + cur, base + next);
+		}
+		for (j = i; j + 1 < m; j++) {
+			remaining[j] = remaining[j + 1];
+		}
+		m--;
+		i = (i == 0) ? 0 : i - 1;
+		if (i >= m) {
+			i = 0;
+		}
+		turns = 0;
+	}
+	if (_gfxCross(vx[remaining[0]], vy[remaining[0]], vx[remaining[1]], vy[remaining[1]], vx[remaining[2]], vy[remaining[2]]) != 0) {
+		_gfxGeometryTriangle(geometry, base + remaining[0], base + remaining[1], base + remaining[2]);
+	}
+
+	return 0;
+}
+#endif
+
+/*!
+\brief Internal function to draw filled polygon with alpha blending (multi-threaded capable).
+
+Note: The last two parameters are optional. Without them the scratch memory of the current
+context is used, so threads drawing concurrently only need their own context (see gfxSetContext).
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filled polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+\param polyInts Preallocated, temporary array used for the polygon edges; set to NULL to use the current context.
+\param polyAllocated Number of ints allocated in polyInts; set to NULL to use the current context.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledPolygonRGBAMT(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a, int **polyInts, int *polyAllocated)
+{
+	int result;
+	SDL2_gfxSpans spans;
+#if defined(SDL2_GFX_HAVE_GEOMETRY) && SDL2_GFX_TRIANGULATE_POLYGONS
+	SDL2_gfxGeometry geometry;
+	SDL_Color color;
+	int *remaining;
+#endif
+
+	/*
+	* Vertex array NULL check 
+	*/
+	if (vx == NULL) {
+		return (-1);
+	}
+	if (vy == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Sanity check number of edges
+	*/
+	if (n < 3) {
+		return -1;
+	}
+
+	/*
+	* Skip polygons outside of the visible area
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 0)) {
+		return (0);
+	}
+
+#if defined(SDL2_GFX_HAVE_GEOMETRY) && SDL2_GFX_TRIANGULATE_POLYGONS
+	/*
+	* Simple polygons are triangles drawn with one call
+	*/
+	if (!dst->surface) {
+		remaining = _gfxPolyScratch(dst, polyInts, polyAllocated, n);
+		if (remaining == NULL) {
+			return (-1);
+		}
+		color.r = r;
+		color.g = g;
+		color.b = b;
+		color.a = a;
+		_gfxBeginGeometry(&geometry, dst);
+		result = _gfxTriangulatePolygon(&geometry, vx, vy, n, color, remaining);
+		if (result <= 0) {
+			if ((result == 0) && (geometry.numIndices > 0)) {
+				/* Flush first, so the batch does not change the blend mode set here */
+				if (dst->batch) {
+					result |= gfxFlushBatch(dst->batch);
+				}
+				result |= _gfxSetBlendMode(dst->renderer, dst->state, (a != 255) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+				result |= _gfxGeometry(dst, NULL, geometry.vertices, geometry.numVertices, geometry.indices, geometry.numIndices);
+			}
+			return (result);
+		}
+	}
+#endif
+
+	/*
+	* Collect the spans, then set color once and fill them all with one call
+	*/
+	_gfxBeginSpans(&spans, dst);
+	result = _gfxFillPolygonSpans(dst, vx, vy, n, polyInts, polyAllocated, _gfxFilledSpan, &spans);
+	if (spans.numRects > 0) {
+		result |= _gfxColor(dst, r, g, b, a);
+		result |= _gfxFillRects(dst, spans.rects, spans.numRects);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Draw filled polygon with alpha blending (multi-threaded capable).
+
+Note: The last two parameters are optional. Without them the scratch memory of the current
+context is used, so threads drawing concurrently only need their own context (see gfxSetContext).
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filled polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+\param polyInts Preallocated, temporary array used for the polygon edges; set to NULL to use the current context.
+\param polyAllocated Number of ints allocated in polyInts; set to NULL to use the current context.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonRGBAMT(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a, int **polyInts, int *polyAllocated)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledPolygonRGBAMT(&dst, vx, vy, n, r, g, b, a, polyInts, polyAllocated));
+}
+
+/*!
+\brief Draw filled polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the filled polygon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return filledPolygonRGBAMT(renderer, vx, vy, n, c[0], c[1], c[2], c[3], NULL, NULL);
+}
+
+/*!
+\brief Internal function to draw filled polygon with alpha blending.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filed polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledPolygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	return _filledPolygonRGBAMT(dst, vx, vy, n, r, g, b, a, NULL, NULL);
+}
+
+/*!
+\brief Draw filled polygon with alpha blending.
+
+The polygon is scanned into one horizontal span per row and crossing, and the spans
+are drawn with a single SDL_RenderFillRects call. texturedPolygon builds its geometry
+from the same spans, so both cover the same pixels. Compiled with
+SDL2_GFX_TRIANGULATE_POLYGONS, simple polygons (and the trigons and thick lines drawn
+as polygons) are drawn as triangles with one SDL_RenderGeometry call instead, whose
+fill rule leaves out the right and bottom boundary pixels of the scanline filler.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filed polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledPolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+}
+
+/* ---- AA-Filled Polygon */
+
+/*!
+\brief A pixel crossed by the edges of an anti-aliased filled polygon.
+
+The area is the signed part of the pixel covered by the edges crossing it, the cover
+the signed height of the edges which also applies to all pixels right of it.
+*/
+typedef struct {
+	int x, y;
+	float area, cover;
+} SDL2_gfxCell;
+
+/*!
+\brief The cells of an anti-aliased filled polygon in the scratch memory of a context.
+
+Only the rows top to bottom are collected; cells left of the column left are
+combined into the column before it and cells right of the column right are
+dropped since they cannot change a visible pixel.
+*/
+typedef struct {
+	SDL2_gfxScratch *scratch;
+	SDL2_gfxCell *cells;
+	int numCells;
+	int left, top, right, bottom;
+	int minY, maxY;
+} SDL2_gfxCells;
+
+/*!
+\brief Internal function to add the coverage of an edge to a pixel.
+
+\param cells The cell list.
+\param x X coordinate of the pixel.
+\param y Y coordinate of the pixel.
+\param area Signed area of the pixel covered by the edge.
+\param cover Signed height of the edge within the pixel.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCell(SDL2_gfxCells *cells, int x, int y, float area, float cover)
+{
+	SDL2_gfxCell *cell;
+
+	cells->cells = (SDL2_gfxCell *)_gfxScratch(cells->scratch, sizeof(SDL2_gfxCell) * (cells->numCells + 1));
+	if (cells->cells == NULL) {
+		return -1;
+	}
+	cell = &cells->cells[cells->numCells++];
+	cell->x = x;
+	cell->y = y;
+	cell->area = area;
+	cell->cover = cover;
+	if (y < cells->minY) {
+		cells->minY = y;
+	}
+	if (y > cells->maxY) {
+		cells->maxY = y;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add the part of an edge within one row to the cell list.
+
+The edge is split at the pixel boundaries; each piece covers the part of its pixel
+right of it and all pixels further right.
+
+\param cells The cell list.
+\param y Y coordinate of the row.
+\param xa X coordinate where the edge enters the row.
+\param xb X coordinate where the edge leaves the row.
+\param dy Signed height of the edge within the row.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCellRow(SDL2_gfxCells *cells, int y, float xa, float xb, float dy)
+{
+	int result = 0;
+	int x, xend;
+	float t, dydx, h, xn;
+
+	if (xa > xb) {
+		t = xa;
+		xa = xb;
+		xb = t;
+	}
+
+	/*
+	* Vertical or within one pixel 
+	*/
+	x = (int)floor(xa);
+	xend = (int)floor(xb);
+	if (x == xend) {
+		if (x < cells->left) {
+			return _gfxCell(cells, cells->left - 1, y, dy, dy);
+		} else if (x > cells->right) {
+			return 0;
+		}
+		return _gfxCell(cells, x, y, dy * (1.0f - ((xa + xb) * 0.5f - x)), dy);
+	}
+
+	/*
+	* Pixels left and right of the visible columns 
+	*/
+	dydx = dy / (xb - xa);
+	if (xa < cells->left) {
+		xn = (xb < cells->left) ? xb : (float)cells->left;
+		h = (xn - xa) * dydx;
+		result |= _gfxCell(cells, cells->left - 1, y, h, h);
+		xa = xn;
+		x = cells->left;
+	}
+	if (xb > cells->right + 1) {
+		xb = (float)(cells->right + 1);
+		xend = cells->right;
+	}
+
+	/*
+	* Step through the crossed pixels 
+	*/
+	for (; (x <= xend) && (xa < xb); x++) {
+		xn = (xb < x + 1) ? xb : (float)(x + 1);
+		h = (xn - xa) * dydx;
+		result |= _gfxCell(cells, x, y, h * (1.0f - ((xa + xn) * 0.5f - x)), h);
+		xa = xn;
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to add an edge to the cell list.
+
+\param cells The cell list.
+\param x0 X coordinate of the first point of the edge.
+\param y0 Y coordinate of the first point of the edge.
+\param x1 X coordinate of the second point of the edge.
+\param y1 Y coordinate of the second point of the edge.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCellEdge(SDL2_gfxCells *cells, float x0, float y0, float x1, float y1)
+{
+	int result = 0;
+	int y, yend;
+	float dir, t, dxdy, ya, yb;
+
+	if (y0 == y1) {
+		return 0;
+	}
+	dir = 1.0f;
+	if (y0 > y1) {
+		t = x0;
+		x0 = x1;
+		x1 = t;
+		t = y0;
+		y0 = y1;
+		y1 = t;
+		dir = -1.0f;
+	}
+	dxdy = (x1 - x0) / (y1 - y0);
+
+	y = (int)floor(y0);
+	yend = (int)ceil(y1) - 1;
+	if (y < cells->top) {
+		y = cells->top;
+	}
+	if (yend > cells->bottom) {
+		yend = cells->bottom;
+	}
+	for (; y <= yend; y++) {
+		ya = (y0 > y) ? y0 : (float)y;
+		yb = (y1 < y + 1) ? y1 : (float)(y + 1);
+		if (ya < yb) {
+			result |= _gfxCellRow(cells, y, x0 + (ya - y0) * dxdy, x0 + (yb - y0) * dxdy, (yb - ya) * dir);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal helper qsort callback sorting the cells of a row by column.
+
+\param a The first cell.
+\param b The second cell.
+
+\returns Returns a negative, zero or positive value as for qsort.
+*/
+static int _gfxCompareCell(const void *a, const void *b)
+{
+	const SDL2_gfxCell *ca = (const SDL2_gfxCell *)a;
+	const SDL2_gfxCell *cb = (const SDL2_gfxCell *)b;
+
+	if (ca->x != cb->x) {
+		return (ca->x < cb->x) ? -1 : 1;
+	}
+	return 0;
+}
+
+/*!
+\brief Internal function to sort the cells by row and column.
+
+The cells are distributed into their rows with a counting sort. The cells of an
+edge within a row are already in order, so short rows are sorted by insertion.
+
+\param cells The cell list.
+
+\returns Returns the sorted cells or NULL on failure.
+*/
+static SDL2_gfxCell *_gfxSortCells(SDL2_gfxCells *cells)
+{
+	SDL2_gfxCell *sorted, cell;
+	int *end;
+	int rows, row, i, j, first;
+
+	/*
+	* Cells, sorted cells and row ends share the scratch memory 
+	*/
+	rows = cells->maxY - cells->minY + 1;
+	cells->cells = (SDL2_gfxCell *)_gfxScratch(cells->scratch, sizeof(SDL2_gfxCell) * 2 * cells->numCells + sizeof(int) * (rows + 1));
+	if (cells->cells == NULL) {
+		return NULL;
+	}
+	sorted = cells->cells + cells->numCells;
+	end = (int *)(sorted + cells->numCells);
+
+	/*
+	* Counting sort by row 
+	*/
+	memset(end, 0, sizeof(int) * (rows + 1));
+	for (i = 0; i < cells->numCells; i++) {
+		end[cells->cells[i].y - cells->minY + 1]++;
+	}
+	for (row = 1; row <= rows; row++) {
+		end[row] += end[row - 1];
+	}
+	for (i = 0; i < cells->numCells; i++) {
+		sorted[end[cells->cells[i].y - cells->minY]++] = cells->cells[i];
+	}
+
+	/*
+	* Sort the rows by column; end[row] is now the end of each row 
+	*/
+	first = 0;
+	for (row = 0; row < rows; row++) {
+		if (end[row] - first > 16) {
+			qsort(&sorted[first], end[row] - first, sizeof(SDL2_gfxCell), _gfxCompareCell);
+		} else {
+			for (i = first + 1; i < end[row]; i++) {
+				cell = sorted[i];
+				for (j = i; (j > first) && (sorted[j - 1].x > cell.x); j--) {
+					sorted[j] = sorted[j - 1];
+				}
+				sorted[j] = cell;
+			}
+		}
+		first = end[row];
+	}
+
+	return sorted;
+}
+
+/*!
+\brief Internal function to convert an accumulated signed coverage into an alpha level.
+
+Overlapping parts of the polygon cancel out like in filledPolygonRGBA (even-odd rule).
+
+\param coverage The accumulated coverage.
+
+\returns Returns the coverage as level from 0 to 255.
+*/
+static int _gfxCoverageLevel(float coverage)
+{
+	coverage = (float)fmod(fabs(coverage), 2.0);
+	if (coverage > 1.0f) {
+		coverage = 2.0f - coverage;
+	}
+
+	return (int)(coverage * 255.0f + 0.5f);
+}
+
+/*!
+\brief Internal function to draw a run of pixels of an anti-aliased filled polygon.
+
+Fully covered runs are added to the span list, partially covered pixels are
+collected by alpha level.
+
+\param dst The target to draw on.
+\param spans The span list of the fully covered pixels.
+\param x1 X coordinate of the first pixel.
+\param x2 X coordinate of the last pixel.
+\param y Y coordinate of the run.
+\param level The coverage of the pixels (0 to 255).
+\param r The red value of the polygon.
+\param g The green value of the polygon.
+\param b The blue value of the polygon.
+\param a The alpha value of the polygon.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxCoverageRun(SDL2_gfxTarget *dst, SDL2_gfxSpans *spans, int x1, int x2, int y, int level, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	int x;
+	Uint8 alpha;
+
+	if ((x1 > x2) || (level <= 0)) {
+		return 0;
+	}
+	if (level >= 255) {
+		return _gfxSpan(spans, x1, x2, y);
+	}
+
+	alpha = (Uint8)((a * level + 127) / 255);
+	if (alpha == 0) {
+		return 0;
+	}
+	for (x = x1; x <= x2; x++) {
+		if (dst->coverage) {
+			result |= _gfxCoverage(dst, x, y, alpha);
+		} else {
+			result |= _gfxColor(dst, r, g, b, alpha);
+			result |= _gfxPixel(dst, x, y);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw an anti-aliased filled polygon with alpha blending.
+
+The edges are accumulated into sparse cells per row holding their signed area
+and cover. Each row is then drawn as fully covered spans with a single fill plus
+the partially covered pixels along the edges, so no pixel is blended twice.
+The vertices are at the pixel centers like for the other primitives.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filled polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aafilledPolygonRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	int i, j, x, y, last;
+	float coverage, area, cover;
+	SDL2_gfxCells cells;
+	SDL2_gfxSpans spans;
+	SDL2_gfxCell *cell;
+
+	/*
+	* Vertex array NULL check 
+	*/
+	if (vx == NULL) {
+		return (-1);
+	}
+	if (vy == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Sanity check number of edges
+	*/
+	if (n < 3) {
+		return -1;
+	}
+
+	/*
+	* Skip polygons outside of the visible area, including the blended border
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 1)) {
+		return (0);
+	}
+
+	/*
+	* Collect the cells of the visible rows 
+	*/
+	cells.scratch = &dst->context->cells;
+	cells.cells = (SDL2_gfxCell *)cells.scratch->data;
+	cells.numCells = 0;
+	if (dst->cull) {
+		cells.left = dst->clip.x;
+		cells.top = dst->clip.y;
+		cells.right = dst->clip.x + dst->clip.w - 1;
+		cells.bottom = dst->clip.y + dst->clip.h - 1;
+	} else {
+		cells.left = cells.top = -32769;
+		cells.right = cells.bottom = 32768;
+	}
+	cells.minY = cells.bottom;
+	cells.maxY = cells.top;
+	result = 0;
+	for (i = 0; i < n; i++) {
+		j = (i + 1 < n) ? i + 1 : 0;
+		result |= _gfxCellEdge(&cells, vx[i] + 0.5f, vy[i] + 0.5f, vx[j] + 0.5f, vy[j] + 0.5f);
+	}
+	if ((result) || (cells.numCells == 0)) {
+		return (result);
+	}
+	cell = _gfxSortCells(&cells);
+	if (cell == NULL) {
+		return (-1);
+	}
+
+	/*
+	* Accumulate the rows into spans and partially covered pixels 
+	*/
+	_gfxBeginSpans(&spans, dst);
+	_gfxBeginCoverage(dst);
+	for (i = 0; i < cells.numCells; ) {
+		y = cell[i].y;
+		last = cell[i].x - 1;
+		coverage = 0.0f;
+		while ((i < cells.numCells) && (cell[i].y == y)) {
+			/* Combine all cells of a pixel */
+			x = cell[i].x;
+			area = 0.0f;
+			cover = 0.0f;
+			while ((i < cells.numCells) && (cell[i].y == y) && (cell[i].x == x)) {
+				area += cell[i].area;
+				cover += cell[i].cover;
+				i++;
+			}
+
+			/* Pixels between the previous cell and this one, then this pixel */
+			result |= _gfxCoverageRun(dst, &spans, last + 1, x - 1, y, _gfxCoverageLevel(coverage), r, g, b, a);
+			result |= _gfxCoverageRun(dst, &spans, x, x, y, _gfxCoverageLevel(coverage + area), r, g, b, a);
+			coverage += cover;
+			last = x;
+		}
+
+		/* Pixels up to the edges dropped right of the visible columns */
+		result |= _gfxCoverageRun(dst, &spans, last + 1, cells.right, y, _gfxCoverageLevel(coverage), r, g, b, a);
+	}
+	result |= _gfxEndCoverage(dst, r, g, b);
+
+	/*
+	* The spans are sorted and disjoint already 
+	*/
+	if (spans.numRects > 0) {
+		result |= _gfxColor(dst, r, g, b, a);
+		result |= _gfxFillRects(dst, spans.rects, spans.numRects);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Draw anti-aliased filled polygon with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the filled polygon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aafilledPolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aafilledPolygonRGBA(renderer, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw anti-aliased filled polygon with alpha blending.
+
+The edges are anti-aliased by their exact pixel coverage and the interior is
+filled with one rectangle fill, at about the cost of filledPolygonRGBA.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filled polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aafilledPolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aafilledPolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+}
+
+/* ---- Texture cache */
+
+/*!
+\brief Maximum number of textures kept by the texture cache.
+*/
+#ifndef SDL2_GFX_TEXTURE_CACHE_SIZE
+#define SDL2_GFX_TEXTURE_CACHE_SIZE 32
+#endif
+
+/*!
+\brief A texture created from a surface for a renderer by the texture cache.
+
+The pixels pointer, size and pixel format of the surface are stored to detect
+surfaces which were recreated or resized since the texture was created.
+*/
+typedef struct SDL2_gfxCachedTexture {
+	SDL_Renderer *renderer;
+	SDL_Surface *surface;
+	void *pixels;
+	int w, h;
+	Uint32 format;
+	SDL_Texture *texture;
+	struct SDL2_gfxCachedTexture *next;
+} SDL2_gfxCachedTexture;
+
+/*!
+\brief Flag to keep the textures created by texturedPolygon for reuse.
+*/
+static int gfxPrimitivesTextureCaching = 0;
+
+/*!
+\brief List of cached textures, most recently used first.
+*/
+static SDL2_gfxCachedTexture *gfxPrimitivesTextures = NULL;
+
+/*!
+\brief Lock protecting the texture cache.
+*/
+static SDL_SpinLock gfxPrimitivesTextureLock = 0;
+
+/*!
+\brief Internal function to destroy a list of cached textures.
+
+Textures are destroyed without holding the texture lock.
+
+\param cached The first entry of the list linked through next.
+*/
+static void _gfxFreeCachedTextures(SDL2_gfxCachedTexture *cached)
+{
+	SDL2_gfxCachedTexture *next;
+
+	while (cached != NULL) {
+		next = cached->next;
+		SDL_DestroyTexture(cached->texture);
+		free(cached);
+		cached = next;
+	}
+}
+
+/*!
+\brief Internal function to unlink cached textures from the cache.
+
+The texture lock must be held by the caller. The unlinked textures are destroyed
+with _gfxFreeCachedTextures() after releasing the lock.
+
+\param renderer The renderer whose textures are removed or NULL for all renderers.
+\param surface The surface whose textures are removed or NULL for all surfaces.
+
+\returns Returns the list of removed textures.
+*/
+static SDL2_gfxCachedTexture *_gfxClearTextureCache(SDL_Renderer *renderer, SDL_Surface *surface)
+{
+	SDL2_gfxCachedTexture *cached, *removed, **link;
+
+	removed = NULL;
+	link = &gfxPrimitivesTextures;
+	while (*link != NULL) {
+		cached = *link;
+		if (((renderer != NULL) && (cached->renderer != renderer)) ||
+			((surface != NULL) && (cached->surface != surface))) {
+			link = &cached->next;
+			continue;
+		}
+		*link = cached->next;
+		cached->next = removed;
+		removed = cached;
+	}
+
+	return removed;
+}
+
+/*!
+\brief Sets if textures created by texturedPolygon are cached.
+
+When enabled, the texture created from a surface is kept and reused by the next
+textured polygons drawn with the same surface on the same renderer, instead of
+being uploaded for every polygon. The cache holds up to SDL2_GFX_TEXTURE_CACHE_SIZE
+textures per renderer. Call gfxInvalidateTexture() after changing the pixels of a cached surface
+and before freeing it. Disabling the cache destroys all cached textures.
+
+\param enable Set to 1 to enable or 0 to disable the texture cache.
+*/
+void gfxPrimitivesSetTextureCaching(int enable)
+{
+	SDL2_gfxCachedTexture *removed = NULL;
+
+	SDL_AtomicLock(&gfxPrimitivesTextureLock);
+	gfxPrimitivesTextureCaching = enable;
+	if (!enable) {
+		removed = _gfxClearTextureCache(NULL, NULL);
+	}
+	SDL_AtomicUnlock(&gfxPrimitivesTextureLock);
+	_gfxFreeCachedTextures(removed);
+}
+
+/*!
+\brief Destroys the cached textures created from a surface.
+
+\param surface The surface whose pixels changed or which is about to be freed. Set to NULL to empty the cache.
+*/
+void gfxInvalidateTexture(SDL_Surface *surface)
+{
+	SDL2_gfxCachedTexture *removed;
+
+	SDL_AtomicLock(&gfxPrimitivesTextureLock);
+	removed = _gfxClearTextureCache(NULL, surface);
+	SDL_AtomicUnlock(&gfxPrimitivesTextureLock);
+	_gfxFreeCachedTextures(removed);
+}
+
+/*!
+\brief Internal function to find the cached texture of a surface for a renderer.
+
+The texture lock must be held by the caller. A found texture is moved to the front
+of the cache. A texture which is stale because the surface changed its pixel buffer,
+size or format is unlinked and added to the removed list instead.
+
+\param renderer The renderer to draw on.
+\param surface The surface to find the texture for.
+\param removed Pointer to the list collecting the textures to destroy.
+
+\returns Returns the texture or NULL if it is not cached.
+*/
+static SDL_Texture *_gfxFindCachedTexture(SDL_Renderer *renderer, SDL_Surface *surface, SDL2_gfxCachedTexture **removed)
+{
+	SDL2_gfxCachedTexture *cached, **link;
+
+	for (link = &gfxPrimitivesTextures; *link != NULL; link = &(*link)->next) {
+		cached = *link;
+		if ((cached->renderer != renderer) || (cached->surface != surface)) {
+			continue;
+		}
+		*link = cached->next;
+		if ((cached->pixels != surface->pixels) || (cached->w != surface->w) ||
+			(cached->h != surface->h) || (cached->format != surface->format->format)) {
+			cached->next = *removed;
+			*removed = cached;
+			return NULL;
+		}
+		cached->next = gfxPrimitivesTextures;
+		gfxPrimitivesTextures = cached;
+		return cached->texture;
+	}
+
+	return NULL;
+}
+
+/*!
+\brief Internal function to get the cached texture of a surface for a renderer.
+
+Creates and caches the texture if it is not cached yet or the surface changed
+its pixel buffer, size or format. Evicts the least recently used texture if the
+cache of the renderer is full. Only textures of the given renderer are evicted,
+so textures are never destroyed by a thread drawing to another renderer.
+The texture lock is only held while the cache list is searched or changed; textures
+are created and destroyed outside of it.
+
+\param renderer The renderer to draw on.
+\param surface The surface to get the texture for.
+
+\returns Returns the texture or NULL on failure.
+*/
+static SDL_Texture *_gfxCachedTexture(SDL_Renderer *renderer, SDL_Surface *surface)
+{
+	SDL2_gfxCachedTexture *cached, *evicted, *removed, **link;
+	SDL_Texture *texture;
+	int count;
+
+	/*
+	* Find cached texture 
+	*/
+	removed = NULL;
+	SDL_AtomicLock(&gfxPrimitivesTextureLock);
+	texture = _gfxFindCachedTexture(renderer, surface, &removed);
+	SDL_AtomicUnlock(&gfxPrimitivesTextureLock);
+	_gfxFreeCachedTextures(removed);
+	if (texture != NULL) {
+		return texture;
+	}
+
+	/*
+	* Create texture 
+	*/
+	cached = (SDL2_gfxCachedTexture *)calloc(1, sizeof(SDL2_gfxCachedTexture));
+	if (cached == NULL) {
+		return NULL;
+	}
+	cached->texture = SDL_CreateTextureFromSurface(renderer, surface);
+	if (cached->texture == NULL) {
+		free(cached);
+		return NULL;
+	}
+	SDL_SetTextureBlendMode(cached->texture, SDL_BLENDMODE_BLEND);
+	cached->renderer = renderer;
+	cached->surface = surface;
+	cached->pixels = surface->pixels;
+	cached->w = surface->w;
+	cached->h = surface->h;
+	cached->format = surface->format->format;
+
+	/*
+	* Insert unless another thread cached the surface meanwhile, then evict
+	* least recently used textures 
+	*/
+	removed = NULL;
+	SDL_AtomicLock(&gfxPrimitivesTextureLock);
+	texture = _gfxFindCachedTexture(renderer, surface, &removed);
+	if (texture != NULL) {
+		cached->next = removed;
+		removed = cached;
+	} else {
+		cached->next = gfxPrimitivesTextures;
+		gfxPrimitivesTextures = cached;
+		texture = cached->texture;
+		count = 0;
+		link = &gfxPrimitivesTextures;
+		while (*link != NULL) {
+			evicted = *link;
+			if ((evicted->renderer == renderer) && (++count > SDL2_GFX_TEXTURE_CACHE_SIZE)) {
+				*link = evicted->next;
+				evicted->next = removed;
+				removed = evicted;
+			} else {
+				link = &evicted->next;
+			}
+		}
+	}
+	SDL_AtomicUnlock(&gfxPrimitivesTextureLock);
+	_gfxFreeCachedTextures(removed);
+
+	return texture;
+}
+
+/* ---- Textured Polygon */
+
+/*!
+\brief Internal function to draw a textured horizontal line.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param texture The texture to retrieve color information from.
+\param texture_w The width of the texture.
+\param texture_h The height of the texture.
+\param texture_dx The X offset for the texture lookup.
+\param texture_dy The Y offset for the textured lookup.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _HLineTextured(SDL2_gfxTarget *dst, Sint16 x1, Sint16 x2, Sint16 y, SDL_Texture *texture, int texture_w, int texture_h, int texture_dx, int texture_dy)
+{
+	Sint16 w;
+	Sint16 xtmp;
+	int result = 0;
+	int texture_x_walker;    
+	int texture_y_start;    
+	SDL_Rect source_rect,dst_rect;
+	int pixels_written,write_width;
+
+	/*
+	* Swap x1, x2 if required to ensure x1<=x2
+	*/
+	if (x1 > x2) {
+		xtmp = x1;
+		x1 = x2;
+		x2 = xtmp;
+	}
+
+	/*
+	* Calculate width to draw
+	*/
+	w = x2 - x1 + 1;
+
+	/*
+	* Determine where in the texture we start drawing
+	*/
+	texture_x_walker =   (x1 - texture_dx)  % texture_w;
+	if (texture_x_walker < 0){
+		texture_x_walker = texture_w + texture_x_walker ;
+	}
+
+	texture_y_start = (y + texture_dy) % texture_h;
+	if (texture_y_start < 0){
+		texture_y_start = texture_h + texture_y_start;
+	}
+
+	/* setup the source rectangle; we are only drawing one horizontal line */
+	source_rect.y = texture_y_start;
+	source_rect.x = texture_x_walker;
+	source_rect.h = 1;
+
+	/* we will draw to the current y */
+	dst_rect.y = y;
+	dst_rect.h = 1;
+
+	/* if there are enough pixels left in the current row of the texture */
+	/* draw it all at once */
+	if (w <= texture_w -texture_x_walker){
+		source_rect.w = w;
+		source_rect.x = texture_x_walker;
+		dst_rect.x= x1;
+		dst_rect.w = source_rect.w;
+		result = (_gfxCopy(dst, texture, &source_rect, &dst_rect) == 0);
+	} else { 
+		/* we need to draw multiple times */
+		/* draw the first segment */
+		pixels_written = texture_w  - texture_x_walker;
+		source_rect.w = pixels_written;
+		source_rect.x = texture_x_walker;
+		dst_rect.x= x1;
+		dst_rect.w = source_rect.w;
+		result |= (_gfxCopy(dst, texture, &source_rect, &dst_rect) == 0);
+		write_width = texture_w;
+
+		/* now draw the rest */
+		/* set the source x to 0 */
+		source_rect.x = 0;
+		while (pixels_written < w){
+			if (write_width >= w - pixels_written) {
+				write_width =  w - pixels_written;
+			}
+			source_rect.w = write_width;
+			dst_rect.x = x1 + pixels_written;
+			dst_rect.w = source_rect.w;
+			result |= (_gfxCopy(dst, texture, &source_rect, &dst_rect) == 0);
+			pixels_written += write_width;
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw a textured horizontal line on a surface.
+
+Blends the texture pixels with their alpha value, like the textures drawn by _HLineTextured.
+
+\param dst The surface target to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param texture The surface to retrieve the pixels from.
+\param texture_dx The X offset for the texture lookup.
+\param texture_dy The Y offset for the texture lookup.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _HLineTexturedSurface(SDL2_gfxTarget *dst, Sint16 x1, Sint16 x2, Sint16 y, SDL_Surface *texture, int texture_dx, int texture_dy)
+{
+	int result = 0;
+	int x, tx, ty;
+	Uint8 *p;
+	Uint32 pixel;
+	Uint8 r, g, b, a;
+
+	if (x1 > x2) {
+		x = x1;
+		x1 = x2;
+		x2 = x;
+	}
+
+	/*
+	* Clip against the surface to avoid needless texture lookups
+	*/
+	if ((y < dst->surface->clip_rect.y) || (y >= dst->surface->clip_rect.y + dst->surface->clip_rect.h)) {
+		return 0;
+	}
+	if (x1 < dst->surface->clip_rect.x) {
+		x1 = dst->surface->clip_rect.x;
+	}
+	if (x2 >= dst->surface->clip_rect.x + dst->surface->clip_rect.w) {
+		x2 = dst->surface->clip_rect.x + dst->surface->clip_rect.w - 1;
+	}
+
+	ty = (y + texture_dy) % texture->h;
+	if (ty < 0) {
+		ty += texture->h;
+	}
+	tx = (x1 - texture_dx) % texture->w;
+	if (tx < 0) {
+		tx += texture->w;
+	}
+
+	for (x = x1; x <= x2; x++) {
+		p = (Uint8 *)texture->pixels + ty * texture->pitch + tx * texture->format->BytesPerPixel;
+		switch (texture->format->BytesPerPixel) {
+		case 1:
+			pixel = *p;
+			break;
+		case 2:
+			pixel = *(Uint16 *)p;
+			break;
+		case 3:
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			pixel = (p[0] << 16) | (p[1] << 8) | p[2];
+#else
+			pixel = p[0] | (p[1] << 8) | (p[2] << 16);
+#endif
+			break;
+		default:
+			pixel = *(Uint32 *)p;
+			break;
+		}
+		SDL_GetRGBA(pixel, texture->format, &r, &g, &b, &a);
+		result |= _gfxColor(dst, r, g, b, a);
+		result |= _gfxSurfaceFill(dst, x, y, 1, 1);
+
+		if (++tx == texture->w) {
+			tx = 0;
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal texture source used by the textured polygon span callback.
+*/
+typedef struct {
+	SDL_Surface *surface;
+	SDL_Texture *texture;
+	int texture_w;
+	int texture_h;
+	int texture_dx;
+	int texture_dy;
+} SDL2_gfxTextureSpan;
+
+/*!
+\brief Internal span callback for textured polygons.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data The SDL2_gfxTextureSpan to sample from.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTexturedSpan(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data)
+{
+	SDL2_gfxTextureSpan *tex = (SDL2_gfxTextureSpan *) data;
+
+	if (dst->surface) {
+		return _HLineTexturedSurface(dst, xa, xb, y, tex->surface, tex->texture_dx, tex->texture_dy);
+	}
+	return _HLineTextured(dst, xa, xb, y, tex->texture, tex->texture_w, tex->texture_h, tex->texture_dx, tex->texture_dy);
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief The state of the span callback collecting textured polygon rows as geometry.
+*/
+typedef struct {
+	SDL2_gfxGeometry geometry;
+	SDL2_gfxTextureSpan *tex;
+} SDL2_gfxTexturedGeometry;
+
+/*!
+\brief Internal span callback adding a textured polygon row as quads to a geometry.
+
+The row is split where the repeated texture wraps, exactly like _HLineTextured splits
+its copies, and every part becomes a quad on the pixel edges with texture coordinates
+on the texel edges, so the same pixels and texels are drawn.
+
+\param dst The target to draw on.
+\param xa X coordinate of the left end of the span.
+\param xb X coordinate of the right end of the span.
+\param y Y coordinate of the span.
+\param data The SDL2_gfxTexturedGeometry to add to.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTexturedGeometrySpan(SDL2_gfxTarget *dst, int xa, int xb, int y, void *data)
+{
+	SDL2_gfxTexturedGeometry *textured = (SDL2_gfxTexturedGeometry *) data;
+	SDL2_gfxGeometry *geometry = &textured->geometry;
+	SDL2_gfxTextureSpan *tex = textured->tex;
+	SDL_Color white = { 255, 255, 255, 255 };
+	int x, x2, tx, ty, w, first;
+	float u1, u2, v1, v2;
+
+	x = SDL_min(xa, xb);
+	x2 = SDL_max(xa, xb);
+	if (_gfxCull(dst, x, y, x2, y)) {
+		return 0;
+	}
+
+	/*
+	* Determine where in the texture the row starts 
+	*/
+	tx = (x - tex->texture_dx) % tex->texture_w;
+	if (tx < 0) {
+		tx += tex->texture_w;
+	}
+	ty = (y + tex->texture_dy) % tex->texture_h;
+	if (ty < 0) {
+		ty += tex->texture_h;
+	}
+	v1 = (float)ty / tex->texture_h;
+	v2 = (float)(ty + 1) / tex->texture_h;
+
+	while (x <= x2) {
+		w = SDL_min(tex->texture_w - tx, x2 - x + 1);
+		u1 = (float)tx / tex->texture_w;
+		u2 = (float)(tx + w) / tex->texture_w;
+		if (_gfxReserveGeometry(geometry, 4, 6) < 0) {
+			return -1;
+		}
+		first = _gfxGeometryVertex(geometry, (float)x, (float)y, u1, v1, white);
+		_gfxGeometryVertex(geometry, (float)(x + w), (float)y, u2, v1, white);
+		_gfxGeometryVertex(geometry, (float)(x + w), (float)(y + 1), u2, v2, white);
+		_gfxGeometryVertex(geometry, (float)x, (float)(y + 1), u1, v2, white);
+		_gfxGeometryTriangle(geometry, first, first + 1, first + 2);
+		_gfxGeometryTriangle(geometry, first, first + 2, first + 3);
+		x += w;
+		tx = 0;
+	}
+
+	return 0;
+}
+#endif
+
+/*!
+\brief Internal function to fill a polygon with a texture.
+
+With SDL 2.0.18 or newer the rows of the polygon are collected as quads, split at the
+seams of the repeated texture, and drawn with a single geometry call; otherwise every
+row is copied from the texture. Both draw the pixels of the scanline filler.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array.
+\param polyInts Preallocated temp array storage for the polygon edges (optional, NULL uses the current context)
+\param polyAllocated Number of ints allocated in polyInts (optional, NULL uses the current context)
+\param tex The texture to fill the polygon with.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxTexturedPolygonSpans(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n,
+	int **polyInts, int *polyAllocated, SDL2_gfxTextureSpan *tex)
+{
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL2_gfxTexturedGeometry textured;
+
+	if ((!dst->surface) && (tex->texture_w > 0) && (tex->texture_h > 0)) {
+		_gfxBeginGeometry(&textured.geometry, dst);
+		textured.tex = tex;
+		if (_gfxFillPolygonSpans(dst, vx, vy, n, polyInts, polyAllocated, _gfxTexturedGeometrySpan, &textured)) {
+			return -1;
+		}
+		if (textured.geometry.numVertices == 0) {
+			return 0;
+		}
+		return _gfxGeometry(dst, tex->texture, textured.geometry.vertices, textured.geometry.numVertices,
+			textured.geometry.indices, textured.geometry.numIndices);
+	}
+#endif
+
+	return _gfxFillPolygonSpans(dst, vx, vy, n, polyInts, polyAllocated, _gfxTexturedSpan, tex);
+}
+
+/*!
+\brief Internal function to draws a polygon filled with the given texture (Multi-Threading Capable). 
+
+\param dst The target to draw on.
+\param vx array of x vector components
+\param vy array of x vector components
+\param n the amount of vectors in the vx and vy array
+\param texture the sdl surface to use to fill the polygon
+\param texture_dx the offset of the texture relative to the screeen. If you move the polygon 10 pixels 
+to the left and want the texture to apear the same you need to increase the texture_dx value
+\param texture_dy see texture_dx
+\param polyInts Preallocated temp array storage for the polygon edges (optional, NULL uses the current context)
+\param polyAllocated Number of ints allocated in polyInts (optional, NULL uses the current context)
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _texturedPolygonMT(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, 
+	SDL_Surface * texture, int texture_dx, int texture_dy, int **polyInts, int *polyAllocated)
+{
+	int result;
+	int cached = 0;
+	SDL2_gfxTextureSpan tex;
+
+	/*
+	* Sanity check number of edges
+	*/
+	if (n < 3) {
+		return -1;
+	}
+
+	/*
+	* Skip polygons outside of the visible area
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 0)) {
+		return 0;
+	}
+
+	tex.surface = texture;
+	tex.texture = NULL;
+	tex.texture_w = texture->w;
+	tex.texture_h = texture->h;
+	tex.texture_dx = texture_dx;
+	tex.texture_dy = texture_dy;
+
+    /* Create texture for drawing */
+	if (dst->surface) {
+		if ((SDL_MUSTLOCK(texture)) && (SDL_LockSurface(texture) < 0)) {
+			return -1;
+		}
+	} else if ((dst->batch) && (dst->batch->list)) {
+		/* The texture has to live as long as the display list */
+		tex.texture = _gfxListTexture(dst->batch->list, texture);
+		if (tex.texture == NULL) {
+			return -1;
+		}
+		cached = 1;
+	} else if (gfxPrimitivesTextureCaching) {
+		tex.texture = _gfxCachedTexture(dst->renderer, texture);
+		if (tex.texture == NULL) {
+			return -1;
+		}
+		cached = 1;
+	} else {
+		tex.texture = SDL_CreateTextureFromSurface(dst->renderer, texture);
+		if (tex.texture == NULL)
+		{
+			return -1;
+		}
+		SDL_SetTextureBlendMode(tex.texture, SDL_BLENDMODE_BLEND);
+	}
+	
+	/*
+	* Draw the rows of the polygon 
+	*/
+	result = _gfxTexturedPolygonSpans(dst, vx, vy, n, polyInts, polyAllocated, &tex);
+
+	if (dst->surface) {
+		if (SDL_MUSTLOCK(texture)) {
+			SDL_UnlockSurface(texture);
+		}
+	} else if (!cached) {
+		SDL_RenderPresent(dst->renderer);
+		SDL_DestroyTexture(tex.texture);
+	}
+
+	return (result);
+}
+
+/*!
+\brief Draws a polygon filled with the given texture (Multi-Threading Capable). 
+
+\param renderer The renderer to draw on.
+\param vx array of x vector components
+\param vy array of x vector components
+\param n the amount of vectors in the vx and vy array
+\param texture the sdl surface to use to fill the polygon
+\param texture_dx the offset of the texture relative to the screeen. If you move the polygon 10 pixels 
+to the left and want the texture to apear the same you need to increase the texture_dx value
+\param texture_dy see texture_dx
+\param polyInts Preallocated temp array storage for the polygon edges (optional, NULL uses the current context)
+\param polyAllocated Number of ints allocated in polyInts (optional, NULL uses the current context)
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int texturedPolygonMT(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, 
+	SDL_Surface * texture, int texture_dx, int texture_dy, int **polyInts, int *polyAllocated)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXTURED_POLYGON, _texturedPolygonMT(&dst, vx, vy, n, texture, texture_dx, texture_dy, polyInts, polyAllocated));
+}
+
+/*!
+\brief Draws a polygon filled with the given texture. 
+
+This standard version is calling multithreaded versions with NULL cache parameters.
+The surface is uploaded into a texture for every call unless texture caching is
+enabled with gfxPrimitivesSetTextureCaching().
+
+\param renderer The renderer to draw on.
+\param vx array of x vector components
+\param vy array of x vector components
+\param n the amount of vectors in the vx and vy array
+\param texture the sdl surface to use to fill the polygon
+\param texture_dx the offset of the texture relative to the screeen. if you move the polygon 10 pixels 
+to the left and want the texture to apear the same you need to increase the texture_dx value
+\param texture_dy see texture_dx
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int texturedPolygon(SDL_Renderer *renderer, const Sint16 * vx, const Sint16 * vy, int n, SDL_Surface *texture, int texture_dx, int texture_dy)
+{
+	/*
+	* Draw
+	*/
+	return (texturedPolygonMT(renderer, vx, vy, n, texture, texture_dx, texture_dy, NULL, NULL));
+}
+
+/*!
+\brief Internal function to draw a polygon filled with an existing texture.
+
+\param dst The target to draw on.
+\param vx array of x vector components
+\param vy array of x vector components
+\param n the amount of vectors in the vx and vy array
+\param texture the texture to use to fill the polygon
+\param texture_dx the offset of the texture relative to the screeen
+\param texture_dy see texture_dx
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _texturedPolygonTexture(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, 
+	SDL_Texture * texture, int texture_dx, int texture_dy)
+{
+	SDL2_gfxTextureSpan tex;
+
+	/*
+	* Sanity check number of edges
+	*/
+	if (n < 3) {
+		return -1;
+	}
+
+	/*
+	* Skip polygons outside of the visible area
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 0)) {
+		return 0;
+	}
+
+	if (dst->surface) {
+		return SDL_SetError("Cannot copy textures onto a surface");
+	}
+
+	tex.surface = NULL;
+	tex.texture = texture;
+	tex.texture_dx = texture_dx;
+	tex.texture_dy = texture_dy;
+	if (SDL_QueryTexture(texture, NULL, NULL, &tex.texture_w, &tex.texture_h) < 0) {
+		return -1;
+	}
+
+	/*
+	* Draw the rows of the polygon 
+	*/
+	return _gfxTexturedPolygonSpans(dst, vx, vy, n, NULL, NULL, &tex);
+}
+
+/*!
+\brief Draws a polygon filled with an existing texture. 
+
+Same as texturedPolygon, but uses a texture created by the caller, so the texture
+is not uploaded again for every polygon. The color and alpha modulation and blend
+mode of the texture are used as set by the caller.
+
+\param renderer The renderer to draw on.
+\param vx array of x vector components
+\param vy array of x vector components
+\param n the amount of vectors in the vx and vy array
+\param texture the texture to use to fill the polygon
+\param texture_dx the offset of the texture relative to the screeen. if you move the polygon 10 pixels 
+to the left and want the texture to apear the same you need to increase the texture_dx value
+\param texture_dy see texture_dx
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int texturedPolygonTexture(SDL_Renderer *renderer, const Sint16 * vx, const Sint16 * vy, int n, SDL_Texture *texture, int texture_dx, int texture_dy)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXTURED_POLYGON, _texturedPolygonTexture(&dst, vx, vy, n, texture, texture_dx, texture_dy));
+}
+
+/* ---- Character */
+
+/*!
+\brief The glyph atlases of a font created for one renderer, one per rotation.
+*/
+typedef struct SDL2_gfxFontCache {
+	SDL_Renderer *renderer;
+	SDL_Texture *atlas[4];
+	struct SDL2_gfxFontCache *next;
+} SDL2_gfxFontCache;
+
+/*!
+\brief The structure holding a bitmap font and its glyph atlases.
+
+The font data is not copied. Glyph atlases are created per renderer and rotation
+on first use and kept until the font data changes, the renderer is released with
+gfxReleaseRenderer() or the font is destroyed. An atlas stores all 256 characters
+in a 16x16 grid of (rotated) character cells.
+*/
+struct gfxFont {
+	const unsigned char *data;
+	Uint32 width, height;
+	Uint32 pitch, size;
+	Uint32 rotation;
+	Uint32 cellWidth, cellHeight;
+	SDL2_gfxFontCache *caches;
+	int hasBlank;
+	Uint8 blank[256];
+	gfxFont *next;
+};
+
+/*!
+\brief The current global font used by characterRGBA/stringRGBA. Default is the 8x8 pixel internal font. 
+*/
+static gfxFont gfxPrimitivesDefaultFont = { gfxPrimitivesFontdata, 8, 8, 1, 8, 0, 8, 8, NULL, 0, {0}, NULL };
+
+/*!
+\brief List of the fonts created with gfxCreateFont().
+*/
+static gfxFont *gfxPrimitivesFonts = NULL;
+
+/*!
+\brief Lock protecting the font list and the glyph caches of all fonts.
+*/
+static SDL_SpinLock gfxPrimitivesFontLock = 0;
+
+/*!
+\brief Internal function to destroy a list of glyph caches and their atlases.
+
+Atlases are destroyed without holding the font lock.
+
+\param cache The first glyph cache of the list linked through next.
+*/
+static void _gfxFreeFontCaches(SDL2_gfxFontCache *cache)
+{
+	SDL2_gfxFontCache *next;
+	int i;
+
+	while (cache != NULL) {
+		next = cache->next;
+		for (i = 0; i < 4; i++) {
+			if (cache->atlas[i]) {
+				SDL_DestroyTexture(cache->atlas[i]);
+			}
+		}
+		free(cache);
+		cache = next;
+	}
+}
+
+/*!
+\brief Internal function to unlink the glyph caches of a font.
+
+The font lock must be held by the caller. The unlinked caches are destroyed
+with _gfxFreeFontCaches() after releasing the lock.
+
+\param font The font to clear.
+\param renderer The renderer whose atlases are removed. Set to NULL to remove all atlases.
+\param removed Pointer to the list collecting the removed glyph caches.
+*/
+static void _gfxClearFontAtlas(gfxFont *font, SDL_Renderer *renderer, SDL2_gfxFontCache **removed)
+{
+	SDL2_gfxFontCache *cache, **link;
+
+	link = &font->caches;
+	while (*link != NULL) {
+		cache = *link;
+		if ((renderer != NULL) && (cache->renderer != renderer)) {
+			link = &cache->next;
+			continue;
+		}
+		*link = cache->next;
+		cache->next = *removed;
+		*removed = cache;
+	}
+}
+
+/*!
+\brief Release the cached textures created for a renderer.
+
+Destroys the glyph atlases of all fonts and the cached textured polygon textures
+created for the renderer and forgets its shadowed draw color and blend mode. Call
+before destroying a renderer the primitives were used with.
+
+\param renderer The renderer to release.
+*/
+void gfxReleaseRenderer(SDL_Renderer *renderer)
+{
+	gfxFont *font;
+	SDL2_gfxFontCache *caches;
+	SDL2_gfxCachedTexture *removed;
+
+	if (renderer == NULL) {
+		return;
+	}
+
+	caches = NULL;
+	SDL_AtomicLock(&gfxPrimitivesFontLock);
+	_gfxClearFontAtlas(&gfxPrimitivesDefaultFont, renderer, &caches);
+	for (font = gfxPrimitivesFonts; font != NULL; font = font->next) {
+		_gfxClearFontAtlas(font, renderer, &caches);
+	}
+	SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+	_gfxFreeFontCaches(caches);
+
+	SDL_AtomicLock(&gfxPrimitivesTextureLock);
+	removed = _gfxClearTextureCache(renderer, NULL);
+	SDL_AtomicUnlock(&gfxPrimitivesTextureLock);
+	_gfxFreeCachedTextures(removed);
+
+	_gfxReleaseRendererState(renderer);
+}
+
+/*!
+\brief Internal function to set the data of a font.
+
+\param font The font to change.
+\param fontdata Pointer to array of font data. Set to NULL to use the default 8x8 font.
+\param cw Width of character in pixels. Ignored if fontdata==NULL.
+\param ch Height of character in pixels. Ignored if fontdata==NULL.
+*/
+static void _gfxSetFontData(gfxFont *font, const void *fontdata, Uint32 cw, Uint32 ch)
+{
+	SDL2_gfxFontCache *caches = NULL;
+
+	if ((fontdata) && (cw) && (ch)) {
+		font->data = (const unsigned char *)fontdata;
+		font->width = cw;
+		font->height = ch;
+	} else {
+		font->data = gfxPrimitivesFontdata;
+		font->width = 8;
+		font->height = 8;
+	}
+
+	font->pitch = (font->width+7)/8;
+	font->size = font->pitch * font->height;
+
+	/* Maybe flip width/height for rendering */
+	if ((font->rotation==1) || (font->rotation==3))
+	{
+		font->cellWidth = font->height;
+		font->cellHeight = font->width;
+	}
+	else
+	{
+		font->cellWidth = font->width;
+		font->cellHeight = font->height;
+	}
+
+	/* Clear character cache */
+	SDL_AtomicLock(&gfxPrimitivesFontLock);
+	_gfxClearFontAtlas(font, NULL, &caches);
+	font->hasBlank = 0;
+	SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+	_gfxFreeFontCaches(caches);
+}
+
+/*!
+\brief Sets or resets the current global font data.
+
+The font data array is organized in follows: 
+[fontdata] = [character 0][character 1]...[character 255] where
+[character n] = [byte 1 row 1][byte 2 row 1]...[byte {pitch} row 1][byte 1 row 2] ...[byte {pitch} row height] where
+[byte n] = [bit 0]...[bit 7] where 
+[bit n] = [0 for transparent pixel|1 for colored pixel]
+
+\param fontdata Pointer to array of font data. Set to NULL, to reset global font to the default 8x8 font.
+\param cw Width of character in bytes. Ignored if fontdata==NULL.
+\param ch Height of character in bytes. Ignored if fontdata==NULL.
+*/
+void gfxPrimitivesSetFont(const void *fontdata, Uint32 cw, Uint32 ch)
+{
+	_gfxSetFontData(&gfxPrimitivesDefaultFont, fontdata, cw, ch);
+}
+
+/*!
+\brief Sets the character rotation steps of a font. 
+
+Default is 0 (no rotation). 1 = 90deg clockwise. 2 = 180deg clockwise. 3 = 270deg clockwise.
+Each rotation has its own character cache, so switching between rotations is cheap.
+
+\param font The font to change. Set to NULL to change the current global font.
+\param rotation Number of 90deg clockwise steps to rotate
+*/
+void gfxSetFontRotation(gfxFont *font, Uint32 rotation)
+{
+	if (font == NULL) {
+		font = &gfxPrimitivesDefaultFont;
+	}
+
+	/* Store rotation */
+	font->rotation = rotation & 3;
+
+	/* Maybe flip width/height for rendering */
+	if ((font->rotation==1) || (font->rotation==3))
+	{
+		font->cellWidth = font->height;
+		font->cellHeight = font->width;
+	}
+	else
+	{
+		font->cellWidth = font->width;
+		font->cellHeight = font->height;
+	}
+}
+
+/*!
+\brief Sets current global font character rotation steps. 
+
+Default is 0 (no rotation). 1 = 90deg clockwise. 2 = 180deg clockwise. 3 = 270deg clockwise.
+
+\param rotation Number of 90deg clockwise steps to rotate
+*/
+void gfxPrimitivesSetFontRotation(Uint32 rotation)
+{
+	gfxSetFontRotation(&gfxPrimitivesDefaultFont, rotation);
+}
+
+/*!
+\brief Create a font handle with its own character cache.
+
+Several fonts can be used at the same time without invalidating each others
+cached characters. The font data is not copied and must stay valid until the
+font is destroyed. See gfxPrimitivesSetFont() for the layout of the font data.
+
+\param fontdata Pointer to array of font data. Set to NULL to use the default 8x8 font.
+\param cw Width of character in pixels. Ignored if fontdata==NULL.
+\param ch Height of character in pixels. Ignored if fontdata==NULL.
+
+\returns Returns the new font or NULL on failure.
+*/
+gfxFont *gfxCreateFont(const void *fontdata, Uint32 cw, Uint32 ch)
+{
+	gfxFont *font;
+
+	font = (gfxFont *)calloc(1, sizeof(gfxFont));
+	if (font == NULL) {
+		return NULL;
+	}
+	_gfxSetFontData(font, fontdata, cw, ch);
+
+	SDL_AtomicLock(&gfxPrimitivesFontLock);
+	font->next = gfxPrimitivesFonts;
+	gfxPrimitivesFonts = font;
+	SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+
+	return font;
+}
+
+/*!
+\brief Free a font handle and its character cache.
+
+\param font The font to free.
+*/
+void gfxDestroyFont(gfxFont *font)
+{
+	gfxFont **link;
+	SDL2_gfxFontCache *caches = NULL;
+
+	if ((font == NULL) || (font == &gfxPrimitivesDefaultFont)) {
+		return;
+	}
+
+	SDL_AtomicLock(&gfxPrimitivesFontLock);
+	for (link = &gfxPrimitivesFonts; *link != NULL; link = &(*link)->next) {
+		if (*link == font) {
+			*link = font->next;
+			break;
+		}
+	}
+	_gfxClearFontAtlas(font, NULL, &caches);
+	SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+	_gfxFreeFontCaches(caches);
+	free(font);
+}
+
+/*!
+\brief Internal function to map a font pixel to its position in the rotated character.
+
+\param font The font to use.
+\param ix X (horizontal) coordinate of the pixel in the font data.
+\param iy Y (vertical) coordinate of the pixel in the font data.
+\param px Returns the X coordinate of the pixel in the rotated character.
+\param py Returns the Y coordinate of the pixel in the rotated character.
+*/
+static void _gfxRotateFontPixel(gfxFont *font, Uint32 ix, Uint32 iy, int *px, int *py)
+{
+	switch (font->rotation) {
+	case 1:
+		*px = font->height - 1 - iy;
+		*py = ix;
+		break;
+	case 2:
+		*px = font->width - 1 - ix;
+		*py = font->height - 1 - iy;
+		break;
+	case 3:
+		*px = iy;
+		*py = font->width - 1 - ix;
+		break;
+	default:
+		*px = ix;
+		*py = iy;
+		break;
+	}
+}
+
+/*!
+\brief Internal function to render the glyph atlas of a font for its current rotation.
+
+Renders all 256 characters, rotated by the font rotation, into a 16x16 grid of
+character cells and converts it into a texture for the renderer. Also records
+which characters are blank. Called without holding the font lock.
+
+\param font The font to use.
+\param renderer The renderer to create the texture for.
+\param blank Returns a flag for each character indicating if it is blank.
+
+\returns Returns the atlas texture or NULL on failure.
+*/
+static SDL_Texture *_gfxCreateFontAtlas(gfxFont *font, SDL_Renderer *renderer, Uint8 *blank)
+{
+	SDL_Surface *atlas;
+	SDL_Texture *texture;
+	Uint32 ci, ix, iy;
+	int px, py;
+	const unsigned char *charpos;
+	Uint8 *linepos;
+	Uint8 patt, mask;
+
+	atlas = SDL_CreateRGBSurface(SDL_SWSURFACE,
+		16 * font->cellWidth, 16 * font->cellHeight, 32,
+		0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+	if (atlas == NULL) {
+		return NULL;
+	}
+	memset(atlas->pixels, 0, atlas->pitch * atlas->h);
+
+	/*
+	* Drawing loop 
+	*/
+	for (ci = 0; ci < 256; ci++) {
+		charpos = font->data + ci * font->size;
+		blank[ci] = 1;
+		patt = 0;
+		for (iy = 0; iy < font->height; iy++) {
+			mask = 0x00;
+			for (ix = 0; ix < font->width; ix++) {
+				if (!(mask >>= 1)) {
+					patt = *charpos++;
+					mask = 0x80;
+				}
+				if (patt & mask) {
+					_gfxRotateFontPixel(font, ix, iy, &px, &py);
+					linepos = (Uint8 *)atlas->pixels + ((ci / 16) * font->cellHeight + py) * atlas->pitch;
+					*(Uint32 *)(linepos + ((ci % 16) * font->cellWidth + px) * 4) = 0xffffffff;
+					blank[ci] = 0;
+				}
+			}
+		}
+	}
+
+	/* Convert atlas surface into texture */
+	texture = SDL_CreateTextureFromSurface(renderer, atlas);
+	SDL_FreeSurface(atlas);
+	if (texture) {
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+	}
+
+	return texture;
+}
+
+/*!
+\brief Internal function to get the glyph atlas of a font for a renderer and the current font rotation.
+
+Looks up the glyph cache of the renderer, moving it to the front of the list of
+caches, and creates the cache and atlas on first use. The atlas is rendered without
+holding the font lock and dropped if another thread stored one meanwhile.
+
+\param font The font to use.
+\param renderer The renderer to draw on.
+
+\returns Returns the atlas texture or NULL on failure.
+*/
+static SDL_Texture *_gfxFontAtlas(gfxFont *font, SDL_Renderer *renderer)
+{
+	SDL2_gfxFontCache *cache, **link;
+	SDL_Texture *texture, *created;
+	Uint8 blank[256];
+	Uint32 rotation = font->rotation;
+
+	created = NULL;
+	for (;;) {
+		SDL_AtomicLock(&gfxPrimitivesFontLock);
+
+		/*
+		* Find cache of renderer 
+		*/
+		cache = NULL;
+		for (link = &font->caches; *link != NULL; link = &(*link)->next) {
+			if ((*link)->renderer == renderer) {
+				cache = *link;
+				*link = cache->next;
+				break;
+			}
+		}
+		if (cache == NULL) {
+			cache = (SDL2_gfxFontCache *)calloc(1, sizeof(SDL2_gfxFontCache));
+			if (cache == NULL) {
+				SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+				if (created) {
+					SDL_DestroyTexture(created);
+				}
+				return NULL;
+			}
+			cache->renderer = renderer;
+		}
+		cache->next = font->caches;
+		font->caches = cache;
+
+		/*
+		* Store the atlas created by the previous pass unless another thread was faster 
+		*/
+		if ((cache->atlas[rotation] == NULL) && (created != NULL)) {
+			cache->atlas[rotation] = created;
+			if (!font->hasBlank) {
+				memcpy(font->blank, blank, sizeof(blank));
+				font->hasBlank = 1;
+			}
+			created = NULL;
+		}
+		texture = cache->atlas[rotation];
+
+		SDL_AtomicUnlock(&gfxPrimitivesFontLock);
+
+		if (created) {
+			SDL_DestroyTexture(created);
+			created = NULL;
+		}
+		if (texture) {
+			return texture;
+		}
+
+		/*
+		* Create atlas without holding the lock 
+		*/
+		created = _gfxCreateFontAtlas(font, renderer, blank);
+		if (created == NULL) {
+			return NULL;
+		}
+	}
+}
+
+/*!
+\brief Internal function to draw a character of a font directly onto a surface.
+
+\param dst The surface target to draw on.
+\param font The font to draw with.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _characterSurface(SDL2_gfxTarget *dst, gfxFont *font, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	Uint32 ix, iy;
+	int px, py;
+	const unsigned char *charpos;
+	Uint8 patt, mask;
+
+	if (_gfxCull(dst, x, y, x + (int)font->cellWidth - 1, y + (int)font->cellHeight - 1)) {
+		return (0);
+	}
+
+	result |= _gfxColor(dst, r, g, b, a);
+
+	charpos = font->data + (unsigned char) c * font->size;
+	patt = 0;
+	for (iy = 0; iy < font->height; iy++) {
+		mask = 0x00;
+		for (ix = 0; ix < font->width; ix++) {
+			if (!(mask >>= 1)) {
+				patt = *charpos++;
+				mask = 0x80;
+			}
+			if (patt & mask) {
+				_gfxRotateFontPixel(font, ix, iy, &px, &py);
+				result |= _gfxSurfaceFill(dst, x + px, y + py, 1, 1);
+			}
+		}
+	}
+
+	return (result);
+}
+
+/*!
+\brief Internal function to draw a character of a font.
+
+\param font The font to use.
+\param renderer The Renderer to draw on.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _characterRGBA(SDL2_gfxTarget *dst, gfxFont *font, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL_Texture *atlas;
+	SDL_Rect srect;
+	SDL_Rect drect;
+	int result;
+	Uint32 ci;
+
+	if (dst->surface) {
+		return _characterSurface(dst, font, x, y, c, r, g, b, a);
+	}
+
+	/*
+	* Create glyph atlas if not already present
+	*/
+	atlas = _gfxFontAtlas(font, dst->renderer);
+	if (atlas == NULL) {
+		return (-1);
+	}
+
+	/* Character index in cache */
+	ci = (unsigned char) c;
+
+	/*
+	* Setup source rectangle
+	*/
+	srect.x = (ci % 16) * font->cellWidth;
+	srect.y = (ci / 16) * font->cellHeight;
+	srect.w = font->cellWidth;
+	srect.h = font->cellHeight;
+
+	/*
+	* Setup destination rectangle
+	*/
+	drect.x = x;
+	drect.y = y;
+	drect.w = font->cellWidth;
+	drect.h = font->cellHeight;
+
+	/*
+	* Set color 
+	*/
+	result = 0;
+	result |= SDL_SetTextureColorMod(atlas, r, g, b);
+	result |= SDL_SetTextureAlphaMod(atlas, a);
+
+	/*
+	* Draw texture onto destination 
+	*/
+	result |= _gfxCopy(dst, atlas, &srect, &drect);
+
+	return (result);
+}
+
+/*!
+\brief Draw a character of the currently set font.
+
+\param renderer The Renderer to draw on.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int characterRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _characterRGBA(&dst, &gfxPrimitivesDefaultFont, x, y, c, r, g, b, a));
+}
+
+
+/*!
+\brief Draw a character of the currently set font.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param color The color value of the character to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int characterColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, char c, Uint32 color)
+{
+	Uint8 *co = (Uint8 *)&color; 
+	return characterRGBA(renderer, x, y, c, co[0], co[1], co[2], co[3]);
+}
+
+
+/*!
+\brief Draw a string in the currently set font.
+
+The spacing between consequtive characters in the string is the fixed number of pixels 
+of the character width of the current global font.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param color The color value of the string to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int stringColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return stringRGBA(renderer, x, y, s, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to advance the position of the next character of a string.
+
+\param font The font to use.
+\param x Pointer to the X (horizontal) coordinate of the character.
+\param y Pointer to the Y (vertical) coordinate of the character.
+*/
+static void _gfxNextCharacter(gfxFont *font, Sint16 *x, Sint16 *y)
+{
+	switch (font->rotation)
+	{
+	case 0:
+		*x += font->cellWidth;
+		break;
+	case 2:
+		*x -= font->cellWidth;
+		break;
+	case 1:
+		*y += font->cellHeight;
+		break;
+	case 3:
+		*y -= font->cellHeight;
+		break;
+	}
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief Internal function to draw a string from the glyph atlas with a single geometry call.
+
+Each visible character becomes a textured quad; the color is passed per vertex.
+
+\param dst The target to draw on.
+\param font The font to draw with.
+\param atlas The glyph atlas of the font.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param r The red value of the string to draw. 
+\param g The green value of the string to draw. 
+\param b The blue value of the string to draw. 
+\param a The alpha value of the string to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _stringGeometry(SDL2_gfxTarget *dst, gfxFont *font, SDL_Texture *atlas, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL_Vertex *vertices, *v;
+	int *indices, *ind;
+	int i, n, quads;
+	Uint32 ci;
+	Uint8 mr, mg, mb, ma;
+	Sint16 curx = x;
+	Sint16 cury = y;
+	float u0, v0, u1, v1;
+	float du = 1.0f / 16.0f;
+	float dv = 1.0f / 16.0f;
+	SDL_Color color;
+
+	n = (int)strlen(s);
+	if (n == 0) {
+		return 0;
+	}
+	vertices = (SDL_Vertex *)_gfxScratch(&dst->context->geometry, 4 * n * sizeof(SDL_Vertex));
+	if (vertices == NULL) {
+		return (-1);
+	}
+	indices = (int *)_gfxScratch(&dst->context->indices, 6 * n * sizeof(int));
+	if (indices == NULL) {
+		return (-1);
+	}
+
+	color.r = r;
+	color.g = g;
+	color.b = b;
+	color.a = a;
+
+	/*
+	* One quad per visible character 
+	*/
+	quads = 0;
+	for (i = 0; i < n; i++) {
+		ci = (unsigned char) s[i];
+		if ((!font->blank[ci]) && 
+			(!_gfxCull(dst, curx, cury, curx + (int)font->cellWidth - 1, cury + (int)font->cellHeight - 1))) {
+			u0 = (ci % 16) * du;
+			v0 = (ci / 16) * dv;
+			u1 = u0 + du;
+			v1 = v0 + dv;
+			v = &vertices[4 * quads];
+			v[0].position.x = (float)curx;
+			v[0].position.y = (float)cury;
+			v[0].tex_coord.x = u0;
+			v[0].tex_coord.y = v0;
+			v[1].position.x = (float)(curx + font->cellWidth);
+			v[1].position.y = (float)cury;
+			v[1].tex_coord.x = u1;
+			v[1].tex_coord.y = v0;
+			v[2].position.x = (float)(curx + font->cellWidth);
+			v[2].position.y = (float)(cury + font->cellHeight);
+			v[2].tex_coord.x = u1;
+			v[2].tex_coord.y = v1;
+			v[3].position.x = (float)curx;
+			v[3].position.y = (float)(cury + font->cellHeight);
+			v[3].tex_coord.x = u0;
+			v[3].tex_coord.y = v1;
+			v[0].color = v[1].color = v[2].color = v[3].color = color;
+			ind = &indices[6 * quads];
+			ind[0] = 4 * quads;
+			ind[1] = 4 * quads + 1;
+			ind[2] = 4 * quads + 2;
+			ind[3] = 4 * quads;
+			ind[4] = 4 * quads + 2;
+			ind[5] = 4 * quads + 3;
+			quads++;
+		}
+		_gfxNextCharacter(font, &curx, &cury);
+	}
+	if (quads == 0) {
+		return 0;
+	}
+
+	/*
+	* Undo color modulation set by characterRGBA 
+	*/
+	if ((SDL_GetTextureColorMod(atlas, &mr, &mg, &mb) == 0) && ((mr & mg & mb) != 255)) {
+		SDL_SetTextureColorMod(atlas, 255, 255, 255);
+	}
+	if ((SDL_GetTextureAlphaMod(atlas, &ma) == 0) && (ma != 255)) {
+		SDL_SetTextureAlphaMod(atlas, 255);
+	}
+
+	return _gfxGeometry(dst, atlas, vertices, 4 * quads, indices, 6 * quads);
+}
+#endif
+
+/*!
+\brief Internal function to draw a string in a font.
+
+On renderers the characters are taken from the glyph atlas of the font and the whole
+string is drawn with one SDL_RenderGeometry call if available, or one texture copy
+per visible character otherwise.
+
+\param dst The target to draw on.
+\param font The font to draw with.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param r The red value of the string to draw. 
+\param g The green value of the string to draw. 
+\param b The blue value of the string to draw. 
+\param a The alpha value of the string to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _stringRGBA(SDL2_gfxTarget *dst, gfxFont *font, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result = 0;
+	Sint16 curx = x;
+	Sint16 cury = y;
+	const char *curchar = s;
+	SDL_Texture *atlas;
+	SDL_Rect srect;
+	SDL_Rect drect;
+	Uint32 ci;
+
+	if (dst->surface) {
+		while (*curchar && !result) {
+			result |= _characterSurface(dst, font, curx, cury, *curchar, r, g, b, a);
+			_gfxNextCharacter(font, &curx, &cury);
+			curchar++;
+		}
+		return (result);
+	}
+
+	/*
+	* Create glyph atlas if not already present
+	*/
+	atlas = _gfxFontAtlas(font, dst->renderer);
+	if (atlas == NULL) {
+		return (-1);
+	}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	if (_stringGeometry(dst, font, atlas, x, y, s, r, g, b, a) == 0) {
+		return 0;
+	}
+#endif
+
+	/*
+	* Fallback: one copy per visible character 
+	*/
+	result |= SDL_SetTextureColorMod(atlas, r, g, b);
+	result |= SDL_SetTextureAlphaMod(atlas, a);
+	srect.w = drect.w = font->cellWidth;
+	srect.h = drect.h = font->cellHeight;
+	while (*curchar && !result) {
+		ci = (unsigned char) *curchar;
+		if (!font->blank[ci]) {
+			srect.x = (ci % 16) * font->cellWidth;
+			srect.y = (ci / 16) * font->cellHeight;
+			drect.x = curx;
+			drect.y = cury;
+			result |= _gfxCopy(dst, atlas, &srect, &drect);
+		}
+		_gfxNextCharacter(font, &curx, &cury);
+		curchar++;
+	}
+
+	return (result);
+}
+
+/*!
+\brief Draw a string in the currently set font.
+
+\param renderer The renderer to draw on.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param r The red value of the string to draw. 
+\param g The green value of the string to draw. 
+\param b The blue value of the string to draw. 
+\param a The alpha value of the string to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int stringRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _stringRGBA(&dst, &gfxPrimitivesDefaultFont, x, y, s, r, g, b, a));
+}
+
+/*!
+\brief Draw a character of a font.
+
+\param renderer The renderer to draw on.
+\param font The font to draw with. Set to NULL to use the current global font.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxFontCharacterRGBA(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _characterRGBA(&dst, (font) ? font : &gfxPrimitivesDefaultFont, x, y, c, r, g, b, a));
+}
+
+/*!
+\brief Draw a character of a font.
+
+\param renderer The renderer to draw on.
+\param font The font to draw with. Set to NULL to use the current global font.
+\param x X (horizontal) coordinate of the upper left corner of the character.
+\param y Y (vertical) coordinate of the upper left corner of the character.
+\param c The character to draw.
+\param color The color value of the character to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxFontCharacterColor(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, char c, Uint32 color)
+{
+	Uint8 *co = (Uint8 *)&color; 
+	return gfxFontCharacterRGBA(renderer, font, x, y, c, co[0], co[1], co[2], co[3]);
+}
+
+/*!
+\brief Draw a string in a font.
+
+The spacing between consequtive characters in the string is the fixed number of pixels 
+of the character width of the font.
+
+\param renderer The renderer to draw on.
+\param font The font to draw with. Set to NULL to use the current global font.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param r The red value of the string to draw. 
+\param g The green value of the string to draw. 
+\param b The blue value of the string to draw. 
+\param a The alpha value of the string to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxFontStringRGBA(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _stringRGBA(&dst, (font) ? font : &gfxPrimitivesDefaultFont, x, y, s, r, g, b, a));
+}
+
+/*!
+\brief Draw a string in a font.
+
+\param renderer The renderer to draw on.
+\param font The font to draw with. Set to NULL to use the current global font.
+\param x X (horizontal) coordinate of the upper left corner of the string.
+\param y Y (vertical) coordinate of the upper left corner of the string.
+\param s The string to draw.
+\param color The color value of the string to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int gfxFontStringColor(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, const char *s, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return gfxFontStringRGBA(renderer, font, x, y, s, c[0], c[1], c[2], c[3]);
+}
+
+/* ---- Bezier curve */
+
+/*!
+\brief Maximum distance in pixels a flattened curve may deviate from the exact curve.
+*/
+#ifndef SDL2_GFX_BEZIER_FLATNESS
+#define SDL2_GFX_BEZIER_FLATNESS 0.25
+#endif
+
+/*!
+\brief Maximum depth of the adaptive subdivision of a curve segment (at most 2^depth lines).
+*/
+#define SDL2_GFX_BEZIER_DEPTH 16
+
+/*!
+\brief A list of points built in the scratch memory of a context.
+*/
+typedef struct {
+	SDL2_gfxScratch *scratch;
+	SDL_Point *points;
+	int numPoints;
+} SDL2_gfxPolyline;
+
+/*!
+\brief Internal function to start an empty point list in the scratch memory of a target.
+
+\param line The point list to start.
+\param dst The target whose context provides the memory.
+*/
+static void _gfxBeginPolyline(SDL2_gfxPolyline *line, SDL2_gfxTarget *dst)
+{
+	line->scratch = &dst->context->points;
+	line->points = (SDL_Point *)line->scratch->data;
+	line->numPoints = 0;
+}
+
+/*!
+\brief Internal function to append a point to a point list.
+
+The coordinates are rounded to the nearest pixel; a point equal to the previous
+point is skipped.
+
+\param line The point list.
+\param x X coordinate of the point.
+\param y Y coordinate of the point.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxPolylinePoint(SDL2_gfxPolyline *line, double x, double y)
+{
+	SDL_Point p;
+
+	p.x = (int)lrint(x);
+	p.y = (int)lrint(y);
+	if ((line->numPoints > 0) && (line->points[line->numPoints - 1].x == p.x) && (line->points[line->numPoints - 1].y == p.y)) {
+		return 0;
+	}
+
+	line->points = (SDL_Point *)_gfxScratch(line->scratch, sizeof(SDL_Point) * (line->numPoints + 1));
+	if (line->points == NULL) {
+		return -1;
+	}
+	line->points[line->numPoints++] = p;
+
+	return 0;
+}
+
+/*!
+\brief Internal function to draw the points of a point list as connected lines.
+
+\param dst The target to draw on.
+\param line The point list.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawPolyline(SDL2_gfxTarget *dst, const SDL2_gfxPolyline *line)
+{
+	if (line->numPoints == 1) {
+		return _gfxPixel(dst, line->points[0].x, line->points[0].y);
+	}
+
+	return _gfxLines(dst, line->points, line->numPoints);
+}
+
+/*!
+\brief Internal function to flatten a cubic bezier segment by adaptive subdivision.
+
+The segment is split in halves with de Casteljau's algorithm until the control points
+are within SDL2_GFX_BEZIER_FLATNESS of the chord. The end point of every flat piece is
+added to the point list; the start point must already be in the list.
+
+\param line The point list to add to.
+\param p Array of the 4 control points as x,y pairs.
+\param depth Remaining number of subdivisions.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFlattenCubic(SDL2_gfxPolyline *line, const double *p, int depth)
+{
+	double ux, uy, vx, vy, tolerance;
+	double left[8], right[8];
+	double x01, y01, x12, y12, x23, y23, x012, y012, x123, y123;
+
+	/*
+	* Flatness: largest deviation of the control points from a uniformly parameterized line 
+	*/
+	ux = 3.0 * p[2] - 2.0 * p[0] - p[6];
+	uy = 3.0 * p[3] - 2.0 * p[1] - p[7];
+	vx = 3.0 * p[4] - p[0] - 2.0 * p[6];
+	vy = 3.0 * p[5] - p[1] - 2.0 * p[7];
+	ux *= ux;
+	uy *= uy;
+	vx *= vx;
+	vy *= vy;
+	tolerance = 16.0 * SDL2_GFX_BEZIER_FLATNESS * SDL2_GFX_BEZIER_FLATNESS;
+	if ((depth <= 0) || ((SDL_max(ux, vx) + SDL_max(uy, vy)) <= tolerance)) {
+		return _gfxPolylinePoint(line, p[6], p[7]);
+	}
+
+	/*
+	* Split at t=0.5 
+	*/
+	x01 = (p[0] + p[2]) * 0.5;
+	y01 = (p[1] + p[3]) * 0.5;
+	x12 = (p[2] + p[4]) * 0.5;
+	y12 = (p[3] + p[5]) * 0.5;
+	x23 = (p[4] + p[6]) * 0.5;
+	y23 = (p[5] + p[7]) * 0.5;
+	x012 = (x01 + x12) * 0.5;
+	y012 = (y01 + y12) * 0.5;
+	x123 = (x12 + x23) * 0.5;
+	y123 = (y12 + y23) * 0.5;
+	left[0] = p[0];
+	left[1] = p[1];
+	left[2] = x01;
+	left[3] = y01;
+	left[4] = x012;
+	left[5] = y012;
+	left[6] = (x012 + x123) * 0.5;
+	left[7] = (y012 + y123) * 0.5;
+	right[0] = left[6];
+	right[1] = left[7];
+	right[2] = x123;
+	right[3] = y123;
+	right[4] = x23;
+	right[5] = y23;
+	right[6] = p[6];
+	right[7] = p[7];
+
+	if (_gfxFlattenCubic(line, left, depth - 1)) {
+		return -1;
+	}
+	return _gfxFlattenCubic(line, right, depth - 1);
+}
+
+/*!
+\brief Internal function to split a bezier curve in halves with de Casteljau's algorithm.
+
+\param p Array of the n control points as x,y pairs.
+\param n Number of control points.
+\param left Returns the n control points of the first half as x,y pairs.
+\param right Returns the n control points of the second half as x,y pairs.
+*/
+static void _gfxSplitBezier(const double *p, int n, double *left, double *right)
+{
+	int i, k;
+
+	for (i = 0; i < 2 * n; i++) {
+		right[i] = p[i];
+	}
+	left[0] = p[0];
+	left[1] = p[1];
+	for (k = 1; k < n; k++) {
+		for (i = 0; i < n - k; i++) {
+			right[2 * i] = (right[2 * i] + right[2 * i + 2]) * 0.5;
+			right[2 * i + 1] = (right[2 * i + 1] + right[2 * i + 3]) * 0.5;
+		}
+		left[2 * k] = right[0];
+		left[2 * k + 1] = right[1];
+	}
+}
+
+/*!
+\brief Internal function to flatten a bezier curve of any degree by adaptive subdivision.
+
+The curve is split in halves with de Casteljau's algorithm until every control point
+is within SDL2_GFX_BEZIER_FLATNESS of its place on the uniformly parameterized chord,
+which bounds the distance of the curve from the chord. The end point of every flat
+piece is added to the point list; the start point must already be in the list.
+
+\param line The point list to add to.
+\param p Array of the n control points as x,y pairs.
+\param n Number of control points.
+\param depth Remaining number of subdivisions.
+\param work Array of 4 * n * depth values used as temporary memory.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFlattenBezier(SDL2_gfxPolyline *line, const double *p, int n, int depth, double *work)
+{
+	int i, m = n - 1;
+	double dx, dy, mx = 0.0, my = 0.0;
+	double *left = work, *right = work + 2 * n;
+
+	/*
+	* Flatness: largest deviation of the control points from a uniformly parameterized line 
+	*/
+	for (i = 1; i < m; i++) {
+		dx = p[2 * i] - (p[0] * (m - i) + p[2 * m] * i) / m;
+		dy = p[2 * i + 1] - (p[1] * (m - i) + p[2 * m + 1] * i) / m;
+		mx = SDL_max(mx, dx * dx);
+		my = SDL_max(my, dy * dy);
+	}
+	if ((depth <= 0) || ((mx + my) <= SDL2_GFX_BEZIER_FLATNESS * SDL2_GFX_BEZIER_FLATNESS)) {
+		return _gfxPolylinePoint(line, p[2 * m], p[2 * m + 1]);
+	}
+
+	_gfxSplitBezier(p, n, left, right);
+	if (_gfxFlattenBezier(line, left, n, depth - 1, work + 4 * n)) {
+		return -1;
+	}
+	return _gfxFlattenBezier(line, right, n, depth - 1, work + 4 * n);
+}
+
+/*!
+\brief Draw a bezier curve with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the bezier curve.
+\param vy Vertex array containing Y coordinates of the points of the bezier curve.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param s Maximum number of points the curve is drawn through; fewer are used where the curve is flat. Minimum number is 2.
+\param color The color value of the bezier curve to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierRGBA(renderer, vx, vy, n, s, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw a bezier curve with alpha blending.
+
+The curve is split with de Casteljau's algorithm, which stays within the convex hull
+of the control points for any number of points, until its pieces are flat; the number
+of lines adapts to the curvature, at most s - 1 of them. It is drawn as one connected
+line through the points rounded to the nearest pixel.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the bezier curve.
+\param vy Vertex array containing Y coordinates of the points of the bezier curve.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param s Maximum number of points the curve is drawn through; fewer are used where the curve is flat. Minimum number is 2.
+\param r The red value of the bezier curve to draw. 
+\param g The green value of the bezier curve to draw. 
+\param b The blue value of the bezier curve to draw. 
+\param a The alpha value of the bezier curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _bezierRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	int i, depth;
+	double *p;
+	SDL2_gfxPolyline line;
+
+	/*
+	* Sanity check 
+	*/
+	if (n < 3) {
+		return (-1);
+	}
+	if (s < 2) {
+		return (-1);
+	}
+
+	/*
+	* Skip curves outside of the visible area; the curve stays within the
+	* bounding box of its control points
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, 1)) {
+		return (0);
+	}
+
+	/*
+	* Subdivide at most until the curve has s points 
+	*/
+	depth = 0;
+	while ((depth < SDL2_GFX_BEZIER_DEPTH) && ((2 << depth) <= s - 1)) {
+		depth++;
+	}
+
+	/* Transfer vertices into a float array followed by the subdivision memory */
+	if ((p=(double *)_gfxScratch(&dst->context->bezier, (2 + 4 * depth)*sizeof(double)*n))==NULL) {
+		return(-1);
+	}
+	for (i=0; i<n; i++) {
+		p[2 * i]=(double)vx[i];
+		p[2 * i + 1]=(double)vy[i];
+	}      
+
+	/*
+	* Flatten the curve 
+	*/
+	_gfxBeginPolyline(&line, dst);
+	if (_gfxPolylinePoint(&line, p[0], p[1])) {
+		return (-1);
+	}
+	if (_gfxFlattenBezier(&line, p, n, depth, p + 2 * n)) {
+		return (-1);
+	}
+
+	/*
+	* Draw 
+	*/
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+	result |= _gfxDrawPolyline(dst, &line);
+
+	return (result);
+}
+
+/*!
+\brief Draw a bezier curve with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the bezier curve.
+\param vy Vertex array containing Y coordinates of the points of the bezier curve.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param s Maximum number of points the curve is drawn through; fewer are used where the curve is flat. Minimum number is 2.
+\param r The red value of the bezier curve to draw. 
+\param g The green value of the bezier curve to draw. 
+\param b The blue value of the bezier curve to draw. 
+\param a The alpha value of the bezier curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierRGBA(&dst, vx, vy, n, s, r, g, b, a));
+}
+
+/*!
+\brief Draw a cubic bezier curve segment with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx1 X coordinate of the first control point.
+\param cy1 Y coordinate of the first control point.
+\param cx2 X coordinate of the second control point.
+\param cy2 Y coordinate of the second control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param color The color value of the curve to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierCubicColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierCubicRGBA(renderer, x1, y1, cx1, cy1, cx2, cy2, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw a cubic bezier curve segment with alpha blending.
+
+The number of lines adapts to the curvature; the curve is drawn as one connected line.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx1 X coordinate of the first control point.
+\param cy1 Y coordinate of the first control point.
+\param cx2 X coordinate of the second control point.
+\param cy2 Y coordinate of the second control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _bezierCubicRGBA(SDL2_gfxTarget *dst, double x1, double y1, double cx1, double cy1, double cx2, double cy2, double x2, double y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	double p[8];
+	SDL2_gfxPolyline line;
+
+	p[0] = x1;
+	p[1] = y1;
+	p[2] = cx1;
+	p[3] = cy1;
+	p[4] = cx2;
+	p[5] = cy2;
+	p[6] = x2;
+	p[7] = y2;
+
+	/*
+	* Skip segments outside of the visible area; the curve stays within the
+	* bounding box of its control points
+	*/
+	if ((dst->cull) && 
+		(_gfxCull(dst, 
+			(int)SDL_floor(SDL_min(SDL_min(x1, cx1), SDL_min(cx2, x2))) - 1, 
+			(int)SDL_floor(SDL_min(SDL_min(y1, cy1), SDL_min(cy2, y2))) - 1, 
+			(int)SDL_ceil(SDL_max(SDL_max(x1, cx1), SDL_max(cx2, x2))) + 1, 
+			(int)SDL_ceil(SDL_max(SDL_max(y1, cy1), SDL_max(cy2, y2))) + 1))) {
+		return (0);
+	}
+
+	_gfxBeginPolyline(&line, dst);
+	if (_gfxPolylinePoint(&line, x1, y1)) {
+		return (-1);
+	}
+	if (_gfxFlattenCubic(&line, p, SDL2_GFX_BEZIER_DEPTH)) {
+		return (-1);
+	}
+
+	result = 0;
+	result |= _gfxColor(dst, r, g, b, a);
+	result |= _gfxDrawPolyline(dst, &line);
+
+	return (result);
+}
+
+/*!
+\brief Draw a cubic bezier curve segment with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx1 X coordinate of the first control point.
+\param cy1 Y coordinate of the first control point.
+\param cx2 X coordinate of the second control point.
+\param cy2 Y coordinate of the second control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierCubicRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierCubicRGBA(&dst, x1, y1, cx1, cy1, cx2, cy2, x2, y2, r, g, b, a));
+}
+
+/*!
+\brief Draw a quadratic bezier curve segment with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx X coordinate of the control point.
+\param cy Y coordinate of the control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param color The color value of the curve to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierQuadColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierQuadRGBA(renderer, x1, y1, cx, cy, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw a quadratic bezier curve segment with alpha blending.
+
+The segment is drawn as the equivalent cubic segment.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx X coordinate of the control point.
+\param cy Y coordinate of the control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _bezierQuadRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	return _bezierCubicRGBA(dst, x1, y1,
+		x1 + 2.0 * (cx - x1) / 3.0, y1 + 2.0 * (cy - y1) / 3.0,
+		x2 + 2.0 * (cx - x2) / 3.0, y2 + 2.0 * (cy - y2) / 3.0,
+		x2, y2, r, g, b, a);
+}
+
+/*!
+\brief Draw a quadratic bezier curve segment with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx X coordinate of the control point.
+\param cy Y coordinate of the control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierQuadRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierQuadRGBA(&dst, x1, y1, cx, cy, x2, y2, r, g, b, a));
+}
+
+
+/*!
+\brief Draw a thick line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param width Width of the line in pixels. Must be >0.
+\param color The color value of the line to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int thickLineColor(SDL_Renderer *renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint32 color)
+{	
+	Uint8 *c = (Uint8 *)&color; 
+	return thickLineRGBA(renderer, x1, y1, x2, y2, width, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw a thick line with alpha blending.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param width Width of the line in pixels. Must be >0.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/	
+static int _thickLineRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int wh;
+	double dx, dy, dx1, dy1, dx2, dy2;
+	double l, wl2, nx, ny, ang, adj;
+	Sint16 px[4], py[4];
+
+	if ((dst->renderer == NULL) && (dst->surface == NULL)) {
+		return -1;
+	}
+
+	if (width < 1) {
+		return -1;
+	}
+
+	/* Skip lines outside of the visible area */
+	if (_gfxCull(dst, SDL_min(x1, x2) - width, SDL_min(y1, y2) - width, SDL_max(x1, x2) + width, SDL_max(y1, y2) + width)) {
+		return 0;
+	}
+
+	/* Special case: thick "point" */
+	if ((x1 == x2) && (y1 == y2)) {
+		wh = width / 2;
+		return _boxRGBA(dst, x1 - wh, y1 - wh, x2 + width, y2 + width, r, g, b, a);		
+	}
+
+	/* Special case: width == 1 */
+	if (width == 1) {
+		return _lineRGBA(dst, x1, y1, x2, y2, r, g, b, a);		
+	}
+
+	/* Calculate offsets for sides */
+	dx = (double)(x2 - x1);
+	dy = (double)(y2 - y1);
+	l = SDL_sqrt(dx*dx + dy*dy);
+	ang = SDL_atan2(dx, dy);
+	adj = 0.1 + 0.9 * SDL_fabs(SDL_cos(2.0 * ang));
+	wl2 = ((double)width - adj)/(2.0 * l);
+	nx = dx * wl2;
+	ny = dy * wl2;
+
+	/* Build polygon */
+	dx1 = (double)x1;
+	dy1 = (double)y1;
+	dx2 = (double)x2;
+	dy2 = (double)y2;
+	px[0] = (Sint16)(dx1 + ny);
+	px[1] = (Sint16)(dx1 - ny);
+	px[2] = (Sint16)(dx2 - ny);
+	px[3] = (Sint16)(dx2 + ny);
+	py[0] = (Sint16)(dy1 - nx);
+	py[1] = (Sint16)(dy1 + nx);
+	py[2] = (Sint16)(dy2 + nx);
+	py[3] = (Sint16)(dy2 - nx);
+
+	/* Draw polygon */
+	return _filledPolygonRGBA(dst, px, py, 4, r, g, b, a);
+}
+
+/*!
+\brief Draw a thick line with alpha blending.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param width Width of the line in pixels. Must be >0.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/	
+int thickLineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _thickLineRGBA(&dst, x1, y1, x2, y2, width, r, g, b, a));
+}
+
+/* ---- Thick Polyline */
+
+/*!
+\brief Longest miter of a GFX_JOIN_MITER corner in half line widths; longer miters are beveled.
+*/
+#ifndef SDL2_GFX_MITER_LIMIT
+#define SDL2_GFX_MITER_LIMIT 4.0
+#endif
+
+/*!
+\brief Maximum distance in pixels between a round join or cap and its polygon approximation.
+*/
+#define SDL2_GFX_ROUND_TOLERANCE 0.25
+
+/*!
+\brief Internal function to add a fan of triangles along a circular arc to a mesh.
+
+The first and last point of the arc must already be in the mesh; the points in between
+are added.
+
+\param mesh The mesh to add to.
+\param pivot Index of the point all triangles share.
+\param first Index of the point at the start of the arc.
+\param last Index of the point at the end of the arc.
+\param cx X coordinate of the center of the arc.
+\param cy Y coordinate of the center of the arc.
+\param radius The radius of the arc.
+\param angle The angle of the first point in radians.
+\param sweep The angle from the first to the last point in radians.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxStrokeArc(SDL2_gfxMesh *mesh, int pivot, int first, int last, double cx, double cy, double radius, double angle, double sweep)
+{
+	int i, steps, prev, next;
+
+	steps = 1;
+	if (radius > SDL2_GFX_ROUND_TOLERANCE) {
+		steps = (int)SDL_ceil(SDL_fabs(sweep) / (2.0 * SDL_acos(1.0 - SDL2_GFX_ROUND_TOLERANCE / radius)));
+	}
+	if (steps < 2) {
+		steps = 2;
+	}
+
+	if (_gfxReserveMesh(mesh, steps, 3 * steps)) {
+		return -1;
+	}
+	prev = first;
+	for (i = 1; i <= steps; i++) {
+		if (i == steps) {
+			next = last;
+		} else {
+			next = _gfxMeshPoint(mesh,
+				cx + radius * SDL_cos(angle + sweep * i / steps),
+				cy + radius * SDL_sin(angle + sweep * i / steps));
+		}
+		if (prev != pivot) {
+			_gfxMeshTriangle(mesh, pivot, prev, next);
+		}
+		prev = next;
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add the two triangles of a line segment to a mesh.
+
+\param mesh The mesh to add to. Room for 6 indices must have been reserved.
+\param left1 Index of the left point at the start of the segment.
+\param right1 Index of the right point at the start of the segment.
+\param left2 Index of the left point at the end of the segment.
+\param right2 Index of the right point at the end of the segment.
+*/
+static void _gfxStrokeSegment(SDL2_gfxMesh *mesh, int left1, int right1, int left2, int right2)
+{
+	_gfxMeshTriangle(mesh, left1, right1, right2);
+	_gfxMeshTriangle(mesh, left1, right2, left2);
+}
+
+/*!
+\brief Internal function to add a cap at the start or end of a thick polyline to a mesh.
+
+\param mesh The mesh to add to.
+\param x X coordinate of the end point of the line.
+\param y Y coordinate of the end point of the line.
+\param dx X component of the unit direction of the line at the end point.
+\param dy Y component of the unit direction of the line at the end point.
+\param hw Half the width of the line.
+\param cap The shape of the cap.
+\param start 1 for the cap at the first point, 0 for the cap at the last point.
+\param left Index of the left point of the line; set to the new left point.
+\param right Index of the right point of the line; set to the new right point.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxStrokeCap(SDL2_gfxMesh *mesh, double x, double y, double dx, double dy, double hw, gfxLineCap cap, int start, int *left, int *right)
+{
+	double nx, ny, ox, oy;
+	int l, r;
+
+	nx = -dy * hw;
+	ny = dx * hw;
+	ox = oy = 0.0;
+	if (cap == GFX_CAP_SQUARE) {
+		ox = (start) ? -dx * hw : dx * hw;
+		oy = (start) ? -dy * hw : dy * hw;
+	}
+
+	if (_gfxReserveMesh(mesh, 2, 6)) {
+		return -1;
+	}
+	l = _gfxMeshPoint(mesh, x + ox + nx, y + oy + ny);
+	r = _gfxMeshPoint(mesh, x + ox - nx, y + oy - ny);
+	if (!start) {
+		_gfxStrokeSegment(mesh, *left, *right, l, r);
+	}
+	*left = l;
+	*right = r;
+
+	if (cap == GFX_CAP_ROUND) {
+		if (start) {
+			return _gfxStrokeArc(mesh, r, r, l, x, y, hw, SDL_atan2(-ny, -nx), -M_PI);
+		} else {
+			return _gfxStrokeArc(mesh, l, l, r, x, y, hw, SDL_atan2(ny, nx), -M_PI);
+		}
+	}
+
+	return 0;
+}
+
+/*!
+\brief Internal function to add a line segment ending in a join to a mesh.
+
+The inner corner of the join is the intersection of the inner sides of both segments
+unless that lies beyond one of them; then both segments end at their own inner point
+and the corner is filled around the join point instead.
+
+\param mesh The mesh to add to.
+\param x X coordinate of the join point.
+\param y Y coordinate of the join point.
+\param ax X component of the unit direction of the incoming segment.
+\param ay Y component of the unit direction of the incoming segment.
+\param al Length of the incoming segment.
+\param bx X component of the unit direction of the outgoing segment.
+\param by Y component of the unit direction of the outgoing segment.
+\param bl Length of the outgoing segment.
+\param hw Half the width of the line.
+\param join The shape of the join.
+\param left Index of the left point at the start of the incoming segment; set to the left point of the outgoing segment.
+\param right Index of the right point at the start of the incoming segment; set to the right point of the outgoing segment.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxStrokeJoin(SDL2_gfxMesh *mesh, double x, double y, double ax, double ay, double al, double bx, double by, double bl,
+	double hw, gfxLineJoin join, int *left, int *right)
+{
+	double cross, dot, side, mx, my, ml, cosHalf, miter;
+	int outerA, outerB, innerA, innerB, pivot, corner;
+
+	cross = ax * by - ay * bx;
+	dot = ax * bx + ay * by;
+
+	if (_gfxReserveMesh(mesh, 5, 12)) {
+		return -1;
+	}
+
+	/*
+	* Straight continuation 
+	*/
+	if ((SDL_fabs(cross) < 1e-9) && (dot > 0.0)) {
+		innerA = _gfxMeshPoint(mesh, x - ay * hw, y + ax * hw);
+		innerB = _gfxMeshPoint(mesh, x + ay * hw, y - ax * hw);
+		_gfxStrokeSegment(mesh, *left, *right, innerA, innerB);
+		*left = innerA;
+		*right = innerB;
+		return 0;
+	}
+
+	/*
+	* The outer corner is on the left side (+normal) when turning right 
+	*/
+	side = (cross > 0.0) ? -1.0 : 1.0;
+	mx = -ay - by;
+	my = ax + bx;
+	ml = SDL_sqrt(mx * mx + my * my);
+	cosHalf = ml / 2.0;
+	miter = 0.0;
+	if (cosHalf > 1e-6) {
+		mx /= ml;
+		my /= ml;
+		miter = hw / cosHalf;
+	}
+
+	outerA = _gfxMeshPoint(mesh, x - side * ay * hw, y + side * ax * hw);
+	outerB = _gfxMeshPoint(mesh, x - side * by * hw, y + side * bx * hw);
+	if ((cosHalf > 1e-6) && (hw * SDL_sqrt(1.0 - cosHalf * cosHalf) / cosHalf <= SDL_min(al, bl))) {
+		innerA = innerB = _gfxMeshPoint(mesh, x - side * mx * miter, y - side * my * miter);
+		pivot = innerA;
+	} else {
+		innerA = _gfxMeshPoint(mesh, x + side * ay * hw, y - side * ax * hw);
+		innerB = _gfxMeshPoint(mesh, x + side * by * hw, y - side * bx * hw);
+		pivot = _gfxMeshPoint(mesh, x, y);
+	}
+
+	/*
+	* Incoming segment 
+	*/
+	if (side > 0.0) {
+		_gfxStrokeSegment(mesh, *left, *right, outerA, innerA);
+		*left = outerB;
+		*right = innerB;
+	} else {
+		_gfxStrokeSegment(mesh, *left, *right, innerA, outerA);
+		*left = innerB;
+		*right = outerB;
+	}
+
+	/*
+	* Corner 
+	*/
+	if ((join == GFX_JOIN_MITER) && (cosHalf > 1e-6) && (miter <= SDL2_GFX_MITER_LIMIT * hw)) {
+		corner = _gfxMeshPoint(mesh, x + side * mx * miter, y + side * my * miter);
+		_gfxMeshTriangle(mesh, pivot, outerA, corner);
+		_gfxMeshTriangle(mesh, pivot, corner, outerB);
+		return 0;
+	}
+	_gfxMeshTriangle(mesh, pivot, outerA, outerB);
+	if (join == GFX_JOIN_ROUND) {
+		return _gfxStrokeArc(mesh, outerA, outerA, outerB, x, y, hw, SDL_atan2(side * ax, -side * ay), SDL_atan2(cross, dot));
+	}
+
+	return 0;
+}
+
+/*!
+\brief Draw a thick polyline with joins and caps with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the polyline.
+\param vy Vertex array containing Y coordinates of the points of the polyline.
+\param n Number of points in the vertex array.
+\param width Width of the line in pixels. Must be >0.
+\param join The shape of the corners between segments (GFX_JOIN_MITER, GFX_JOIN_ROUND or GFX_JOIN_BEVEL).
+\param cap The shape of the line ends (GFX_CAP_BUTT, GFX_CAP_ROUND or GFX_CAP_SQUARE).
+\param color The color value of the line to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int thickPolylineColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return thickPolylineRGBA(renderer, vx, vy, n, width, join, cap, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Internal function to draw a thick polyline with joins and caps with alpha blending.
+
+The outline is built as one triangle mesh without overlaps between segments, joins
+and caps (except at inner corners sharper than the line is wide), so translucent
+lines are blended once per pixel.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the polyline.
+\param vy Vertex array containing Y coordinates of the points of the polyline.
+\param n Number of points in the vertex array.
+\param width Width of the line in pixels. Must be >0.
+\param join The shape of the corners between segments.
+\param cap The shape of the line ends.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _thickPolylineRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxMesh mesh;
+	double hw, x, y, ax, ay, al, bx, by, bl;
+	int i, j, left, right, center, first;
+
+	if ((dst->renderer == NULL) && (dst->surface == NULL)) {
+		return -1;
+	}
+
+	/*
+	* Sanity check 
+	*/
+	if ((vx == NULL) || (vy == NULL) || (n < 1) || (width < 1)) {
+		return -1;
+	}
+
+	/*
+	* Skip polylines outside of the visible area, including miters and caps
+	*/
+	if (_gfxCullPoints(dst, vx, vy, n, (int)(SDL2_GFX_MITER_LIMIT * width / 2.0) + width + 1)) {
+		return 0;
+	}
+
+	hw = (double)width / 2.0;
+	_gfxBeginMesh(&mesh, dst);
+
+	/*
+	* First segment, skipping repeated points 
+	*/
+	for (j = 1; (j < n) && (vx[j] == vx[0]) && (vy[j] == vy[0]); j++);
+	x = vx[0] + 0.5;
+	y = vy[0] + 0.5;
+	if (j == n) {
+		/* A single point is a square or a dot */
+		if (cap == GFX_CAP_SQUARE) {
+			if (_gfxReserveMesh(&mesh, 4, 6)) {
+				return -1;
+			}
+			left = _gfxMeshPoint(&mesh, x - hw, y - hw);
+			right = _gfxMeshPoint(&mesh, x + hw, y - hw);
+			_gfxStrokeSegment(&mesh, left, right, 
+				_gfxMeshPoint(&mesh, x - hw, y + hw), _gfxMeshPoint(&mesh, x + hw, y + hw));
+		} else if (cap == GFX_CAP_ROUND) {
+			if (_gfxReserveMesh(&mesh, 2, 0)) {
+				return -1;
+			}
+			center = _gfxMeshPoint(&mesh, x, y);
+			first = _gfxMeshPoint(&mesh, x + hw, y);
+			if (_gfxStrokeArc(&mesh, center, first, first, x, y, hw, 0.0, 2.0 * M_PI)) {
+				return -1;
+			}
+		}
+		return _gfxDrawMesh(dst, &mesh, r, g, b, a);
+	}
+	ax = (double)(vx[j] - vx[0]);
+	ay = (double)(vy[j] - vy[0]);
+	al = SDL_sqrt(ax * ax + ay * ay);
+	ax /= al;
+	ay /= al;
+	if (_gfxStrokeCap(&mesh, x, y, ax, ay, hw, cap, 1, &left, &right)) {
+		return -1;
+	}
+
+	/*
+	* Segments and joins 
+	*/
+	i = j;
+	for (;;) {
+		for (j = i + 1; (j < n) && (vx[j] == vx[i]) && (vy[j] == vy[i]); j++);
+		x = vx[i] + 0.5;
+		y = vy[i] + 0.5;
+		if (j == n) {
+			break;
+		}
+		bx = (double)(vx[j] - vx[i]);
+		by = (double)(vy[j] - vy[i]);
+		bl = SDL_sqrt(bx * bx + by * by);
+		bx /= bl;
+		by /= bl;
+		if (_gfxStrokeJoin(&mesh, x, y, ax, ay, al, bx, by, bl, hw, join, &left, &right)) {
+			return -1;
+		}
+		ax = bx;
+		ay = by;
+		al = bl;
+		i = j;
+	}
+
+	/*
+	* Last segment 
+	*/
+	if (_gfxStrokeCap(&mesh, x, y, ax, ay, hw, cap, 0, &left, &right)) {
+		return -1;
+	}
+
+	return _gfxDrawMesh(dst, &mesh, r, g, b, a);
+}
+
+/*!
+\brief Draw a thick polyline with joins and caps with alpha blending.
+
+\param renderer The renderer to draw on.
+\param vx Vertex array containing X coordinates of the points of the polyline.
+\param vy Vertex array containing Y coordinates of the points of the polyline.
+\param n Number of points in the vertex array.
+\param width Width of the line in pixels. Must be >0.
+\param join The shape of the corners between segments (GFX_JOIN_MITER, GFX_JOIN_ROUND or GFX_JOIN_BEVEL).
+\param cap The shape of the line ends (GFX_CAP_BUTT, GFX_CAP_ROUND or GFX_CAP_SQUARE).
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int thickPolylineRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _thickPolylineRGBA(&dst, vx, vy, n, width, join, cap, r, g, b, a));
+}
+
+/* ---- Instances */
+
+/*!
+\brief Internal function to get the bounding box of a tessellated shape.
+
+\param shape The tessellated shape; must not be empty.
+\param x1 Returns the X coordinate of the left edge.
+\param y1 Returns the Y coordinate of the top edge.
+\param x2 Returns the X coordinate of the right edge (inclusive).
+\param y2 Returns the Y coordinate of the bottom edge (inclusive).
+*/
+static void _gfxShapeBounds(const SDL2_gfxShape *shape, int *x1, int *y1, int *x2, int *y2)
+{
+	int i;
+
+	if (shape->numPoints > 0) {
+		*x1 = *x2 = shape->points[0].x;
+		*y1 = *y2 = shape->points[0].y;
+	} else {
+		*x1 = shape->rects[0].x;
+		*y1 = shape->rects[0].y;
+		*x2 = shape->rects[0].x + shape->rects[0].w - 1;
+		*y2 = shape->rects[0].y + shape->rects[0].h - 1;
+	}
+	for (i = 0; i < shape->numPoints; i++) {
+		*x1 = SDL_min(*x1, shape->points[i].x);
+		*y1 = SDL_min(*y1, shape->points[i].y);
+		*x2 = SDL_max(*x2, shape->points[i].x);
+		*y2 = SDL_max(*y2, shape->points[i].y);
+	}
+	for (i = 0; i < shape->numRects; i++) {
+		*x1 = SDL_min(*x1, shape->rects[i].x);
+		*y1 = SDL_min(*y1, shape->rects[i].y);
+		*x2 = SDL_max(*x2, shape->rects[i].x + shape->rects[i].w - 1);
+		*y2 = SDL_max(*y2, shape->rects[i].y + shape->rects[i].h - 1);
+	}
+}
+
+/*!
+\brief Internal function to draw a tessellated shape at many positions with one color per instance.
+
+With SDL 2.0.18 or newer every pixel and rectangle of every instance becomes a quad of a
+single SDL_RenderGeometry call; otherwise each instance is drawn like a single shape.
+
+\param dst The target to draw on.
+\param shape The tessellated shape.
+\param x Array of the X offsets of the instances.
+\param y Array of the Y offsets of the instances.
+\param count Number of instances.
+\param colors Array of the colors of the instances (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawInstances(SDL2_gfxTarget *dst, const SDL2_gfxShape *shape, const Sint16 *x, const Sint16 *y, int count, const Uint32 *colors)
+{
+	int result = 0;
+	int i;
+	const Uint8 *c;
+	int x1, y1, x2, y2;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL2_gfxGeometry geometry;
+	SDL_Color color;
+	int j, v, quads, blend;
+	float qx, qy, qw, qh;
+#endif
+
+	/*
+	* Bounding box of the shape for culling the instances 
+	*/
+	_gfxShapeBounds(shape, &x1, &y1, &x2, &y2);
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	if (!dst->surface) {
+		/* Flush first, so the batch does not change the blend mode set here */
+		if (dst->batch) {
+			result |= gfxFlushBatch(dst->batch);
+		}
+		blend = (shape->weights != NULL);
+		for (i = 0; (i < count) && (!blend); i++) {
+			c = (const Uint8 *)&colors[i];
+			blend = (c[3] != 255);
+		}
+		result |= _gfxSetBlendMode(dst->renderer, dst->state, (blend) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+		quads = shape->numPoints + shape->numRects;
+		_gfxBeginGeometry(&geometry, dst);
+		if (_gfxReserveGeometry(&geometry, 4 * quads * count, 6 * quads * count)) {
+			return -1;
+		}
+		for (i = 0; i < count; i++) {
+			if (_gfxCull(dst, x1 + x[i], y1 + y[i], x2 + x[i], y2 + y[i])) {
+				continue;
+			}
+			c = (const Uint8 *)&colors[i];
+			color.r = c[0];
+			color.g = c[1];
+			color.b = c[2];
+			for (j = 0; j < quads; j++) {
+				if (j < shape->numPoints) {
+					qx = (float)(shape->points[j].x + x[i]);
+					qy = (float)(shape->points[j].y + y[i]);
+					qw = 1.0f;
+					qh = 1.0f;
+					color.a = (shape->weights) ? (Uint8)((c[3] * shape->weights[j]) >> 8) : c[3];
+				} else {
+					qx = (float)(shape->rects[j - shape->numPoints].x + x[i]);
+					qy = (float)(shape->rects[j - shape->numPoints].y + y[i]);
+					qw = (float)shape->rects[j - shape->numPoints].w;
+					qh = (float)shape->rects[j - shape->numPoints].h;
+					color.a = c[3];
+				}
+				v = _gfxGeometryVertex(&geometry, qx, qy, 0.0f, 0.0f, color);
+				_gfxGeometryVertex(&geometry, qx + qw, qy, 0.0f, 0.0f, color);
+				_gfxGeometryVertex(&geometry, qx + qw, qy + qh, 0.0f, 0.0f, color);
+				_gfxGeometryVertex(&geometry, qx, qy + qh, 0.0f, 0.0f, color);
+				_gfxGeometryTriangle(&geometry, v, v + 1, v + 2);
+				_gfxGeometryTriangle(&geometry, v, v + 2, v + 3);
+			}
+		}
+
+		if (geometry.numIndices > 0) {
+			result |= _gfxGeometry(dst, NULL, geometry.vertices, geometry.numVertices, geometry.indices, geometry.numIndices);
+		}
+		return result;
+	}
+#endif
+
+	for (i = 0; i < count; i++) {
+		if (_gfxCull(dst, x1 + x[i], y1 + y[i], x2 + x[i], y2 + y[i])) {
+			continue;
+		}
+		c = (const Uint8 *)&colors[i];
+		if (shape->weights) {
+			result |= _gfxDrawWeighted(dst, shape, x[i], y[i], c[0], c[1], c[2], c[3]);
+		} else {
+			result |= _gfxColor(dst, c[0], c[1], c[2], c[3]);
+			result |= _gfxDrawTessellated(dst, shape, x[i], y[i]);
+		}
+	}
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw a shape of a single pixel at many positions.
+
+\param dst The target to draw on.
+\param x Array of the X coordinates of the pixels.
+\param y Array of the Y coordinates of the pixels.
+\param count Number of pixels.
+\param colors Array of the colors of the pixels (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawPixelInstances(SDL2_gfxTarget *dst, const Sint16 *x, const Sint16 *y, int count, const Uint32 *colors)
+{
+	SDL2_gfxShape pixel;
+	SDL_Point origin;
+
+	origin.x = 0;
+	origin.y = 0;
+	memset(&pixel, 0, sizeof(pixel));
+	pixel.points = &origin;
+	pixel.numPoints = 1;
+
+	return _gfxDrawInstances(dst, &pixel, x, y, count, colors);
+}
+
+/*!
+\brief Internal function to draw many filled circles of the same radius with blending, each in its own color.
+
+\param dst The target to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledCirclesRGBA(SDL2_gfxTarget *dst, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
+{
+	SDL2_gfxShape key, tessellated;
+	const SDL2_gfxShape *shape;
+
+	/*
+	* Sanity check arguments 
+	*/
+	if ((cx == NULL) || (cy == NULL) || (colors == NULL) || (rad < 0)) {
+		return (-1);
+	}
+	if (count <= 0) {
+		return (0);
+	}
+
+	/*
+	* Special case for rad=0 - draw points 
+	*/
+	if (rad == 0) {
+		return (_gfxDrawPixelInstances(dst, cx, cy, count, colors));
+	}
+
+	key.type = SDL2_GFX_SHAPE_ELLIPSE;
+	key.rx = rad;
+	key.ry = rad;
+	key.start = 0;
+	key.end = 0;
+	key.filled = 1;
+	shape = _gfxGetShape(dst, &key, _gfxTessellateEllipse, &tessellated);
+	if (shape == NULL) {
+		return (-1);
+	}
+
+	return (_gfxDrawInstances(dst, shape, cx, cy, count, colors));
+}
+
+/*!
+\brief Draw many filled circles of the same radius with blending, each in its own color.
+
+The circle is tessellated once and all circles are submitted together: with
+SDL 2.0.18 or newer as one SDL_RenderGeometry call.
+
+\param renderer The renderer to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledCirclesRGBA(SDL_Renderer * renderer, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCirclesRGBA(&dst, cx, cy, count, rad, colors));
+}
+
+/*!
+\brief Internal function to draw many anti-aliased circles of the same radius with blending, each in its own color.
+
+\param dst The target to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _aacirclesRGBA(SDL2_gfxTarget *dst, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
+{
+	SDL2_gfxShape key, tessellated;
+	const SDL2_gfxShape *shape;
+
+	/*
+	* Sanity check arguments 
+	*/
+	if ((cx == NULL) || (cy == NULL) || (colors == NULL) || (rad < 0)) {
+		return (-1);
+	}
+	if (count <= 0) {
+		return (0);
+	}
+
+	/*
+	* Special case for rad=0 - draw points 
+	*/
+	if (rad == 0) {
+		return (_gfxDrawPixelInstances(dst, cx, cy, count, colors));
+	}
+
+	key.type = SDL2_GFX_SHAPE_AA_ELLIPSE;
+	key.rx = rad;
+	key.ry = rad;
+	key.start = 0;
+	key.end = 0;
+	key.filled = 0;
+	shape = _gfxGetShape(dst, &key, _gfxTessellateAAEllipse, &tessellated);
+	if (shape == NULL) {
+		return (-1);
+	}
+
+	return (_gfxDrawInstances(dst, shape, cx, cy, count, colors));
+}
+
+/*!
+\brief Draw many anti-aliased circles of the same radius with blending, each in its own color.
+
+The circle is tessellated once and all circles are submitted together: with
+SDL 2.0.18 or newer as one SDL_RenderGeometry call.
+
+\param renderer The renderer to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aacirclesRGBA(SDL_Renderer * renderer, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _aacirclesRGBA(&dst, cx, cy, count, rad, colors));
+}
+
+/*!
+\brief Internal function to draw many boxes (filled rectangles) of the same size with blending, each in its own color.
+
+\param dst The target to draw on.
+\param x Array of the X coordinates of the upper left corners of the boxes.
+\param y Array of the Y coordinates of the upper left corners of the boxes.
+\param count Number of boxes.
+\param w Width in pixels of the boxes.
+\param h Height in pixels of the boxes.
+\param colors Array of the colors of the boxes (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _boxesRGBA(SDL2_gfxTarget *dst, const Sint16 * x, const Sint16 * y, int count, Sint16 w, Sint16 h, const Uint32 * colors)
+{
+	SDL2_gfxShape box;
+	SDL_Rect rect;
+
+	/*
+	* Sanity check arguments 
+	*/
+	if ((x == NULL) || (y == NULL) || (colors == NULL) || (w < 0) || (h < 0)) {
+		return (-1);
+	}
+	if ((count <= 0) || (w == 0) || (h == 0)) {
+		return (0);
+	}
+
+	rect.x = 0;
+	rect.y = 0;
+	rect.w = w;
+	rect.h = h;
+	memset(&box, 0, sizeof(box));
+	box.rects = &rect;
+	box.numRects = 1;
+
+	return (_gfxDrawInstances(dst, &box, x, y, count, colors));
+}
+
+/*!
+\brief Draw many boxes (filled rectangles) of the same size with blending, each in its own color.
+
+All boxes are submitted together: with SDL 2.0.18 or newer as one SDL_RenderGeometry call.
+
+\param renderer The renderer to draw on.
+\param x Array of the X coordinates of the upper left corners of the boxes.
+\param y Array of the Y coordinates of the upper left corners of the boxes.
+\param count Number of boxes.
+\param w Width in pixels of the boxes.
+\param h Height in pixels of the boxes.
+\param colors Array of the colors of the boxes (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxesRGBA(SDL_Renderer * renderer, const Sint16 * x, const Sint16 * y, int count, Sint16 w, Sint16 h, const Uint32 * colors)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxesRGBA(&dst, x, y, count, w, h, colors));
+}
+
+/* ---- Gradients */
+
+/*!
+\brief Internal structure holding a linear gradient between two colors.
+
+The first row (or column) is drawn in the first color, the last one in the second color.
+*/
+typedef struct {
+	int vertical;
+	int first;
+	int last;
+	Uint8 c1[4];
+	Uint8 c2[4];
+} SDL2_gfxGradient;
+
+/*!
+\brief Internal function to set up a linear gradient.
+
+\param gradient The gradient to set up.
+\param direction The direction of the gradient.
+\param first The first row (vertical) or column (horizontal) of the gradient.
+\param last The last row (vertical) or column (horizontal) of the gradient.
+\param r1 The red value of the first color.
+\param g1 The green value of the first color.
+\param b1 The blue value of the first color.
+\param a1 The alpha value of the first color.
+\param r2 The red value of the second color.
+\param g2 The green value of the second color.
+\param b2 The blue value of the second color.
+\param a2 The alpha value of the second color.
+
+\returns Returns 0 on success, -1 for an invalid direction.
+*/
+static int _gfxSetGradient(SDL2_gfxGradient *gradient, gfxGradientDirection direction, int first, int last,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	if ((direction != GFX_GRADIENT_VERTICAL) && (direction != GFX_GRADIENT_HORIZONTAL)) {
+		return -1;
+	}
+
+	gradient->vertical = (direction == GFX_GRADIENT_VERTICAL);
+	gradient->first = first;
+	gradient->last = last;
+	gradient->c1[0] = r1;
+	gradient->c1[1] = g1;
+	gradient->c1[2] = b1;
+	gradient->c1[3] = a1;
+	gradient->c2[0] = r2;
+	gradient->c2[1] = g2;
+	gradient->c2[2] = b2;
+	gradient->c2[3] = a2;
+
+	return 0;
+}
+
+/*!
+\brief Internal function to interpolate between two colors.
+
+\param c1 The first color (r, g, b, a).
+\param c2 The second color (r, g, b, a).
+\param pos Position between the colors; clamped to 0..steps.
+\param steps Number of steps between the colors.
+\param color Returns the interpolated color.
+*/
+static void _gfxLerpColor(const Uint8 *c1, const Uint8 *c2, int pos, int steps, SDL_Color *color)
+{
+	if (steps <= 0) {
+		pos = 0;
+		steps = 1;
+	} else if (pos < 0) {
+		pos = 0;
+	} else if (pos > steps) {
+		pos = steps;
+	}
+
+	color->r = (Uint8)((c1[0] * (steps - pos) + c2[0] * pos + steps / 2) / steps);
+	color->g = (Uint8)((c1[1] * (steps - pos) + c2[1] * pos + steps / 2) / steps);
+	color->b = (Uint8)((c1[2] * (steps - pos) + c2[2] * pos + steps / 2) / steps);
+	color->a = (Uint8)((c1[3] * (steps - pos) + c2[3] * pos + steps / 2) / steps);
+}
+
+/*!
+\brief Internal function to get the color of a linear gradient.
+
+\param gradient The gradient.
+\param pos Position in half pixels from the center of the first row (or column).
+\param color Returns the color at the position.
+*/
+static void _gfxGradientColor(const SDL2_gfxGradient *gradient, int pos, SDL_Color *color)
+{
+	_gfxLerpColor(gradient->c1, gradient->c2, pos, 2 * (gradient->last - gradient->first), color);
+}
+
+/*!
+\brief Internal function to compare two colors.
+
+\returns Returns 1 if the colors are equal, 0 otherwise.
+*/
+static int _gfxSameColor(const SDL_Color *c1, const SDL_Color *c2)
+{
+	return ((c1->r == c2->r) && (c1->g == c2->g) && (c1->b == c2->b) && (c1->a == c2->a));
+}
+
+/*!
+\brief Internal function to fill rectangles with a linear gradient in bands of one color.
+
+Rows (or columns) of equal color form a band, and the parts of all rectangles within
+a band are filled with one color change and one call.
+
+\param dst The target to draw on.
+\param gradient The gradient; it must span all rectangles.
+\param rects The rectangles to fill.
+\param n Number of rectangles.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxFillGradientBands(SDL2_gfxTarget *dst, const SDL2_gfxGradient *gradient, const SDL_Rect *rects, int n)
+{
+	int result = 0;
+	int i, pos, end, lo, hi, count;
+	SDL_Color c, next;
+	SDL_Rect *band;
+
+	band = (SDL_Rect *)_gfxScratch(&dst->context->runs, sizeof(SDL_Rect) * n);
+	if (band == NULL) {
+		return -1;
+	}
+
+	for (pos = gradient->first; pos <= gradient->last; pos = end) {
+		_gfxGradientColor(gradient, 2 * (pos - gradient->first), &c);
+		for (end = pos + 1; end <= gradient->last; end++) {
+			_gfxGradientColor(gradient, 2 * (end - gradient->first), &next);
+			if (!_gfxSameColor(&c, &next)) {
+				break;
+			}
+		}
+
+		for (i = 0, count = 0; i < n; i++) {
+			band[count] = rects[i];
+			if (gradient->vertical) {
+				lo = SDL_max(pos, rects[i].y);
+				hi = SDL_min(end, rects[i].y + rects[i].h);
+				band[count].y = lo;
+				band[count].h = hi - lo;
+			} else {
+				lo = SDL_max(pos, rects[i].x);
+				hi = SDL_min(end, rects[i].x + rects[i].w);
+				band[count].x = lo;
+				band[count].w = hi - lo;
+			}
+			if ((hi > lo) && (!_gfxCull(dst, band[count].x, band[count].y, band[count].x + band[count].w - 1, band[count].y + band[count].h - 1))) {
+				count++;
+			}
+		}
+		if (count > 0) {
+			result |= _gfxColor(dst, c.r, c.g, c.b, c.a);
+			result |= _gfxFillRects(dst, band, count);
+		}
+	}
+
+	return result;
+}
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+/*!
+\brief Internal function to add the rows (or columns) lo to hi-1 of a rectangle as a quad with a color at each end.
+
+\param geometry The geometry to add to. Room must have been reserved.
+\param rect The rectangle.
+\param vertical Flag selecting rows (=1) or columns (=0).
+\param lo The first row or column of the quad.
+\param hi The row or column after the quad.
+\param c1 The color of the top (or left) edge.
+\param c2 The color of the bottom (or right) edge.
+*/
+static void _gfxGradientQuad(SDL2_gfxGeometry *geometry, const SDL_Rect *rect, int vertical, int lo, int hi, SDL_Color c1, SDL_Color c2)
+{
+	float x1, y1, x2, y2;
+	int v;
+
+	if (vertical) {
+		x1 = (float)rect->x;
+		x2 = (float)(rect->x + rect->w);
+		y1 = (float)lo;
+		y2 = (float)hi;
+	} else {
+		x1 = (float)lo;
+		x2 = (float)hi;
+		y1 = (float)rect->y;
+		y2 = (float)(rect->y + rect->h);
+	}
+
+	v = _gfxGeometryVertex(geometry, x1, y1, 0.0f, 0.0f, c1);
+	_gfxGeometryVertex(geometry, x2, y1, 0.0f, 0.0f, (vertical) ? c1 : c2);
+	_gfxGeometryVertex(geometry, x2, y2, 0.0f, 0.0f, c2);
+	_gfxGeometryVertex(geometry, x1, y2, 0.0f, 0.0f, (vertical) ? c2 : c1);
+	_gfxGeometryTriangle(geometry, v, v + 1, v + 2);
+	_gfxGeometryTriangle(geometry, v, v + 2, v + 3);
+}
+#endif
+
+/*!
+\brief Internal function to fill rectangles with a linear gradient.
+
+With SDL 2.0.18 or newer every rectangle becomes a quad whose vertex colors are
+interpolated across it, and all quads are one SDL_RenderGeometry call. The edges
+between rows are given the mean of the colors of the rows next to them, so the
+center of every pixel gets its exact color; only the first and last row, whose
+outer edges lie beyond the gradient, are quads of a single color. Otherwise the
+rectangles are filled in bands of rows (or columns) of one color.
+
+\param dst The target to draw on.
+\param gradient The gradient; it must span all rectangles.
+\param rects The rectangles to fill.
+\param n Number of rectangles.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawGradientRects(SDL2_gfxTarget *dst, const SDL2_gfxGradient *gradient, const SDL_Rect *rects, int n)
+{
+	int result = 0;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL2_gfxGeometry geometry;
+	SDL_Color c1, c2;
+	int i, lo, hi, blend;
+
+	if (!dst->surface) {
+		/* Flush first, so the batch does not change the blend mode set here */
+		if (dst->batch) {
+			result |= gfxFlushBatch(dst->batch);
+		}
+		blend = ((gradient->c1[3] != 255) || (gradient->c2[3] != 255));
+		result |= _gfxSetBlendMode(dst->renderer, dst->state, (blend) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+		_gfxBeginGeometry(&geometry, dst);
+		if (_gfxReserveGeometry(&geometry, 12 * n, 18 * n)) {
+			return -1;
+		}
+		for (i = 0; i < n; i++) {
+			if (_gfxCull(dst, rects[i].x, rects[i].y, rects[i].x + rects[i].w - 1, rects[i].y + rects[i].h - 1)) {
+				continue;
+			}
+			lo = (gradient->vertical) ? rects[i].y : rects[i].x;
+			hi = lo + ((gradient->vertical) ? rects[i].h : rects[i].w);
+			if (lo == gradient->first) {
+				_gfxGradientColor(gradient, 0, &c1);
+				_gfxGradientQuad(&geometry, &rects[i], gradient->vertical, lo, lo + 1, c1, c1);
+				lo++;
+			}
+			if ((hi > lo) && (hi - 1 == gradient->last)) {
+				_gfxGradientColor(gradient, 2 * (gradient->last - gradient->first), &c2);
+				_gfxGradientQuad(&geometry, &rects[i], gradient->vertical, hi - 1, hi, c2, c2);
+				hi--;
+			}
+			if (hi > lo) {
+				_gfxGradientColor(gradient, 2 * (lo - gradient->first) - 1, &c1);
+				_gfxGradientColor(gradient, 2 * (hi - gradient->first) - 1, &c2);
+				_gfxGradientQuad(&geometry, &rects[i], gradient->vertical, lo, hi, c1, c2);
+			}
+		}
+
+		if (geometry.numIndices > 0) {
+			result |= _gfxGeometry(dst, NULL, geometry.vertices, geometry.numVertices, geometry.indices, geometry.numIndices);
+		}
+		return result;
+	}
+#endif
+
+	result |= _gfxFillGradientBands(dst, gradient, rects, n);
+
+	return result;
+}
+
+/*!
+\brief Internal function to draw a tessellated shape at an offset with a linear gradient.
+
+\param dst The target to draw on.
+\param shape The tessellated shape; its pixels and weights are ignored.
+\param x X offset.
+\param y Y offset.
+\param gradient The gradient.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _gfxDrawGradientShape(SDL2_gfxTarget *dst, const SDL2_gfxShape *shape, Sint16 x, Sint16 y, const SDL2_gfxGradient *gradient)
+{
+	int i;
+	SDL_Rect *rect;
+
+	if (shape->numRects == 0) {
+		return 0;
+	}
+
+	rect = (SDL_Rect *)_gfxScratch(&dst->context->spans, sizeof(SDL_Rect) * shape->numRects);
+	if (rect == NULL) {
+		return -1;
+	}
+	for (i = 0; i < shape->numRects; i++) {
+		rect[i].x = shape->rects[i].x + x;
+		rect[i].y = shape->rects[i].y + y;
+		rect[i].w = shape->rects[i].w;
+		rect[i].h = shape->rects[i].h;
+	}
+
+	return _gfxDrawGradientRects(dst, gradient, rect, shape->numRects);
+}
+
+/*!
+\brief Internal function to draw a box (filled rectangle) with a linear gradient.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the first color.
+\param g1 The green value of the first color.
+\param b1 The blue value of the first color.
+\param a1 The alpha value of the first color.
+\param r2 The red value of the second color.
+\param g2 The green value of the second color.
+\param b2 The blue value of the second color.
+\param a2 The alpha value of the second color.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _boxGradientRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	Sint16 tmp;
+	SDL_Rect rect;
+	SDL2_gfxGradient gradient;
+
+	/*
+	* Swap x1, x2 if required
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	if (direction == GFX_GRADIENT_VERTICAL) {
+		tmp = _gfxSetGradient(&gradient, direction, y1, y2, r1, g1, b1, a1, r2, g2, b2, a2);
+	} else {
+		tmp = _gfxSetGradient(&gradient, direction, x1, x2, r1, g1, b1, a1, r2, g2, b2, a2);
+	}
+	if (tmp) {
+		return (-1);
+	}
+
+	rect.x = x1;
+	rect.y = y1;
+	rect.w = x2 - x1 + 1;
+	rect.h = y2 - y1 + 1;
+
+	return (_gfxDrawGradientRects(dst, &gradient, &rect, 1));
+}
+
+/*!
+\brief Draw box (filled rectangle) with a linear gradient between two colors.
+
+With SDL 2.0.18 or newer the box is one SDL_RenderGeometry call with a color per vertex.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxGradientColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint32 color1, Uint32 color2)
+{
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return boxGradientRGBA(renderer, x1, y1, x2, y2, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
+}
+
+/*!
+\brief Draw box (filled rectangle) with a linear gradient between two colors.
+
+With SDL 2.0.18 or newer the box is one SDL_RenderGeometry call with a color per vertex.
+
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxGradientRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxGradientRGBA(&dst, x1, y1, x2, y2, direction, r1, g1, b1, a1, r2, g2, b2, a2));
+}
+
+/*!
+\brief Internal function to draw rounded-corner box (filled rectangle) with a linear gradient.
+
+The box covers the same pixels as roundedBoxRGBA.
+
+\param dst The target to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the first color.
+\param g1 The green value of the first color.
+\param b1 The blue value of the first color.
+\param a1 The alpha value of the first color.
+\param r2 The red value of the second color.
+\param g2 The green value of the second color.
+\param b2 The blue value of the second color.
+\param a2 The alpha value of the second color.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _roundedBoxGradientRGBA(SDL2_gfxTarget *dst, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	Sint16 w, h, tmp;
+	SDL2_gfxShape key, tessellated;
+	const SDL2_gfxShape *shape;
+	SDL2_gfxGradient gradient;
+
+	/*
+	* Check radius vor valid range
+	*/
+	if (rad < 0) {
+		return -1;
+	}
+
+	/*
+	* Special case - no rounding
+	*/
+	if (rad <= 1) {
+		return _boxGradientRGBA(dst, x1, y1, x2, y2, direction, r1, g1, b1, a1, r2, g2, b2, a2);
+	}
+
+	/*
+	* Swap x1, x2 if required
+	*/
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+
+	/*
+	* Swap y1, y2 if required
+	*/
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	if (direction == GFX_GRADIENT_VERTICAL) {
+		tmp = _gfxSetGradient(&gradient, direction, y1, y2, r1, g1, b1, a1, r2, g2, b2, a2);
+	} else {
+		tmp = _gfxSetGradient(&gradient, direction, x1, x2, r1, g1, b1, a1, r2, g2, b2, a2);
+	}
+	if (tmp) {
+		return (-1);
+	}
 
-	/* so now we have what octants to draw and when to draw them. all that's left is the actual raster code. */
+	/*
+	* Straight lines are plain boxes
+	*/
+	if ((x1 == x2) || (y1 == y2)) {
+		return _boxGradientRGBA(dst, x1, y1, x2, y2, direction, r1, g1, b1, a1, r2, g2, b2, a2);
+	}
 
 	/*
-	* Set color 
+	* Skip rectangles outside of the visible area
 	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	if (_gfxCull(dst, x1, y1, x2, y2)) {
+		return (0);
+	}
 
 	/*
-	* Draw arc 
+	* Calculate width&height and maybe adjust radius
 	*/
-	do {
-		ypcy = y + cy;
-		ymcy = y - cy;
-		if (cx > 0) {
-			xpcx = x + cx;
-			xmcx = x - cx;
+	w = x2 - x1 + 1;
+	h = y2 - y1 + 1;
+	rad = _gfxRoundedBoxRadius(w, h, rad);
 
-			/* always check if we're drawing a certain octant before adding a pixel to that octant. */
-			if (drawoct & 4)  result |= pixel(renderer, xmcx, ypcy);
-			if (drawoct & 2)  result |= pixel(renderer, xpcx, ypcy);
-			if (drawoct & 32) result |= pixel(renderer, xmcx, ymcy);
-			if (drawoct & 64) result |= pixel(renderer, xpcx, ymcy);
-		} else {
-			if (drawoct & 96) result |= pixel(renderer, x, ymcy);
-			if (drawoct & 6)  result |= pixel(renderer, x, ypcy);
-		}
+	/*
+	* Use the corners and inside of the rounded box
+	*/
+	key.type = SDL2_GFX_SHAPE_ROUNDED_BOX;
+	key.rx = w;
+	key.ry = h;
+	key.start = rad;
+	key.end = 0;
+	key.filled = 1;
+	shape = _gfxGetShape(dst, &key, _gfxTessellateRoundedBox, &tessellated);
+	if (shape == NULL) {
+		return (-1);
+	}
 
-		xpcy = x + cy;
-		xmcy = x - cy;
-		if (cx > 0 && cx != cy) {
-			ypcx = y + cx;
-			ymcx = y - cx;
-			if (drawoct & 8)   result |= pixel(renderer, xmcy, ypcx);
-			if (drawoct & 1)   result |= pixel(renderer, xpcy, ypcx);
-			if (drawoct & 16)  result |= pixel(renderer, xmcy, ymcx);
-			if (drawoct & 128) result |= pixel(renderer, xpcy, ymcx);
-		} else if (cx == 0) {
-			if (drawoct & 24)  result |= pixel(renderer, xmcy, y);
-			if (drawoct & 129) result |= pixel(renderer, xpcy, y);
-		}
+	return (_gfxDrawGradientShape(dst, shape, x1, y1, &gradient));
+}
 
-		/*
-		* Update whether we're drawing an octant
-		*/
-		if (stopval_start == cx) {
-			/* works like an on-off switch. */  
-			/* This is just in case start & end are in the same octant. */
-			if (drawoct & (1 << startoct)) drawoct &= 255 - (1 << startoct);		
-			else						   drawoct |= (1 << startoct);
-		}
-		if (stopval_end == cx) {
-			if (drawoct & (1 << endoct)) drawoct &= 255 - (1 << endoct);
-			else						 drawoct |= (1 << endoct);
-		}
+/*!
+\brief Draw rounded-corner box (filled rectangle) with a linear gradient between two colors.
 
-		/*
-		* Update pixels
-		*/
-		if (df < 0) {
-			df += d_e;
-			d_e += 2;
-			d_se += 2;
-		} else {
-			df += d_se;
-			d_e += 2;
-			d_se += 4;
-			cy--;
-		}
-		cx++;
-	} while (cx <= cy);
+With SDL 2.0.18 or newer the box is one SDL_RenderGeometry call with a color per vertex.
 
-	return (result);
-}
+\param renderer The renderer to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
 
-/* ----- AA Circle */
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxGradientColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+	gfxGradientDirection direction, Uint32 color1, Uint32 color2)
+{
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return roundedBoxGradientRGBA(renderer, x1, y1, x2, y2, rad, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
+}
 
 /*!
-\brief Draw anti-aliased circle with blending.
+\brief Draw rounded-corner box (filled rectangle) with a linear gradient between two colors.
+
+With SDL 2.0.18 or newer the box is one SDL_RenderGeometry call with a color per vertex.
 
 \param renderer The renderer to draw on.
-\param x X coordinate of the center of the aa-circle.
-\param y Y coordinate of the center of the aa-circle.
-\param rad Radius in pixels of the aa-circle.
-\param color The color value of the aa-circle to draw (0xRRGGBBAA). 
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aacircleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+int roundedBoxGradientRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+	gfxGradientDirection direction, Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return aaellipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedBoxGradientRGBA(&dst, x1, y1, x2, y2, rad, direction, r1, g1, b1, a1, r2, g2, b2, a2));
 }
 
+#ifdef SDL2_GFX_HAVE_GEOMETRY
 /*!
-\brief Draw anti-aliased circle with blending.
+\brief Internal function to get the color of a pixel of a radial gradient.
+
+\param inner The color of the center (r, g, b, a).
+\param outer The color of the edge (r, g, b, a).
+\param dx X offset of the pixel from the center.
+\param dy Y offset of the pixel from the center.
+\param steps Number of half pixels from the center to the edge.
+\param color Returns the color of the pixel.
+*/
+static void _gfxRadialColor(const Uint8 *inner, const Uint8 *outer, int dx, int dy, int steps, SDL_Color *color)
+{
+	_gfxLerpColor(inner, outer, (int)(2.0 * sqrt((double)dx * dx + (double)dy * dy) + 0.5), steps, color);
+}
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the aa-circle.
-\param y Y coordinate of the center of the aa-circle.
-\param rad Radius in pixels of the aa-circle.
-\param r The red value of the aa-circle to draw. 
-\param g The green value of the aa-circle to draw. 
-\param b The blue value of the aa-circle to draw. 
-\param a The alpha value of the aa-circle to draw.
+/*!
+\brief Internal function to add one half of a row of a radial gradient as a strip of quads.
+
+The strip runs from the center of the middle pixel of the row to the outer edge of its
+last pixel. Its vertices sit on pixel centers, close enough that the distance to the
+center of the circle is linear between them to an eighth of a pixel, so every pixel
+center gets its color; only the outer half of the last pixel is of a single color.
+
+\param geometry The geometry to add to.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param dy Y offset of the row from the center.
+\param hw Half width of the row; it covers the pixels x - hw to x + hw.
+\param dir Direction of the strip: 1 for the right half, -1 for the left half.
+\param inner The color of the center (r, g, b, a).
+\param outer The color of the edge (r, g, b, a).
+\param steps Number of half pixels from the center to the edge.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aacircleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+static int _gfxRadialStrip(SDL2_gfxGeometry *geometry, Sint16 x, Sint16 y, int dy, int hw, int dir,
+	const Uint8 *inner, const Uint8 *outer, int steps)
 {
-	/*
-	* Draw 
-	*/
-	return aaellipseRGBA(renderer, x, y, rad, rad, r, g, b, a);
-}
+	int dx, len, v;
+	double d;
+	float px;
+	SDL_Color color;
 
-/* ----- Ellipse */
+	if (_gfxReserveGeometry(geometry, 2 * hw + 4, 6 * hw + 6)) {
+		return -1;
+	}
+
+	_gfxRadialColor(inner, outer, 0, dy, steps, &color);
+	v = _gfxGeometryVertex(geometry, (float)x + 0.5f, (float)(y + dy), 0.0f, 0.0f, color);
+	_gfxGeometryVertex(geometry, (float)x + 0.5f, (float)(y + dy + 1), 0.0f, 0.0f, color);
+	for (dx = 0; dx <= hw; dx += len) {
+		if (dx == hw) {
+			/* Outer half of the last pixel */
+			px = (float)x + 0.5f + (float)dir * ((float)hw + 0.5f);
+			len = 1;
+		} else {
+			/* The distance bends by dy^2 / d^3, so chords of d^1.5 / dy stay within an eighth of a pixel */
+			d = sqrt((double)dx * dx + (double)dy * dy);
+			len = (dy == 0) ? hw - dx : (int)(d * sqrt(d) / abs(dy));
+			len = SDL_max(1, SDL_min(len, hw - dx));
+			_gfxRadialColor(inner, outer, dx + len, dy, steps, &color);
+			px = (float)x + 0.5f + (float)(dir * (dx + len));
+		}
+		_gfxGeometryVertex(geometry, px, (float)(y + dy), 0.0f, 0.0f, color);
+		_gfxGeometryVertex(geometry, px, (float)(y + dy + 1), 0.0f, 0.0f, color);
+		_gfxGeometryTriangle(geometry, v, v + 2, v + 3);
+		_gfxGeometryTriangle(geometry, v, v + 3, v + 1);
+		v += 2;
+	}
+
+	return 0;
+}
+#endif
 
 /*!
-\brief Internal function to draw pixels or lines in 4 quadrants.
+\brief Internal function to draw filled circle with a radial gradient.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the quadrant.
-\param y Y coordinate of the center of the quadrant.
-\param dx X offset in pixels of the corners of the quadrant.
-\param dy Y offset in pixels of the corners of the quadrant.
-\param f Flag indicating if the quadrant should be filled (1) or not (0).
+The circle covers the same pixels as filledCircleRGBA, and the color changes linearly
+from the center pixel to a distance of rad + 0.5. With SDL 2.0.18 or newer every row is
+split at its middle pixel into two strips of quads, and all of them are drawn with one
+SDL_RenderGeometry call. Otherwise the circle is filled in rings of one color, each with
+one color change and one call.
+
+\param dst The target to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r1 The red value of the center.
+\param g1 The green value of the center.
+\param b1 The blue value of the center.
+\param a1 The alpha value of the center.
+\param r2 The red value of the edge.
+\param g2 The green value of the edge.
+\param b2 The blue value of the edge.
+\param a2 The alpha value of the edge.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int _drawQuadrants(SDL_Renderer * renderer,  Sint16 x, Sint16 y, Sint16 dx, Sint16 dy, Sint32 f)
+static int _filledCircleRadialGradientRGBA(SDL2_gfxTarget *dst, Sint16 x, Sint16 y, Sint16 rad,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
 	int result = 0;
-	Sint16 xpdx, xmdx;
-	Sint16 ypdy, ymdy;
+	int i, dx, dy, hw, rows, start, steps, first, last;
+	int *cursor, *half;
+	Sint64 limit;
+	Uint8 inner[4], outer[4];
+	SDL_Color color, next;
+	SDL2_gfxShape key, tessellated;
+	const SDL2_gfxShape *shape;
+	SDL2_gfxSpans spans;
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	SDL2_gfxGeometry geometry;
+#endif
 
-	if (dx == 0) {
-		if (dy == 0) {
-			result |= pixel(renderer, x, y);
-		} else {
-			ypdy = y + dy;
-			ymdy = y - dy;
-			if (f) {
-				result |= vline(renderer, x, ymdy, ypdy);
+	/*
+	* Sanity check radius
+	*/
+	if (rad < 0) {
+		return (-1);
+	}
+
+	/*
+	* Special case for rad=0 - draw a point
+	*/
+	if (rad == 0) {
+		return (_pixelRGBA(dst, x, y, r1, g1, b1, a1));
+	}
+
+	/*
+	* Skip circles outside of the visible area
+	*/
+	if (_gfxCull(dst, x - rad, y - rad, x + rad, y + rad)) {
+		return (0);
+	}
+
+	/*
+	* Half widths of the rows of the filled circle. Every column of it reaches from
+	* its top row to the mirrored bottom row, so a row is as wide as the widest
+	* column starting above or on it.
+	*/
+	key.type = SDL2_GFX_SHAPE_ELLIPSE;
+	key.rx = rad;
+	key.ry = rad;
+	key.start = 0;
+	key.end = 0;
+	key.filled = 1;
+	shape = _gfxGetShape(dst, &key, _gfxTessellateEllipse, &tessellated);
+	if (shape == NULL) {
+		return (-1);
+	}
+	rows = 2 * rad + 1;
+	cursor = (int *)_gfxScratch(&dst->context->runs, 2 * sizeof(int) * rows);
+	if (cursor == NULL) {
+		return (-1);
+	}
+	half = cursor + rows;
+	for (i = 0; i <= rad; i++) {
+		half[i] = -1;
+	}
+	for (i = 0; i < shape->numRects; i++) {
+		if (shape->rects[i].y <= 0) {
+			hw = SDL_max(-shape->rects[i].x, shape->rects[i].x + shape->rects[i].w - 1);
+			half[rad + shape->rects[i].y] = SDL_max(half[rad + shape->rects[i].y], hw);
+		}
+	}
+	for (i = 0; i < shape->numPoints; i++) {
+		if (shape->points[i].y <= 0) {
+			hw = abs(shape->points[i].x);
+			half[rad + shape->points[i].y] = SDL_max(half[rad + shape->points[i].y], hw);
+		}
+	}
+	for (i = 1; i <= rad; i++) {
+		half[i] = SDL_max(half[i], half[i - 1]);
+	}
+	for (i = 1; i <= rad; i++) {
+		half[rad + i] = half[rad - i];
+	}
+
+	inner[0] = r1;
+	inner[1] = g1;
+	inner[2] = b1;
+	inner[3] = a1;
+	outer[0] = r2;
+	outer[1] = g2;
+	outer[2] = b2;
+	outer[3] = a2;
+	steps = 2 * rad + 1;
+
+#ifdef SDL2_GFX_HAVE_GEOMETRY
+	if (!dst->surface) {
+		/* Flush first, so the batch does not change the blend mode set here */
+		if (dst->batch) {
+			result |= gfxFlushBatch(dst->batch);
+		}
+		result |= _gfxSetBlendMode(dst->renderer, dst->state, ((a1 != 255) || (a2 != 255)) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+		_gfxBeginGeometry(&geometry, dst);
+		for (i = 0; i < rows; i++) {
+			dy = i - rad;
+			if ((half[i] < 0) || (_gfxCull(dst, x - half[i], y + dy, x + half[i], y + dy))) {
+				continue;
+			}
+			if ((_gfxRadialStrip(&geometry, x, y, dy, half[i], 1, inner, outer, steps)) ||
+				(_gfxRadialStrip(&geometry, x, y, dy, half[i], -1, inner, outer, steps))) {
+				return -1;
+			}
+		}
+
+		if (geometry.numIndices > 0) {
+			result |= _gfxGeometry(dst, NULL, geometry.vertices, geometry.numVertices, geometry.indices, geometry.numIndices);
+		}
+		return result;
+	}
+#endif
+
+	/*
+	* Every row keeps the distance of its next pixel to fill; rows outside of the
+	* visible area are treated as filled
+	*/
+	for (i = 0; i < rows; i++) {
+		dy = i - rad;
+		cursor[i] = ((half[i] < 0) || (_gfxCull(dst, x - half[i], y + dy, x + half[i], y + dy))) ? half[i] + 1 : 0;
+	}
+
+	/*
+	* Fill the rings of pixels whose distance in half pixels gives the same color
+	*/
+	for (first = 0; first <= steps; first = last + 1) {
+		_gfxLerpColor(inner, outer, first, steps, &color);
+		for (last = first; last < steps; last++) {
+			_gfxLerpColor(inner, outer, last + 1, steps, &next);
+			if (!_gfxSameColor(&color, &next)) {
+				break;
+			}
+		}
+
+		/*
+		* Pixels at distance d with (int)(2 * d + 0.5) <= last, i.e. 16 * d * d < (2 * last + 1)^2;
+		* the last ring takes the rest of the rows
+		*/
+		limit = (Sint64)(2 * last + 1) * (2 * last + 1);
+		_gfxBeginSpans(&spans, dst);
+		for (i = 0; i < rows; i++) {
+			dy = i - rad;
+			start = cursor[i];
+			dx = start;
+			while ((dx <= half[i]) && ((last == steps) || (16 * ((Sint64)dx * dx + (Sint64)dy * dy) < limit))) {
+				dx++;
+			}
+			cursor[i] = dx;
+			if (dx == start) {
+				continue;
+			}
+			if (start == 0) {
+				result |= _gfxSpan(&spans, x - dx + 1, x + dx - 1, y + dy);
 			} else {
-				result |= pixel(renderer, x, ypdy);
-				result |= pixel(renderer, x, ymdy);
+				result |= _gfxSpan(&spans, x - dx + 1, x - start, y + dy);
+				result |= _gfxSpan(&spans, x + start, x + dx - 1, y + dy);
 			}
 		}
-	} else {	
-		xpdx = x + dx;
-		xmdx = x - dx;
-		ypdy = y + dy;
-		ymdy = y - dy;
-		if (f) {
-				result |= vline(renderer, xpdx, ymdy, ypdy);
-				result |= vline(renderer, xmdx, ymdy, ypdy);
-		} else {
-				result |= pixel(renderer, xpdx, ypdy);
-				result |= pixel(renderer, xmdx, ypdy);
-				result |= pixel(renderer, xpdx, ymdy);
-				result |= pixel(renderer, xmdx, ymdy);
+		if (spans.numRects > 0) {
+			result |= _gfxColor(dst, color.r, color.g, color.b, color.a);
+			result |= _gfxFillRects(dst, spans.rects, spans.numRects);
 		}
 	}
 
-	return result;
+	return (result);
 }
 
 /*!
-\brief Internal function to draw ellipse or filled ellipse with blending.
+\brief Draw filled circle with a radial gradient from the center to the edge.
+
+The circle covers the same pixels as filledCircleRGBA. With SDL 2.0.18 or newer it is
+one SDL_RenderGeometry call with a color per vertex.
 
 \param renderer The renderer to draw on.
-\param x X coordinate of the center of the ellipse.
-\param y Y coordinate of the center of the ellipse.
-\param rx Horizontal radius in pixels of the ellipse.
-\param ry Vertical radius in pixels of the ellipse.
-\param r The red value of the ellipse to draw. 
-\param g The green value of the ellipse to draw. 
-\param b The blue value of the ellipse to draw. 
-\param a The alpha value of the ellipse to draw.
-\param f Flag indicating if the ellipse should be filled (1) or not (0).
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param inner The color of the center (0xRRGGBBAA).
+\param outer The color of the edge (0xRRGGBBAA).
 
 \returns Returns 0 on success, -1 on failure.
 */
-#define ELLIPSE_OVERSCAN	4
-int _ellipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Sint32 f)
+int filledCircleRadialGradientColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 inner, Uint32 outer)
+{
+	Uint8 *c1 = (Uint8 *)&inner;
+	Uint8 *c2 = (Uint8 *)&outer;
+	return filledCircleRadialGradientRGBA(renderer, x, y, rad, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
+}
+
+/*!
+\brief Draw filled circle with a radial gradient from the center to the edge.
+
+The circle covers the same pixels as filledCircleRGBA. With SDL 2.0.18 or newer it is
+one SDL_RenderGeometry call with a color per vertex.
+
+\param renderer The renderer to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r1 The red value of the center.
+\param g1 The green value of the center.
+\param b1 The blue value of the center.
+\param a1 The alpha value of the center.
+\param r2 The red value of the edge.
+\param g2 The green value of the edge.
+\param b2 The blue value of the edge.
+\param a2 The alpha value of the edge.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledCircleRadialGradientRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCircleRadialGradientRGBA(&dst, x, y, rad, r1, g1, b1, a1, r2, g2, b2, a2));
+}
+
+/*!
+\brief Internal function to draw filled polygon with a linear gradient.
+
+The polygon covers the same pixels as filledPolygonRGBA; the gradient spans its bounding box.
+
+\param dst The target to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the first color.
+\param g1 The green value of the first color.
+\param b1 The blue value of the first color.
+\param a1 The alpha value of the first color.
+\param r2 The red value of the second color.
+\param g2 The green value of the second color.
+\param b2 The blue value of the second color.
+\param a2 The alpha value of the second color.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+static int _filledPolygonGradientRGBA(SDL2_gfxTarget *dst, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
 	int result;
-	Sint32 rx2, ry2, rx22, ry22; 
-    Sint32 error;
-    Sint32 curX, curY, curXp1, curYm1;
-	Sint32 scrX, scrY, oldX, oldY;
-    Sint32 deltaX, deltaY;
+	int i, first, last;
+	const Sint16 *v;
+	SDL2_gfxGradient gradient;
+	SDL2_gfxSpans spans;
 
 	/*
-	* Sanity check radii 
+	* Vertex array NULL check
 	*/
-	if ((rx < 0) || (ry < 0)) {
+	if ((vx == NULL) || (vy == NULL)) {
 		return (-1);
 	}
 
 	/*
-	* Set color
+	* Sanity check number of edges
 	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	if (n < 3) {
+		return (-1);
+	}
+
+	/*
+	* Gradient across the bounding box
+	*/
+	v = (direction == GFX_GRADIENT_VERTICAL) ? vy : vx;
+	first = last = v[0];
+	for (i = 1; i < n; i++) {
+		first = SDL_min(first, v[i]);
+		last = SDL_max(last, v[i]);
+	}
+	if (_gfxSetGradient(&gradient, direction, first, last, r1, g1, b1, a1, r2, g2, b2, a2)) {
+		return (-1);
+	}
 
 	/*
-	* Special cases for rx=0 and/or ry=0: draw a hline/vline/pixel 
+	* Skip polygons outside of the visible area
 	*/
-	if (rx == 0) {
-		if (ry == 0) {
-			return (pixel(renderer, x, y));
-		} else {
-			return (vline(renderer, x, y - ry, y + ry));
-		}
-	} else {
-		if (ry == 0) {
-			return (hline(renderer, x - rx, x + rx, y));
-		}
+	if (_gfxCullPoints(dst, vx, vy, n, 0)) {
+		return (0);
 	}
 
 	/*
-	 * Top/bottom center points.
-	 */
-	oldX = scrX = 0;
-	oldY = scrY = ry;
-	result |= _drawQuadrants(renderer, x, y, 0, ry, f);
-
-	/* Midpoint ellipse algorithm with overdraw */
-	rx *= ELLIPSE_OVERSCAN;
-	ry *= ELLIPSE_OVERSCAN;
-	rx2 = rx * rx;
-	rx22 = rx2 + rx2;
-    ry2 = ry * ry;
-	ry22 = ry2 + ry2;
-    curX = 0;
-    curY = ry;
-    deltaX = 0;
-    deltaY = rx22 * curY;
- 
-	/* Points in segment 1 */ 
-    error = ry2 - rx2 * ry + rx2 / 4;
-    while (deltaX <= deltaY)
-    {
-          curX++;
-          deltaX += ry22;
- 
-          error +=  deltaX + ry2; 
-          if (error >= 0)
-          {
-               curY--;
-               deltaY -= rx22; 
-               error -= deltaY;
-          }
-
-		  scrX = curX/ELLIPSE_OVERSCAN;
-		  scrY = curY/ELLIPSE_OVERSCAN;
-		  if ((scrX != oldX && scrY == oldY) || (scrX != oldX && scrY != oldY)) {
-			result |= _drawQuadrants(renderer, x, y, scrX, scrY, f);
-			oldX = scrX;
-			oldY = scrY;
-		  }
-    }
-
-	/* Points in segment 2 */
-	if (curY > 0) 
-	{
-		curXp1 = curX + 1;
-		curYm1 = curY - 1;
-		error = ry2 * curX * curXp1 + ((ry2 + 3) / 4) + rx2 * curYm1 * curYm1 - rx2 * ry2;
-		while (curY > 0)
-		{
-			curY--;
-			deltaY -= rx22;
-
-			error += rx2;
-			error -= deltaY;
- 
-			if (error <= 0) 
-			{
-               curX++;
-               deltaX += ry22;
-               error += deltaX;
-			}
-
-		    scrX = curX/ELLIPSE_OVERSCAN;
-		    scrY = curY/ELLIPSE_OVERSCAN;
-		    if ((scrX != oldX && scrY == oldY) || (scrX != oldX && scrY != oldY)) {
-				oldY--;
-				for (;oldY >= scrY; oldY--) {
-					result |= _drawQuadrants(renderer, x, y, scrX, oldY, f);
-					/* prevent overdraw */
-					if (f) {
-						oldY = scrY - 1;
-					}
-				}
-  				oldX = scrX;
-				oldY = scrY;
-		    }		
-		}
-
-		/* Remaining points in vertical */
-		if (!f) {
-			oldY--;
-			for (;oldY >= 0; oldY--) {
-				result |= _drawQuadrants(renderer, x, y, scrX, oldY, f);
-			}
-		}
+	* Collect the spans, then fill them all with the gradient
+	*/
+	_gfxBeginSpans(&spans, dst);
+	result = _gfxFillPolygonSpans(dst, vx, vy, n, NULL, NULL, _gfxFilledSpan, &spans);
+	if (spans.numRects > 0) {
+		result |= _gfxDrawGradientRects(dst, &gradient, spans.rects, spans.numRects);
 	}
 
 	return (result);
 }
 
 /*!
-\brief Draw ellipse with blending.
+\brief Draw filled polygon with a linear gradient between two colors.
+
+The gradient spans the bounding box of the polygon. With SDL 2.0.18 or newer the polygon
+is one SDL_RenderGeometry call with a color per vertex.
 
 \param renderer The renderer to draw on.
-\param x X coordinate of the center of the ellipse.
-\param y Y coordinate of the center of the ellipse.
-\param rx Horizontal radius in pixels of the ellipse.
-\param ry Vertical radius in pixels of the ellipse.
-\param color The color value of the ellipse to draw (0xRRGGBBAA). 
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
 
 \returns Returns 0 on success, -1 on failure.
 */
-int ellipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+int filledPolygonGradientColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint32 color1, Uint32 color2)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return _ellipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3], 0);
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return filledPolygonGradientRGBA(renderer, vx, vy, n, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
 }
 
 /*!
-\brief Draw ellipse with blending.
+\brief Draw filled polygon with a linear gradient between two colors.
+
+The gradient spans the bounding box of the polygon. With SDL 2.0.18 or newer the polygon
+is one SDL_RenderGeometry call with a color per vertex.
 
 \param renderer The renderer to draw on.
-\param x X coordinate of the center of the ellipse.
-\param y Y coordinate of the center of the ellipse.
-\param rx Horizontal radius in pixels of the ellipse.
-\param ry Vertical radius in pixels of the ellipse.
-\param r The red value of the ellipse to draw. 
-\param g The green value of the ellipse to draw. 
-\param b The blue value of the ellipse to draw. 
-\param a The alpha value of the ellipse to draw.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int ellipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int filledPolygonGradientRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
-	return _ellipseRGBA(renderer, x, y, rx, ry, r, g, b, a, 0);
+	SDL2_gfxTarget dst;
+	_gfxTarget(&dst, renderer);
+	return SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledPolygonGradientRGBA(&dst, vx, vy, n, direction, r1, g1, b1, a1, r2, g2, b2, a2));
 }
 
-/* ----- Filled Circle */
+/* ---- Surface drawing */
 
 /*!
-\brief Draw filled circle with blending.
+\brief Draw pixel with blending enabled if a<255 directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled circle.
-\param y Y coordinate of the center of the filled circle.
-\param rad Radius in pixels of the filled circle.
-\param color The color value of the filled circle to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param color The color value of the pixel to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledCircleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
+int pixelColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return filledEllipseRGBA(renderer, x, y, rad, rad, c[0], c[1], c[2], c[3]);
+	return pixelRGBA_Surface(surface, x, y, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw filled circle with blending.
+\brief Draw pixel with blending enabled if a<255 directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled circle.
-\param y Y coordinate of the center of the filled circle.
-\param rad Radius in pixels of the filled circle.
-\param r The red value of the filled circle to draw. 
-\param g The green value of the filled circle to draw. 
-\param b The blue value of the filled circle to draw. 
-\param a The alpha value of the filled circle to draw.
+\param surface The surface to draw on.
+\param x X (horizontal) coordinate of the pixel.
+\param y Y (vertical) coordinate of the pixel.
+\param r The red color value of the pixel to draw. 
+\param g The green color value of the pixel to draw.
+\param b The blue color value of the pixel to draw.
+\param a The alpha value of the pixel to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledCircleRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int pixelRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	return _ellipseRGBA(renderer, x, y, rad, rad, r, g ,b, a, 1);
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_PIXEL, _pixelRGBA(&dst, x, y, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
+/*!
+\brief Draw horizontal line with blending directly onto a surface.
 
-/* ----- AA Ellipse */
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
 
-/* Windows targets do not have lrint, so provide a local inline version */
-#if defined(_MSC_VER)
-/* Detect 64bit and use intrinsic version */
-#ifdef _M_X64
-#include <emmintrin.h>
-static __inline long 
-	lrint(float f) 
+\returns Returns 0 on success, -1 on failure.
+*/
+int hlineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 x2, Sint16 y, Uint32 color)
 {
-	return _mm_cvtss_si32(_mm_load_ss(&f));
-}
-#elif defined(_M_IX86)
-__inline long int
-	lrint (double flt)
-{	
-	int intgr;
-	_asm
-	{
-		fld flt
-			fistp intgr
-	};
-	return intgr;
+	Uint8 *c = (Uint8 *)&color; 
+	return hlineRGBA_Surface(surface, x1, x2, y, c[0], c[1], c[2], c[3]);
 }
-#elif defined(_M_ARM)
-#include <armintr.h>
-#pragma warning(push)
-#pragma warning(disable: 4716)
-__declspec(naked) long int
-	lrint (double flt)
+
+/*!
+\brief Draw horizontal line with blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. left) of the line.
+\param x2 X coordinate of the second point (i.e. right) of the line.
+\param y Y coordinate of the points of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int hlineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 x2, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	__emit(0xEC410B10); // fmdrr  d0, r0, r1
-	__emit(0xEEBD0B40); // ftosid s0, d0
-	__emit(0xEE100A10); // fmrs   r0, s0
-	__emit(0xE12FFF1E); // bx     lr
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _hlineRGBA(&dst, x1, x2, y, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
-#pragma warning(pop)
-#else
-#error lrint needed for MSVC on non X86/AMD64/ARM targets.
-#endif
-#endif
 
 /*!
-\brief Draw anti-aliased ellipse with blending.
+\brief Draw vertical line with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the aa-ellipse.
-\param y Y coordinate of the center of the aa-ellipse.
-\param rx Horizontal radius in pixels of the aa-ellipse.
-\param ry Vertical radius in pixels of the aa-ellipse.
-\param color The color value of the aa-ellipse to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aaellipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+int vlineColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y1, Sint16 y2, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return aaellipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3]);
+	return vlineRGBA_Surface(surface, x, y1, y2, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw anti-aliased ellipse with blending.
+\brief Draw vertical line with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the aa-ellipse.
-\param y Y coordinate of the center of the aa-ellipse.
-\param rx Horizontal radius in pixels of the aa-ellipse.
-\param ry Vertical radius in pixels of the aa-ellipse.
-\param r The red value of the aa-ellipse to draw. 
-\param g The green value of the aa-ellipse to draw. 
-\param b The blue value of the aa-ellipse to draw. 
-\param a The alpha value of the aa-ellipse to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the points of the line.
+\param y1 Y coordinate of the first point (i.e. top) of the line.
+\param y2 Y coordinate of the second point (i.e. bottom) of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw. 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aaellipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int vlineRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y1, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
 	int result;
-	int i;
-	int a2, b2, ds, dt, dxt, t, s, d;
-	Sint16 xp, yp, xs, ys, dyt, od, xx, yy, xc2, yc2;
-	float cp;
-	double sab;
-	Uint8 weight, iweight;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Sanity check radii 
-	*/
-	if ((rx < 0) || (ry < 0)) {
-		return (-1);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _vlineRGBA(&dst, x, y1, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Special cases for rx=0 and/or ry=0: draw a hline/vline/pixel 
-	*/
-	if (rx == 0) {
-		if (ry == 0) {
-			return (pixelRGBA(renderer, x, y, r, g, b, a));
-		} else {
-			return (vlineRGBA(renderer, x, y - ry, y + ry, r, g, b, a));
-		}
-	} else {
-		if (ry == 0) {
-			return (hlineRGBA(renderer, x - rx, x + rx, y, r, g, b, a));
-		}
+	return result;
+}
+
+/*!
+\brief Draw rectangle with blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int rectangleColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return rectangleRGBA_Surface(surface, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
+
+/*!
+\brief Draw rectangle with blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int rectangleRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _rectangleRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
+}
+
+/*!
+\brief Draw rounded-corner rectangle with blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param rad The radius of the corner arc.
+\param color The color value of the rectangle to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedRectangleColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return roundedRectangleRGBA_Surface(surface, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+}
 
-	/* Variable setup */
-	a2 = rx * rx;
-	b2 = ry * ry;
+/*!
+\brief Draw rounded-corner rectangle with blending directly onto a surface.
 
-	ds = 2 * a2;
-	dt = 2 * b2;
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the rectangle.
+\param y1 Y coordinate of the first point (i.e. top right) of the rectangle.
+\param x2 X coordinate of the second point (i.e. bottom left) of the rectangle.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the rectangle.
+\param rad The radius of the corner arc.
+\param r The red value of the rectangle to draw. 
+\param g The green value of the rectangle to draw. 
+\param b The blue value of the rectangle to draw. 
+\param a The alpha value of the rectangle to draw. 
 
-	xc2 = 2 * x;
-	yc2 = 2 * y;
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedRectangleRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	sab = sqrt((double)(a2 + b2));
-	od = (Sint16)lrint(sab*0.01) + 1; /* introduce some overdraw */
-	dxt = (Sint16)lrint((double)a2 / sab) + od;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedRectangleRGBA(&dst, x1, y1, x2, y2, rad, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	t = 0;
-	s = -2 * a2 * ry;
-	d = 0;
+	return result;
+}
 
-	xp = x;
-	yp = y - ry;
+/*!
+\brief Draw box (filled rectangle) with blending directly onto a surface.
 
-	/* Draw */
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param color The color value of the box to draw (0xRRGGBBAA). 
 
-	/* "End points" */
-	result |= pixelRGBA(renderer, xp, yp, r, g, b, a);
-	result |= pixelRGBA(renderer, xc2 - xp, yp, r, g, b, a);
-	result |= pixelRGBA(renderer, xp, yc2 - yp, r, g, b, a);
-	result |= pixelRGBA(renderer, xc2 - xp, yc2 - yp, r, g, b, a);
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return boxRGBA_Surface(surface, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
 
-	for (i = 1; i <= dxt; i++) {
-		xp--;
-		d += t - b2;
+/*!
+\brief Draw box (filled rectangle) with blending directly onto a surface.
 
-		if (d >= 0)
-			ys = yp - 1;
-		else if ((d - s - a2) > 0) {
-			if ((2 * d - s - a2) >= 0)
-				ys = yp + 1;
-			else {
-				ys = yp;
-				yp++;
-				d -= s + a2;
-				s += ds;
-			}
-		} else {
-			yp++;
-			ys = yp + 1;
-			d -= s + a2;
-			s += ds;
-		}
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw.
 
-		t -= dt;
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-		/* Calculate alpha */
-		if (s != 0) {
-			cp = (float) abs(d) / (float) abs(s);
-			if (cp > 1.0) {
-				cp = 1.0;
-			}
-		} else {
-			cp = 1.0;
-		}
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-		/* Calculate weights */
-		weight = (Uint8) (cp * 255);
-		iweight = 255 - weight;
+	return result;
+}
 
-		/* Upper half */
-		xx = xc2 - xp;
-		result |= pixelRGBAWeight(renderer, xp, yp, r, g, b, a, iweight);
-		result |= pixelRGBAWeight(renderer, xx, yp, r, g, b, a, iweight);
+/*!
+\brief Draw rounded-corner box (filled rectangle) with blending directly onto a surface.
 
-		result |= pixelRGBAWeight(renderer, xp, ys, r, g, b, a, weight);
-		result |= pixelRGBAWeight(renderer, xx, ys, r, g, b, a, weight);
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param color The color value of the box to draw (0xRRGGBBAA). 
 
-		/* Lower half */
-		yy = yc2 - yp;
-		result |= pixelRGBAWeight(renderer, xp, yy, r, g, b, a, iweight);
-		result |= pixelRGBAWeight(renderer, xx, yy, r, g, b, a, iweight);
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return roundedBoxRGBA_Surface(surface, x1, y1, x2, y2, rad, c[0], c[1], c[2], c[3]);
+}
 
-		yy = yc2 - ys;
-		result |= pixelRGBAWeight(renderer, xp, yy, r, g, b, a, weight);
-		result |= pixelRGBAWeight(renderer, xx, yy, r, g, b, a, weight);
-	}
+/*!
+\brief Draw rounded-corner box (filled rectangle) with blending directly onto a surface.
 
-	/* Replaces original approximation code dyt = abs(yp - yc); */
-	dyt = (Sint16)lrint((double)b2 / sab ) + od;    
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param r The red value of the box to draw. 
+\param g The green value of the box to draw. 
+\param b The blue value of the box to draw. 
+\param a The alpha value of the box to draw. 
 
-	for (i = 1; i <= dyt; i++) {
-		yp++;
-		d -= s + a2;
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2,
+	Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-		if (d <= 0)
-			xs = xp + 1;
-		else if ((d + t - b2) < 0) {
-			if ((2 * d + t - b2) <= 0)
-				xs = xp - 1;
-			else {
-				xs = xp;
-				xp--;
-				d += t - b2;
-				t -= dt;
-			}
-		} else {
-			xp--;
-			xs = xp - 1;
-			d += t - b2;
-			t -= dt;
-		}
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedBoxRGBA(&dst, x1, y1, x2, y2, rad, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-		s += ds;
+	return result;
+}
 
-		/* Calculate alpha */
-		if (t != 0) {
-			cp = (float) abs(d) / (float) abs(t);
-			if (cp > 1.0) {
-				cp = 1.0;
-			}
-		} else {
-			cp = 1.0;
-		}
+/*!
+\brief Draw line with alpha blending directly onto a surface.
 
-		/* Calculate weight */
-		weight = (Uint8) (cp * 255);
-		iweight = 255 - weight;
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the seond point of the line.
+\param color The color value of the line to draw (0xRRGGBBAA). 
 
-		/* Left half */
-		xx = xc2 - xp;
-		yy = yc2 - yp;
-		result |= pixelRGBAWeight(renderer, xp, yp, r, g, b, a, iweight);
-		result |= pixelRGBAWeight(renderer, xx, yp, r, g, b, a, iweight);
+\returns Returns 0 on success, -1 on failure.
+*/
+int lineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return lineRGBA_Surface(surface, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
+}
 
-		result |= pixelRGBAWeight(renderer, xp, yy, r, g, b, a, iweight);
-		result |= pixelRGBAWeight(renderer, xx, yy, r, g, b, a, iweight);
+/*!
+\brief Draw line with alpha blending directly onto a surface.
 
-		/* Right half */
-		xx = xc2 - xs;
-		result |= pixelRGBAWeight(renderer, xs, yp, r, g, b, a, weight);
-		result |= pixelRGBAWeight(renderer, xx, yp, r, g, b, a, weight);
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int lineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-		result |= pixelRGBAWeight(renderer, xs, yy, r, g, b, a, weight);
-		result |= pixelRGBAWeight(renderer, xx, yy, r, g, b, a, weight);		
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _lineRGBA(&dst, x1, y1, x2, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	return (result);
+	return result;
 }
 
-/* ---- Filled Ellipse */
-
 /*!
-\brief Draw filled ellipse with blending.
+\brief Draw anti-aliased line with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled ellipse.
-\param y Y coordinate of the center of the filled ellipse.
-\param rx Horizontal radius in pixels of the filled ellipse.
-\param ry Vertical radius in pixels of the filled ellipse.
-\param color The color value of the filled ellipse to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the aa-line.
+\param y1 Y coordinate of the first point of the aa-line.
+\param x2 X coordinate of the second point of the aa-line.
+\param y2 Y coordinate of the second point of the aa-line.
+\param color The color value of the aa-line to draw (0xRRGGBBAA).
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledEllipseColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
+int aalineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return _ellipseRGBA(renderer, x, y, rx, ry, c[0], c[1], c[2], c[3], 1);
+	return aalineRGBA_Surface(surface, x1, y1, x2, y2, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw filled ellipse with blending.
+\brief Draw anti-aliased line with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled ellipse.
-\param y Y coordinate of the center of the filled ellipse.
-\param rx Horizontal radius in pixels of the filled ellipse.
-\param ry Vertical radius in pixels of the filled ellipse.
-\param r The red value of the filled ellipse to draw. 
-\param g The green value of the filled ellipse to draw. 
-\param b The blue value of the filled ellipse to draw. 
-\param a The alpha value of the filled ellipse to draw.
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the aa-line.
+\param y1 Y coordinate of the first point of the aa-line.
+\param x2 X coordinate of the second point of the aa-line.
+\param y2 Y coordinate of the second point of the aa-line.
+\param r The red value of the aa-line to draw. 
+\param g The green value of the aa-line to draw. 
+\param b The blue value of the aa-line to draw. 
+\param a The alpha value of the aa-line to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledEllipseRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int aalineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	return _ellipseRGBA(renderer, x, y, rx, ry, r, g, b, a, 1);
-}
+	int result;
+	SDL2_gfxTarget dst;
 
-/* ----- Pie */
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_AALINE, _aalineRGBA(&dst, x1, y1, x2, y2, r, g, b, a, 1));
+	_gfxSurfaceTargetDone(&dst);
 
-/*!
-\brief Internal float (low-speed) pie-calc implementation by drawing polygons.
+	return result;
+}
 
-Note: Determines vertex array and uses polygon or filledPolygon drawing routines to render.
+/*!
+\brief Draw a thick line with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the pie.
-\param y Y coordinate of the center of the pie.
-\param rad Radius in pixels of the pie.
-\param start Starting radius in degrees of the pie.
-\param end Ending radius in degrees of the pie.
-\param r The red value of the pie to draw. 
-\param g The green value of the pie to draw. 
-\param b The blue value of the pie to draw. 
-\param a The alpha value of the pie to draw.
-\param filled Flag indicating if the pie should be filled (=1) or not (=0).
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param width Width of the line in pixels. Must be >0.
+\param color The color value of the line to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-/* TODO: rewrite algorithm; pie is not always accurate */
-int _pieRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end,  Uint8 r, Uint8 g, Uint8 b, Uint8 a, Uint8 filled)
+int thickLineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint32 color)
 {
-	int result;
-	double angle, start_angle, end_angle;
-	double deltaAngle;
-	double dr;
-	int numpoints, i;
-	Sint16 *vx, *vy;
+	Uint8 *c = (Uint8 *)&color; 
+	return thickLineRGBA_Surface(surface, x1, y1, x2, y2, width, c[0], c[1], c[2], c[3]);
+}
 
-	/*
-	* Sanity check radii 
-	*/
-	if (rad < 0) {
-		return (-1);
-	}
+/*!
+\brief Draw a thick line with alpha blending directly onto a surface.
 
-	/*
-	* Fixup angles
-	*/
-	start = start % 360;
-	end = end % 360;
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the line.
+\param y1 Y coordinate of the first point of the line.
+\param x2 X coordinate of the second point of the line.
+\param y2 Y coordinate of the second point of the line.
+\param width Width of the line in pixels. Must be >0.
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
 
-	/*
-	* Special case for rad=0 - draw a point 
-	*/
-	if (rad == 0) {
-		return (pixelRGBA(renderer, x, y, r, g, b, a));
-	}
+\returns Returns 0 on success, -1 on failure.
+*/	
+int thickLineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Variable setup 
-	*/
-	dr = (double) rad;
-	deltaAngle = 3.0 / dr;
-	start_angle = (double) start *(2.0 * M_PI / 360.0);
-	end_angle = (double) end *(2.0 * M_PI / 360.0);
-	if (start > end) {
-		end_angle += (2.0 * M_PI);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _thickLineRGBA(&dst, x1, y1, x2, y2, width, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/* We will always have at least 2 points */
-	numpoints = 2;
+	return result;
+}
 
-	/* Count points (rather than calculating it) */
-	angle = start_angle;
-	while (angle < end_angle) {
-		angle += deltaAngle;
-		numpoints++;
-	}
+/*!
+\brief Draw a thick polyline with joins and caps with alpha blending directly onto a surface.
 
-	/* Allocate combined vertex array */
-	vx = vy = (Sint16 *) malloc(2 * sizeof(Uint16) * numpoints);
-	if (vx == NULL) {
-		return (-1);
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the polyline.
+\param vy Vertex array containing Y coordinates of the points of the polyline.
+\param n Number of points in the vertex array.
+\param width Width of the line in pixels. Must be >0.
+\param join The shape of the corners between segments.
+\param cap The shape of the line ends.
+\param color The color value of the line to draw (0xRRGGBBAA). 
 
-	/* Update point to start of vy */
-	vy += numpoints;
+\returns Returns 0 on success, -1 on failure.
+*/
+int thickPolylineColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return thickPolylineRGBA_Surface(surface, vx, vy, n, width, join, cap, c[0], c[1], c[2], c[3]);
+}
 
-	/* Center */
-	vx[0] = x;
-	vy[0] = y;
+/*!
+\brief Draw a thick polyline with joins and caps with alpha blending directly onto a surface.
 
-	/* First vertex */
-	angle = start_angle;
-	vx[1] = x + (int) (dr * cos(angle));
-	vy[1] = y + (int) (dr * sin(angle));
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the polyline.
+\param vy Vertex array containing Y coordinates of the points of the polyline.
+\param n Number of points in the vertex array.
+\param width Width of the line in pixels. Must be >0.
+\param join The shape of the corners between segments.
+\param cap The shape of the line ends.
+\param r The red value of the line to draw. 
+\param g The green value of the line to draw. 
+\param b The blue value of the line to draw. 
+\param a The alpha value of the line to draw.
 
-	if (numpoints<3)
-	{
-		result = lineRGBA(renderer, vx[0], vy[0], vx[1], vy[1], r, g, b, a);
-	}
-	else
-	{
-		/* Calculate other vertices */
-		i = 2;
-		angle = start_angle;
-		while (angle < end_angle) {
-			angle += deltaAngle;
-			if (angle>end_angle)
-			{
-				angle = end_angle;
-			}
-			vx[i] = x + (int) (dr * cos(angle));
-			vy[i] = y + (int) (dr * sin(angle));
-			i++;
-		}
+\returns Returns 0 on success, -1 on failure.
+*/
+int thickPolylineRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-		/* Draw */
-		if (filled) {
-			result = filledPolygonRGBA(renderer, vx, vy, numpoints, r, g, b, a);
-		} else {
-			result = polygonRGBA(renderer, vx, vy, numpoints, r, g, b, a);
-		}
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_LINE, _thickPolylineRGBA(&dst, vx, vy, n, width, join, cap, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/* Free combined vertex array */
-	free(vx);
-
-	return (result);
+	return result;
 }
 
 /*!
-\brief Draw pie (outline) with alpha blending.
+\brief Draw circle with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the pie.
-\param y Y coordinate of the center of the pie.
-\param rad Radius in pixels of the pie.
-\param start Starting radius in degrees of the pie.
-\param end Ending radius in degrees of the pie.
-\param color The color value of the pie to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param rad Radius in pixels of the circle.
+\param color The color value of the circle to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int pieColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, 
-	Sint16 start, Sint16 end, Uint32 color) 
+int circleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return _pieRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3], 0);
+	return ellipseRGBA_Surface(surface, x, y, rad, rad, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw pie (outline) with alpha blending.
+\brief Draw circle with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the pie.
-\param y Y coordinate of the center of the pie.
-\param rad Radius in pixels of the pie.
-\param start Starting radius in degrees of the pie.
-\param end Ending radius in degrees of the pie.
-\param r The red value of the pie to draw. 
-\param g The green value of the pie to draw. 
-\param b The blue value of the pie to draw. 
-\param a The alpha value of the pie to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the circle.
+\param y Y coordinate of the center of the circle.
+\param rad Radius in pixels of the circle.
+\param r The red value of the circle to draw. 
+\param g The green value of the circle to draw. 
+\param b The blue value of the circle to draw. 
+\param a The alpha value of the circle to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int pieRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
-	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int circleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	return _pieRGBA(renderer, x, y, rad, start, end, r, g, b, a, 0);
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _circleRGBA(&dst, x, y, rad, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
 /*!
-\brief Draw filled pie with alpha blending.
+\brief Arc with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled pie.
-\param y Y coordinate of the center of the filled pie.
-\param rad Radius in pixels of the filled pie.
-\param start Starting radius in degrees of the filled pie.
-\param end Ending radius in degrees of the filled pie.
-\param color The color value of the filled pie to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param color The color value of the arc to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledPieColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
+int arcColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return _pieRGBA(renderer, x, y, rad, start, end, c[0], c[1], c[2], c[3], 1);
+	return arcRGBA_Surface(surface, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw filled pie with alpha blending.
+\brief Arc with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x X coordinate of the center of the filled pie.
-\param y Y coordinate of the center of the filled pie.
-\param rad Radius in pixels of the filled pie.
-\param start Starting radius in degrees of the filled pie.
-\param end Ending radius in degrees of the filled pie.
-\param r The red value of the filled pie to draw. 
-\param g The green value of the filled pie to draw. 
-\param b The blue value of the filled pie to draw. 
-\param a The alpha value of the filled pie to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the arc.
+\param y Y coordinate of the center of the arc.
+\param rad Radius in pixels of the arc.
+\param start Starting radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param end Ending radius in degrees of the arc. 0 degrees is down, increasing counterclockwise.
+\param r The red value of the arc to draw. 
+\param g The green value of the arc to draw. 
+\param b The blue value of the arc to draw. 
+\param a The alpha value of the arc to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledPieRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
-	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int arcRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	return _pieRGBA(renderer, x, y, rad, start, end, r, g, b, a, 1);
-}
+	int result;
+	SDL2_gfxTarget dst;
 
-/* ------ Trigon */
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _arcRGBA(&dst, x, y, rad, start, end, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-/*!
-\brief Draw trigon (triangle outline) with alpha blending.
+	return result;
+}
 
-Note: Creates vertex array and uses polygon routine to render.
+/*!
+\brief Draw anti-aliased circle with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the trigon.
-\param y1 Y coordinate of the first point of the trigon.
-\param x2 X coordinate of the second point of the trigon.
-\param y2 Y coordinate of the second point of the trigon.
-\param x3 X coordinate of the third point of the trigon.
-\param y3 Y coordinate of the third point of the trigon.
-\param color The color value of the trigon to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the aa-circle.
+\param y Y coordinate of the center of the aa-circle.
+\param rad Radius in pixels of the aa-circle.
+\param color The color value of the aa-circle to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int trigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+int aacircleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
 {
-	Sint16 vx[3]; 
-	Sint16 vy[3];
-
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
-
-	return(polygonColor(renderer,vx,vy,3,color));
+	Uint8 *c = (Uint8 *)&color; 
+	return aaellipseRGBA_Surface(surface, x, y, rad, rad, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw trigon (triangle outline) with alpha blending.
+\brief Draw anti-aliased circle with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the trigon.
-\param y1 Y coordinate of the first point of the trigon.
-\param x2 X coordinate of the second point of the trigon.
-\param y2 Y coordinate of the second point of the trigon.
-\param x3 X coordinate of the third point of the trigon.
-\param y3 Y coordinate of the third point of the trigon.
-\param r The red value of the trigon to draw. 
-\param g The green value of the trigon to draw. 
-\param b The blue value of the trigon to draw. 
-\param a The alpha value of the trigon to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the aa-circle.
+\param y Y coordinate of the center of the aa-circle.
+\param rad Radius in pixels of the aa-circle.
+\param r The red value of the aa-circle to draw. 
+\param g The green value of the aa-circle to draw. 
+\param b The blue value of the aa-circle to draw. 
+\param a The alpha value of the aa-circle to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int trigonRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
-	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
-{
-	Sint16 vx[3]; 
-	Sint16 vy[3];
-
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
+int aacircleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	return(polygonRGBA(renderer,vx,vy,3,r,g,b,a));
-}				 
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _aacircleRGBA(&dst, x, y, rad, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-/* ------ AA-Trigon */
+	return result;
+}
 
 /*!
-\brief Draw anti-aliased trigon (triangle outline) with alpha blending.
+\brief Draw filled circle with blending directly onto a surface.
 
-Note: Creates vertex array and uses aapolygon routine to render.
-
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the aa-trigon.
-\param y1 Y coordinate of the first point of the aa-trigon.
-\param x2 X coordinate of the second point of the aa-trigon.
-\param y2 Y coordinate of the second point of the aa-trigon.
-\param x3 X coordinate of the third point of the aa-trigon.
-\param y3 Y coordinate of the third point of the aa-trigon.
-\param color The color value of the aa-trigon to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param color The color value of the filled circle to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aatrigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+int filledCircleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color)
 {
-	Sint16 vx[3]; 
-	Sint16 vy[3];
-
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
-
-	return(aapolygonColor(renderer,vx,vy,3,color));
+	Uint8 *c = (Uint8 *)&color; 
+	return filledEllipseRGBA_Surface(surface, x, y, rad, rad, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw anti-aliased trigon (triangle outline) with alpha blending.
+\brief Draw filled circle with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the aa-trigon.
-\param y1 Y coordinate of the first point of the aa-trigon.
-\param x2 X coordinate of the second point of the aa-trigon.
-\param y2 Y coordinate of the second point of the aa-trigon.
-\param x3 X coordinate of the third point of the aa-trigon.
-\param y3 Y coordinate of the third point of the aa-trigon.
-\param r The red value of the aa-trigon to draw. 
-\param g The green value of the aa-trigon to draw. 
-\param b The blue value of the aa-trigon to draw. 
-\param a The alpha value of the aa-trigon to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r The red value of the filled circle to draw. 
+\param g The green value of the filled circle to draw. 
+\param b The blue value of the filled circle to draw. 
+\param a The alpha value of the filled circle to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aatrigonRGBA(SDL_Renderer * renderer,  Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
-	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int filledCircleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	Sint16 vx[3]; 
-	Sint16 vy[3];
-
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
+	int result;
+	SDL2_gfxTarget dst;
 
-	return(aapolygonRGBA(renderer,vx,vy,3,r,g,b,a));
-}				   
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCircleRGBA(&dst, x, y, rad, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-/* ------ Filled Trigon */
+	return result;
+}
 
 /*!
-\brief Draw filled trigon (triangle) with alpha blending.
+\brief Draw ellipse with blending directly onto a surface.
 
-Note: Creates vertex array and uses aapolygon routine to render.
-
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the filled trigon.
-\param y1 Y coordinate of the first point of the filled trigon.
-\param x2 X coordinate of the second point of the filled trigon.
-\param y2 Y coordinate of the second point of the filled trigon.
-\param x3 X coordinate of the third point of the filled trigon.
-\param y3 Y coordinate of the third point of the filled trigon.
-\param color The color value of the filled trigon to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the ellipse.
+\param y Y coordinate of the center of the ellipse.
+\param rx Horizontal radius in pixels of the ellipse.
+\param ry Vertical radius in pixels of the ellipse.
+\param color The color value of the ellipse to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledTrigonColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+int ellipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
 {
-	Sint16 vx[3]; 
-	Sint16 vy[3];
-
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
-
-	return(filledPolygonColor(renderer,vx,vy,3,color));
+	Uint8 *c = (Uint8 *)&color; 
+	return ellipseRGBA_Surface(surface, x, y, rx, ry, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw filled trigon (triangle) with alpha blending.
-
-Note: Creates vertex array and uses aapolygon routine to render.
+\brief Draw ellipse with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the filled trigon.
-\param y1 Y coordinate of the first point of the filled trigon.
-\param x2 X coordinate of the second point of the filled trigon.
-\param y2 Y coordinate of the second point of the filled trigon.
-\param x3 X coordinate of the third point of the filled trigon.
-\param y3 Y coordinate of the third point of the filled trigon.
-\param r The red value of the filled trigon to draw. 
-\param g The green value of the filled trigon to draw. 
-\param b The blue value of the filled trigon to draw. 
-\param a The alpha value of the filled trigon to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the ellipse.
+\param y Y coordinate of the center of the ellipse.
+\param rx Horizontal radius in pixels of the ellipse.
+\param ry Vertical radius in pixels of the ellipse.
+\param r The red value of the ellipse to draw. 
+\param g The green value of the ellipse to draw. 
+\param b The blue value of the ellipse to draw. 
+\param a The alpha value of the ellipse to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledTrigonRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
-	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int ellipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	Sint16 vx[3]; 
-	Sint16 vy[3];
+	int result;
+	SDL2_gfxTarget dst;
 
-	vx[0]=x1;
-	vx[1]=x2;
-	vx[2]=x3;
-	vy[0]=y1;
-	vy[1]=y2;
-	vy[2]=y3;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _ellipseRGBA(&dst, x, y, rx, ry, r, g, b, a, 0));
+	_gfxSurfaceTargetDone(&dst);
 
-	return(filledPolygonRGBA(renderer,vx,vy,3,r,g,b,a));
+	return result;
 }
 
-/* ---- Polygon */
-
 /*!
-\brief Draw polygon with alpha blending.
+\brief Draw anti-aliased ellipse with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the polygon.
-\param vy Vertex array containing Y coordinates of the points of the polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param color The color value of the polygon to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the aa-ellipse.
+\param y Y coordinate of the center of the aa-ellipse.
+\param rx Horizontal radius in pixels of the aa-ellipse.
+\param ry Vertical radius in pixels of the aa-ellipse.
+\param color The color value of the aa-ellipse to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int polygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+int aaellipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return polygonRGBA(renderer, vx, vy, n, c[0], c[1], c[2], c[3]);
+	return aaellipseRGBA_Surface(surface, x, y, rx, ry, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw polygon with the currently set color and blend mode.
+\brief Draw anti-aliased ellipse with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the polygon.
-\param vy Vertex array containing Y coordinates of the points of the polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the aa-ellipse.
+\param y Y coordinate of the center of the aa-ellipse.
+\param rx Horizontal radius in pixels of the aa-ellipse.
+\param ry Vertical radius in pixels of the aa-ellipse.
+\param r The red value of the aa-ellipse to draw. 
+\param g The green value of the aa-ellipse to draw. 
+\param b The blue value of the aa-ellipse to draw. 
+\param a The alpha value of the aa-ellipse to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int polygon(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n)
+int aaellipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	/*
-	* Draw 
-	*/
-	int result = 0;
-	int i, nn;
-	SDL_Point* points;
-
-	/*
-	* Vertex array NULL check 
-	*/
-	if (vx == NULL) {
-		return (-1);
-	}
-	if (vy == NULL) {
-		return (-1);
-	}
-
-	/*
-	* Sanity check 
-	*/
-	if (n < 3) {
-		return (-1);
-	}
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Create array of points
-	*/
-	nn = n + 1;
-	points = (SDL_Point*)malloc(sizeof(SDL_Point) * nn);
-	if (points == NULL)
-	{
+	if (_gfxSurfaceTarget(&dst, surface)) {
 		return -1;
 	}
-	for (i=0; i<n; i++)
-	{
-		points[i].x = vx[i];
-		points[i].y = vy[i];
-	}
-	points[n].x = vx[0];
-	points[n].y = vy[0];
-
-	/*
-	* Draw 
-	*/
-	result |= SDL_RenderDrawLines(renderer, points, nn);
-	free(points);
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _aaellipseRGBA(&dst, x, y, rx, ry, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	return (result);
+	return result;
 }
 
 /*!
-\brief Draw polygon with alpha blending.
+\brief Draw filled ellipse with blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the polygon.
-\param vy Vertex array containing Y coordinates of the points of the polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param r The red value of the polygon to draw. 
-\param g The green value of the polygon to draw. 
-\param b The blue value of the polygon to draw. 
-\param a The alpha value of the polygon to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled ellipse.
+\param y Y coordinate of the center of the filled ellipse.
+\param rx Horizontal radius in pixels of the filled ellipse.
+\param ry Vertical radius in pixels of the filled ellipse.
+\param color The color value of the filled ellipse to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int polygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int filledEllipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color)
 {
-	/*
-	* Draw 
-	*/
-	int result;
-	const Sint16 *x1, *y1, *x2, *y2;
-
-	/*
-	* Vertex array NULL check 
-	*/
-	if (vx == NULL) {
-		return (-1);
-	}
-	if (vy == NULL) {
-		return (-1);
-	}
+	Uint8 *c = (Uint8 *)&color; 
+	return filledEllipseRGBA_Surface(surface, x, y, rx, ry, c[0], c[1], c[2], c[3]);
+}
 
-	/*
-	* Sanity check 
-	*/
-	if (n < 3) {
-		return (-1);
-	}
+/*!
+\brief Draw filled ellipse with blending directly onto a surface.
 
-	/*
-	* Pointer setup 
-	*/
-	x1 = x2 = vx;
-	y1 = y2 = vy;
-	x2++;
-	y2++;
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled ellipse.
+\param y Y coordinate of the center of the filled ellipse.
+\param rx Horizontal radius in pixels of the filled ellipse.
+\param ry Vertical radius in pixels of the filled ellipse.
+\param r The red value of the filled ellipse to draw. 
+\param g The green value of the filled ellipse to draw. 
+\param b The blue value of the filled ellipse to draw. 
+\param a The alpha value of the filled ellipse to draw.
 
-	/*
-	* Set color 
-	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);	
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledEllipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Draw 
-	*/
-	result |= polygon(renderer, vx, vy, n);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_ELLIPSE, _ellipseRGBA(&dst, x, y, rx, ry, r, g, b, a, 1));
+	_gfxSurfaceTargetDone(&dst);
 
-	return (result);
+	return result;
 }
 
-/* ---- AA-Polygon */
-
 /*!
-\brief Draw anti-aliased polygon with alpha blending.
+\brief Draw pie (outline) with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the aa-polygon.
-\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param color The color value of the aa-polygon to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie.
+\param start Starting radius in degrees of the pie.
+\param end Ending radius in degrees of the pie.
+\param color The color value of the pie to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aapolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+int pieColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, 
+	Sint16 start, Sint16 end, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return aapolygonRGBA(renderer, vx, vy, n, c[0], c[1], c[2], c[3]);
+	return pieRGBA_Surface(surface, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw anti-aliased polygon with alpha blending.
+\brief Draw pie (outline) with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the aa-polygon.
-\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param r The red value of the aa-polygon to draw. 
-\param g The green value of the aa-polygon to draw. 
-\param b The blue value of the aa-polygon to draw. 
-\param a The alpha value of the aa-polygon to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the pie.
+\param y Y coordinate of the center of the pie.
+\param rad Radius in pixels of the pie.
+\param start Starting radius in degrees of the pie.
+\param end Ending radius in degrees of the pie.
+\param r The red value of the pie to draw. 
+\param g The green value of the pie to draw. 
+\param b The blue value of the pie to draw. 
+\param a The alpha value of the pie to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int aapolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int pieRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
 	int result;
-	int i;
-	const Sint16 *x1, *y1, *x2, *y2;
-
-	/*
-	* Vertex array NULL check 
-	*/
-	if (vx == NULL) {
-		return (-1);
-	}
-	if (vy == NULL) {
-		return (-1);
-	}
+	SDL2_gfxTarget dst;
 
-	/*
-	* Sanity check 
-	*/
-	if (n < 3) {
-		return (-1);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _pieRGBA(&dst, x, y, rad, start, end, r, g, b, a, 0));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Pointer setup 
-	*/
-	x1 = x2 = vx;
-	y1 = y2 = vy;
-	x2++;
-	y2++;
+	return result;
+}
 
-	/*
-	* Draw 
-	*/
-	result = 0;
-	for (i = 1; i < n; i++) {
-		result |= _aalineRGBA(renderer, *x1, *y1, *x2, *y2, r, g, b, a, 0);
-		x1 = x2;
-		y1 = y2;
-		x2++;
-		y2++;
-	}
+/*!
+\brief Draw filled pie with alpha blending directly onto a surface.
 
-	result |= _aalineRGBA(renderer, *x1, *y1, *vx, *vy, r, g, b, a, 0);
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled pie.
+\param y Y coordinate of the center of the filled pie.
+\param rad Radius in pixels of the filled pie.
+\param start Starting radius in degrees of the filled pie.
+\param end Ending radius in degrees of the filled pie.
+\param color The color value of the filled pie to draw (0xRRGGBBAA). 
 
-	return (result);
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPieColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return filledPieRGBA_Surface(surface, x, y, rad, start, end, c[0], c[1], c[2], c[3]);
 }
 
-/* ---- Filled Polygon */
-
 /*!
-\brief Internal helper qsort callback functions used in filled polygon drawing.
+\brief Draw filled pie with alpha blending directly onto a surface.
 
-\param a The surface to draw on.
-\param b Vertex array containing X coordinates of the points of the polygon.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled pie.
+\param y Y coordinate of the center of the filled pie.
+\param rad Radius in pixels of the filled pie.
+\param start Starting radius in degrees of the filled pie.
+\param end Ending radius in degrees of the filled pie.
+\param r The red value of the filled pie to draw. 
+\param g The green value of the filled pie to draw. 
+\param b The blue value of the filled pie to draw. 
+\param a The alpha value of the filled pie to draw.
 
-\returns Returns 0 if a==b, a negative number if a<b or a positive number if a>b.
+\returns Returns 0 on success, -1 on failure.
 */
-int _gfxPrimitivesCompareInt(const void *a, const void *b)
+int filledPieRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	return (*(const int *) a) - (*(const int *) b);
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _pieRGBA(&dst, x, y, rad, start, end, r, g, b, a, 1));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
 /*!
-\brief Global vertex array to use if optional parameters are not given in filledPolygonMT calls.
+\brief Draw trigon (triangle outline) with alpha blending directly onto a surface.
 
-Note: Used for non-multithreaded (default) operation of filledPolygonMT.
-*/
-static int *gfxPrimitivesPolyIntsGlobal = NULL;
+Note: Creates vertex array and uses polygon routine to render.
 
-/*!
-\brief Flag indicating if global vertex array was already allocated.
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the trigon.
+\param y1 Y coordinate of the first point of the trigon.
+\param x2 X coordinate of the second point of the trigon.
+\param y2 Y coordinate of the second point of the trigon.
+\param x3 X coordinate of the third point of the trigon.
+\param y3 Y coordinate of the third point of the trigon.
+\param color The color value of the trigon to draw (0xRRGGBBAA). 
 
-Note: Used for non-multithreaded (default) operation of filledPolygonMT.
+\returns Returns 0 on success, -1 on failure.
 */
-static int gfxPrimitivesPolyAllocatedGlobal = 0;
+int trigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
 
-/*!
-\brief Draw filled polygon with alpha blending (multi-threaded capable).
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
 
-Note: The last two parameters are optional; but are required for multithreaded operation.  
+	return(polygonColor_Surface(surface,vx,vy,3,color));
+}
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the filled polygon.
-\param vy Vertex array containing Y coordinates of the points of the filled polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param r The red value of the filled polygon to draw. 
-\param g The green value of the filled polygon to draw. 
-\param b The blue value of the filled polygon to draw. 
-\param a The alpha value of the filled polygon to draw.
-\param polyInts Preallocated, temporary vertex array used for sorting vertices. Required for multithreaded operation; set to NULL otherwise.
-\param polyAllocated Flag indicating if temporary vertex array was allocated. Required for multithreaded operation; set to NULL otherwise.
+/*!
+\brief Draw trigon (triangle outline) with alpha blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the trigon.
+\param y1 Y coordinate of the first point of the trigon.
+\param x2 X coordinate of the second point of the trigon.
+\param y2 Y coordinate of the second point of the trigon.
+\param x3 X coordinate of the third point of the trigon.
+\param y3 Y coordinate of the third point of the trigon.
+\param r The red value of the trigon to draw. 
+\param g The green value of the trigon to draw. 
+\param b The blue value of the trigon to draw. 
+\param a The alpha value of the trigon to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledPolygonRGBAMT(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a, int **polyInts, int *polyAllocated)
+int trigonRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
 	int result;
-	int i;
-	int y, xa, xb;
-	int miny, maxy;
-	int x1, y1;
-	int x2, y2;
-	int ind1, ind2;
-	int ints;
-	int *gfxPrimitivesPolyInts = NULL;
-	int *gfxPrimitivesPolyIntsNew = NULL;
-	int gfxPrimitivesPolyAllocated = 0;
-
-	/*
-	* Vertex array NULL check 
-	*/
-	if (vx == NULL) {
-		return (-1);
-	}
-	if (vy == NULL) {
-		return (-1);
-	}
+	SDL2_gfxTarget dst;
 
-	/*
-	* Sanity check number of edges
-	*/
-	if (n < 3) {
+	if (_gfxSurfaceTarget(&dst, surface)) {
 		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _trigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Map polygon cache  
-	*/
-	if ((polyInts==NULL) || (polyAllocated==NULL)) {
-		/* Use global cache */
-		gfxPrimitivesPolyInts = gfxPrimitivesPolyIntsGlobal;
-		gfxPrimitivesPolyAllocated = gfxPrimitivesPolyAllocatedGlobal;
-	} else {
-		/* Use local cache */
-		gfxPrimitivesPolyInts = *polyInts;
-		gfxPrimitivesPolyAllocated = *polyAllocated;
-	}
+	return result;
+}
 
-	/*
-	* Allocate temp array, only grow array 
-	*/
-	if (!gfxPrimitivesPolyAllocated) {
-		gfxPrimitivesPolyInts = (int *) malloc(sizeof(int) * n);
-		gfxPrimitivesPolyAllocated = n;
-	} else {
-		if (gfxPrimitivesPolyAllocated < n) {
-			gfxPrimitivesPolyIntsNew = (int *) realloc(gfxPrimitivesPolyInts, sizeof(int) * n);
-			if (!gfxPrimitivesPolyIntsNew) {
-				if (!gfxPrimitivesPolyInts) {
-					free(gfxPrimitivesPolyInts);
-					gfxPrimitivesPolyInts = NULL;
-				}
-				gfxPrimitivesPolyAllocated = 0;
-			} else {
-				gfxPrimitivesPolyInts = gfxPrimitivesPolyIntsNew;
-				gfxPrimitivesPolyAllocated = n;
-			}
-		}
-	}
+/*!
+\brief Draw anti-aliased trigon (triangle outline) with alpha blending directly onto a surface.
 
-	/*
-	* Check temp array
-	*/
-	if (gfxPrimitivesPolyInts==NULL) {        
-		gfxPrimitivesPolyAllocated = 0;
-	}
+Note: Creates vertex array and uses aapolygon routine to render.
 
-	/*
-	* Update cache variables
-	*/
-	if ((polyInts==NULL) || (polyAllocated==NULL)) { 
-		gfxPrimitivesPolyIntsGlobal =  gfxPrimitivesPolyInts;
-		gfxPrimitivesPolyAllocatedGlobal = gfxPrimitivesPolyAllocated;
-	} else {
-		*polyInts = gfxPrimitivesPolyInts;
-		*polyAllocated = gfxPrimitivesPolyAllocated;
-	}
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the aa-trigon.
+\param y1 Y coordinate of the first point of the aa-trigon.
+\param x2 X coordinate of the second point of the aa-trigon.
+\param y2 Y coordinate of the second point of the aa-trigon.
+\param x3 X coordinate of the third point of the aa-trigon.
+\param y3 Y coordinate of the third point of the aa-trigon.
+\param color The color value of the aa-trigon to draw (0xRRGGBBAA). 
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aatrigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
+
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(aapolygonColor_Surface(surface,vx,vy,3,color));
+}
+
+/*!
+\brief Draw anti-aliased trigon (triangle outline) with alpha blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the aa-trigon.
+\param y1 Y coordinate of the first point of the aa-trigon.
+\param x2 X coordinate of the second point of the aa-trigon.
+\param y2 Y coordinate of the second point of the aa-trigon.
+\param x3 X coordinate of the third point of the aa-trigon.
+\param y3 Y coordinate of the third point of the aa-trigon.
+\param r The red value of the aa-trigon to draw. 
+\param g The green value of the aa-trigon to draw. 
+\param b The blue value of the aa-trigon to draw. 
+\param a The alpha value of the aa-trigon to draw.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aatrigonRGBA_Surface(SDL_Surface * surface,  Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Check temp array again
-	*/
-	if (gfxPrimitivesPolyInts==NULL) {        
-		return(-1);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aatrigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Determine Y maxima 
-	*/
-	miny = vy[0];
-	maxy = vy[0];
-	for (i = 1; (i < n); i++) {
-		if (vy[i] < miny) {
-			miny = vy[i];
-		} else if (vy[i] > maxy) {
-			maxy = vy[i];
-		}
-	}
+	return result;
+}
 
-	/*
-	* Draw, scanning y 
-	*/
-	result = 0;
-	for (y = miny; (y <= maxy); y++) {
-		ints = 0;
-		for (i = 0; (i < n); i++) {
-			if (!i) {
-				ind1 = n - 1;
-				ind2 = 0;
-			} else {
-				ind1 = i - 1;
-				ind2 = i;
-			}
-			y1 = vy[ind1];
-			y2 = vy[ind2];
-			if (y1 < y2) {
-				x1 = vx[ind1];
-				x2 = vx[ind2];
-			} else if (y1 > y2) {
-				y2 = vy[ind1];
-				y1 = vy[ind2];
-				x2 = vx[ind1];
-				x1 = vx[ind2];
-			} else {
-				continue;
-			}
-			if ( ((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)) ) {
-				gfxPrimitivesPolyInts[ints++] = ((65536 * (y - y1)) / (y2 - y1)) * (x2 - x1) + (65536 * x1);
-			} 	    
-		}
+/*!
+\brief Draw filled trigon (triangle) with alpha blending directly onto a surface.
 
-		qsort(gfxPrimitivesPolyInts, ints, sizeof(int), _gfxPrimitivesCompareInt);
+Note: Creates vertex array and uses aapolygon routine to render.
 
-		/*
-		* Set color 
-		*/
-		result = 0;
-	    result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-		result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);	
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the filled trigon.
+\param y1 Y coordinate of the first point of the filled trigon.
+\param x2 X coordinate of the second point of the filled trigon.
+\param y2 Y coordinate of the second point of the filled trigon.
+\param x3 X coordinate of the third point of the filled trigon.
+\param y3 Y coordinate of the third point of the filled trigon.
+\param color The color value of the filled trigon to draw (0xRRGGBBAA). 
 
-		for (i = 0; (i < ints); i += 2) {
-			xa = gfxPrimitivesPolyInts[i] + 1;
-			xa = (xa >> 16) + ((xa & 32768) >> 15);
-			xb = gfxPrimitivesPolyInts[i+1] - 1;
-			xb = (xb >> 16) + ((xb & 32768) >> 15);
-			result |= hline(renderer, xa, xb, y);
-		}
-	}
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledTrigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color)
+{
+	Sint16 vx[3]; 
+	Sint16 vy[3];
 
-	return (result);
+	vx[0]=x1;
+	vx[1]=x2;
+	vx[2]=x3;
+	vy[0]=y1;
+	vy[1]=y2;
+	vy[2]=y3;
+
+	return(filledPolygonColor_Surface(surface,vx,vy,3,color));
 }
 
 /*!
-\brief Draw filled polygon with alpha blending.
+\brief Draw filled trigon (triangle) with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the filled polygon.
-\param vy Vertex array containing Y coordinates of the points of the filled polygon.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param color The color value of the filled polygon to draw (0xRRGGBBAA). 
+Note: Creates vertex array and uses aapolygon routine to render.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point of the filled trigon.
+\param y1 Y coordinate of the first point of the filled trigon.
+\param x2 X coordinate of the second point of the filled trigon.
+\param y2 Y coordinate of the second point of the filled trigon.
+\param x3 X coordinate of the third point of the filled trigon.
+\param y3 Y coordinate of the third point of the filled trigon.
+\param r The red value of the filled trigon to draw. 
+\param g The green value of the filled trigon to draw. 
+\param b The blue value of the filled trigon to draw. 
+\param a The alpha value of the filled trigon to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledPolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+int filledTrigonRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return filledPolygonRGBAMT(renderer, vx, vy, n, c[0], c[1], c[2], c[3], NULL, NULL);
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledTrigonRGBA(&dst, x1, y1, x2, y2, x3, y3, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
 /*!
-\brief Draw filled polygon with alpha blending.
+\brief Draw polygon with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the filled polygon.
-\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
 \param n Number of points in the vertex array. Minimum number is 3.
-\param r The red value of the filled polygon to draw. 
-\param g The green value of the filled polygon to draw. 
-\param b The blue value of the filed polygon to draw. 
-\param a The alpha value of the filled polygon to draw.
+\param color The color value of the polygon to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int filledPolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int polygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
 {
-	return filledPolygonRGBAMT(renderer, vx, vy, n, r, g, b, a, NULL, NULL);
+	Uint8 *c = (Uint8 *)&color; 
+	return polygonRGBA_Surface(surface, vx, vy, n, c[0], c[1], c[2], c[3]);
 }
 
-/* ---- Textured Polygon */
-
 /*!
-\brief Internal function to draw a textured horizontal line.
+\brief Draw polygon with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point (i.e. left) of the line.
-\param x2 X coordinate of the second point (i.e. right) of the line.
-\param y Y coordinate of the points of the line.
-\param texture The texture to retrieve color information from.
-\param texture_w The width of the texture.
-\param texture_h The height of the texture.
-\param texture_dx The X offset for the texture lookup.
-\param texture_dy The Y offset for the textured lookup.
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the polygon.
+\param vy Vertex array containing Y coordinates of the points of the polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the polygon to draw. 
+\param g The green value of the polygon to draw. 
+\param b The blue value of the polygon to draw. 
+\param a The alpha value of the polygon to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int _HLineTextured(SDL_Renderer *renderer, Sint16 x1, Sint16 x2, Sint16 y, SDL_Texture *texture, int texture_w, int texture_h, int texture_dx, int texture_dy)
+int polygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	Sint16 w;
-	Sint16 xtmp;
-	int result = 0;
-	int texture_x_walker;    
-	int texture_y_start;    
-	SDL_Rect source_rect,dst_rect;
-	int pixels_written,write_width;
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Swap x1, x2 if required to ensure x1<=x2
-	*/
-	if (x1 > x2) {
-		xtmp = x1;
-		x1 = x2;
-		x2 = xtmp;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _polygonRGBA(&dst, vx, vy, n, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Calculate width to draw
-	*/
-	w = x2 - x1 + 1;
+	return result;
+}
 
-	/*
-	* Determine where in the texture we start drawing
-	*/
-	texture_x_walker =   (x1 - texture_dx)  % texture_w;
-	if (texture_x_walker < 0){
-		texture_x_walker = texture_w + texture_x_walker ;
-	}
+/*!
+\brief Draw anti-aliased polygon with alpha blending directly onto a surface.
 
-	texture_y_start = (y + texture_dy) % texture_h;
-	if (texture_y_start < 0){
-		texture_y_start = texture_h + texture_y_start;
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the aa-polygon.
+\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the aa-polygon to draw (0xRRGGBBAA). 
 
-	/* setup the source rectangle; we are only drawing one horizontal line */
-	source_rect.y = texture_y_start;
-	source_rect.x = texture_x_walker;
-	source_rect.h = 1;
+\returns Returns 0 on success, -1 on failure.
+*/
+int aapolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aapolygonRGBA_Surface(surface, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
 
-	/* we will draw to the current y */
-	dst_rect.y = y;
-	dst_rect.h = 1;
+/*!
+\brief Draw anti-aliased polygon with alpha blending directly onto a surface.
 
-	/* if there are enough pixels left in the current row of the texture */
-	/* draw it all at once */
-	if (w <= texture_w -texture_x_walker){
-		source_rect.w = w;
-		source_rect.x = texture_x_walker;
-		dst_rect.x= x1;
-		dst_rect.w = source_rect.w;
-		result = (SDL_RenderCopy(renderer, texture, &source_rect, &dst_rect) == 0);
-	} else { 
-		/* we need to draw multiple times */
-		/* draw the first segment */
-		pixels_written = texture_w  - texture_x_walker;
-		source_rect.w = pixels_written;
-		source_rect.x = texture_x_walker;
-		dst_rect.x= x1;
-		dst_rect.w = source_rect.w;
-		result |= (SDL_RenderCopy(renderer, texture, &source_rect, &dst_rect) == 0);
-		write_width = texture_w;
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the aa-polygon.
+\param vy Vertex array containing Y coordinates of the points of the aa-polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the aa-polygon to draw. 
+\param g The green value of the aa-polygon to draw. 
+\param b The blue value of the aa-polygon to draw. 
+\param a The alpha value of the aa-polygon to draw.
 
-		/* now draw the rest */
-		/* set the source x to 0 */
-		source_rect.x = 0;
-		while (pixels_written < w){
-			if (write_width >= w - pixels_written) {
-				write_width =  w - pixels_written;
-			}
-			source_rect.w = write_width;
-			dst_rect.x = x1 + pixels_written;
-			dst_rect.w = source_rect.w;
-			result |= (SDL_RenderCopy(renderer, texture, &source_rect, &dst_rect) == 0);
-			pixels_written += write_width;
-		}
+\returns Returns 0 on success, -1 on failure.
+*/
+int aapolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aapolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
 	return result;
 }
 
 /*!
-\brief Draws a polygon filled with the given texture (Multi-Threading Capable). 
+\brief Draw filled polygon with alpha blending directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx array of x vector components
-\param vy array of x vector components
-\param n the amount of vectors in the vx and vy array
-\param texture the sdl surface to use to fill the polygon
-\param texture_dx the offset of the texture relative to the screeen. If you move the polygon 10 pixels 
-to the left and want the texture to apear the same you need to increase the texture_dx value
-\param texture_dy see texture_dx
-\param polyInts Preallocated temp array storage for vertex sorting (used for multi-threaded operation)
-\param polyAllocated Flag indicating oif the temp array was allocated (used for multi-threaded operation)
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the filled polygon to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int texturedPolygonMT(SDL_Renderer *renderer, const Sint16 * vx, const Sint16 * vy, int n, 
-	SDL_Surface * texture, int texture_dx, int texture_dy, int **polyInts, int *polyAllocated)
+int filledPolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
 {
-	int result;
-	int i;
-	int y, xa, xb;
-	int minx,maxx,miny, maxy;
-	int x1, y1;
-	int x2, y2;
-	int ind1, ind2;
-	int ints;
-	int *gfxPrimitivesPolyInts = NULL;
-	int *gfxPrimitivesPolyIntsTemp = NULL;
-	int gfxPrimitivesPolyAllocated = 0;
-	SDL_Texture *textureAsTexture = NULL;
+	Uint8 *c = (Uint8 *)&color; 
+	return filledPolygonRGBA_Surface(surface, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
 
-	/*
-	* Sanity check number of edges
-	*/
-	if (n < 3) {
-		return -1;
-	}
+/*!
+\brief Draw filled polygon with alpha blending directly onto a surface.
 
-	/*
-	* Map polygon cache  
-	*/
-	if ((polyInts==NULL) || (polyAllocated==NULL)) {
-		/* Use global cache */
-		gfxPrimitivesPolyInts = gfxPrimitivesPolyIntsGlobal;
-		gfxPrimitivesPolyAllocated = gfxPrimitivesPolyAllocatedGlobal;
-	} else {
-		/* Use local cache */
-		gfxPrimitivesPolyInts = *polyInts;
-		gfxPrimitivesPolyAllocated = *polyAllocated;
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filed polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
 
-	/*
-	* Allocate temp array, only grow array 
-	*/
-	if (!gfxPrimitivesPolyAllocated) {
-		gfxPrimitivesPolyInts = (int *) malloc(sizeof(int) * n);
-		gfxPrimitivesPolyAllocated = n;
-	} else {
-		if (gfxPrimitivesPolyAllocated < n) {
-			gfxPrimitivesPolyIntsTemp = (int *) realloc(gfxPrimitivesPolyInts, sizeof(int) * n);
-			if (gfxPrimitivesPolyIntsTemp == NULL) {
-				/* Realloc failed - keeps original memory block, but fails this operation */
-				return(-1);
-			}
-			gfxPrimitivesPolyInts = gfxPrimitivesPolyIntsTemp;
-			gfxPrimitivesPolyAllocated = n;
-		}
-	}
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Check temp array
-	*/
-	if (gfxPrimitivesPolyInts==NULL) {        
-		gfxPrimitivesPolyAllocated = 0;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledPolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Update cache variables
-	*/
-	if ((polyInts==NULL) || (polyAllocated==NULL)) { 
-		gfxPrimitivesPolyIntsGlobal =  gfxPrimitivesPolyInts;
-		gfxPrimitivesPolyAllocatedGlobal = gfxPrimitivesPolyAllocated;
-	} else {
-		*polyInts = gfxPrimitivesPolyInts;
-		*polyAllocated = gfxPrimitivesPolyAllocated;
-	}
+	return result;
+}
 
-	/*
-	* Check temp array again
-	*/
-	if (gfxPrimitivesPolyInts==NULL) {        
-		return(-1);
-	}
+/*!
+\brief Draw anti-aliased filled polygon with alpha blending directly onto a surface.
 
-	/*
-	* Determine X,Y minima,maxima 
-	*/
-	miny = vy[0];
-	maxy = vy[0];
-	minx = vx[0];
-	maxx = vx[0];
-	for (i = 1; (i < n); i++) {
-		if (vy[i] < miny) {
-			miny = vy[i];
-		} else if (vy[i] > maxy) {
-			maxy = vy[i];
-		}
-		if (vx[i] < minx) {
-			minx = vx[i];
-		} else if (vx[i] > maxx) {
-			maxx = vx[i];
-		}
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param color The color value of the filled polygon to draw (0xRRGGBBAA). 
 
-    /* Create texture for drawing */
-	textureAsTexture = SDL_CreateTextureFromSurface(renderer, texture);
-	if (textureAsTexture == NULL)
-	{
-		return -1;
-	}
-	SDL_SetTextureBlendMode(textureAsTexture, SDL_BLENDMODE_BLEND);
-	
-	/*
-	* Draw, scanning y 
-	*/
-	result = 0;
-	for (y = miny; (y <= maxy); y++) {
-		ints = 0;
-		for (i = 0; (i < n); i++) {
-			if (!i) {
-				ind1 = n - 1;
-				ind2 = 0;
-			} else {
-				ind1 = i - 1;
-				ind2 = i;
-			}
-			y1 = vy[ind1];
-			y2 = vy[ind2];
-			if (y1 < y2) {
-				x1 = vx[ind1];
-				x2 = vx[ind2];
-			} else if (y1 > y2) {
-				y2 = vy[ind1];
-				y1 = vy[ind2];
-				x2 = vx[ind1];
-				x1 = vx[ind2];
-			} else {
-				continue;
-			}
-			if ( ((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)) ) {
-				gfxPrimitivesPolyInts[ints++] = ((65536 * (y - y1)) / (y2 - y1)) * (x2 - x1) + (65536 * x1);
-			} 
-		}
+\returns Returns 0 on success, -1 on failure.
+*/
+int aafilledPolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return aafilledPolygonRGBA_Surface(surface, vx, vy, n, c[0], c[1], c[2], c[3]);
+}
 
-		qsort(gfxPrimitivesPolyInts, ints, sizeof(int), _gfxPrimitivesCompareInt);
+/*!
+\brief Draw anti-aliased filled polygon with alpha blending directly onto a surface.
 
-		for (i = 0; (i < ints); i += 2) {
-			xa = gfxPrimitivesPolyInts[i] + 1;
-			xa = (xa >> 16) + ((xa & 32768) >> 15);
-			xb = gfxPrimitivesPolyInts[i+1] - 1;
-			xb = (xb >> 16) + ((xb & 32768) >> 15);
-			result |= _HLineTextured(renderer, xa, xb, y, textureAsTexture, texture->w, texture->h, texture_dx, texture_dy);
-		}
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param r The red value of the filled polygon to draw. 
+\param g The green value of the filled polygon to draw. 
+\param b The blue value of the filled polygon to draw. 
+\param a The alpha value of the filled polygon to draw.
 
-	SDL_RenderPresent(renderer);
-	SDL_DestroyTexture(textureAsTexture);
+\returns Returns 0 on success, -1 on failure.
+*/
+int aafilledPolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	return (result);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _aafilledPolygonRGBA(&dst, vx, vy, n, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
 /*!
-\brief Draws a polygon filled with the given texture. 
+\brief Draws a polygon filled with the given texture directly onto a surface.
 
 This standard version is calling multithreaded versions with NULL cache parameters.
 
-\param renderer The renderer to draw on.
+\param surface The surface to draw on.
 \param vx array of x vector components
 \param vy array of x vector components
 \param n the amount of vectors in the vx and vy array
@@ -3189,302 +15172,225 @@ to the left and want the texture to apear the same you need to increase the text
 
 \returns Returns 0 on success, -1 on failure.
 */
-int texturedPolygon(SDL_Renderer *renderer, const Sint16 * vx, const Sint16 * vy, int n, SDL_Surface *texture, int texture_dx, int texture_dy)
+int texturedPolygon_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, SDL_Surface *texture, int texture_dx, int texture_dy)
 {
-	/*
-	* Draw
-	*/
-	return (texturedPolygonMT(renderer, vx, vy, n, texture, texture_dx, texture_dy, NULL, NULL));
-}
+	int result;
+	SDL2_gfxTarget dst;
 
-/* ---- Character */
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXTURED_POLYGON, _texturedPolygonMT(&dst, vx, vy, n, texture, texture_dx, texture_dy, NULL, NULL));
+	_gfxSurfaceTargetDone(&dst);
 
-/*!
-\brief Global cache for NxM pixel font textures created at runtime.
-*/
-static SDL_Texture *gfxPrimitivesFont[256];
+	return result;
+}
 
 /*!
-\brief Pointer to the current font data. Default is a 8x8 pixel internal font. 
-*/
-static const unsigned char *currentFontdata = gfxPrimitivesFontdata;
+\brief Draw a bezier curve with alpha blending directly onto a surface.
 
-/*!
-\brief Width of the current font. Default is 8. 
-*/
-static Uint32 charWidth = 8;
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the bezier curve.
+\param vy Vertex array containing Y coordinates of the points of the bezier curve.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param s Maximum number of points the curve is drawn through; fewer are used where the curve is flat. Minimum number is 2.
+\param color The color value of the bezier curve to draw (0xRRGGBBAA). 
 
-/*!
-\brief Height of the current font. Default is 8. 
+\returns Returns 0 on success, -1 on failure.
 */
-static Uint32 charHeight = 8;
+int bezierColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint32 color)
+{
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierRGBA_Surface(surface, vx, vy, n, s, c[0], c[1], c[2], c[3]);
+}
 
 /*!
-\brief Width for rendering. Autocalculated.
-*/
-static Uint32 charWidthLocal = 8;
+\brief Draw a bezier curve with alpha blending directly onto a surface.
 
-/*!
-\brief Height for rendering. Autocalculated.
-*/
-static Uint32 charHeightLocal = 8;
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the bezier curve.
+\param vy Vertex array containing Y coordinates of the points of the bezier curve.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param s Maximum number of points the curve is drawn through; fewer are used where the curve is flat. Minimum number is 2.
+\param r The red value of the bezier curve to draw. 
+\param g The green value of the bezier curve to draw. 
+\param b The blue value of the bezier curve to draw. 
+\param a The alpha value of the bezier curve to draw.
 
-/*!
-\brief Pitch of the current font in bytes. Default is 1. 
+\returns Returns 0 on success, -1 on failure.
 */
-static Uint32 charPitch = 1;
+int bezierRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-/*!
-\brief Characters 90deg clockwise rotations. Default is 0. Max is 3. 
-*/
-static Uint32 charRotation = 0;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierRGBA(&dst, vx, vy, n, s, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-/*!
-\brief Character data size in bytes of the current font. Default is 8. 
-*/
-static Uint32 charSize = 8;
+	return result;
+}
 
 /*!
-\brief Sets or resets the current global font data.
-
-The font data array is organized in follows: 
-[fontdata] = [character 0][character 1]...[character 255] where
-[character n] = [byte 1 row 1][byte 2 row 1]...[byte {pitch} row 1][byte 1 row 2] ...[byte {pitch} row height] where
-[byte n] = [bit 0]...[bit 7] where 
-[bit n] = [0 for transparent pixel|1 for colored pixel]
+\brief Draw a cubic bezier curve segment with alpha blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx1 X coordinate of the first control point.
+\param cy1 Y coordinate of the first control point.
+\param cx2 X coordinate of the second control point.
+\param cy2 Y coordinate of the second control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param color The color value of the curve to draw (0xRRGGBBAA). 
 
-\param fontdata Pointer to array of font data. Set to NULL, to reset global font to the default 8x8 font.
-\param cw Width of character in bytes. Ignored if fontdata==NULL.
-\param ch Height of character in bytes. Ignored if fontdata==NULL.
+\returns Returns 0 on success, -1 on failure.
 */
-void gfxPrimitivesSetFont(const void *fontdata, Uint32 cw, Uint32 ch)
+int bezierCubicColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint32 color)
 {
-	int i;
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierCubicRGBA_Surface(surface, x1, y1, cx1, cy1, cx2, cy2, x2, y2, c[0], c[1], c[2], c[3]);
+}
 
-	if ((fontdata) && (cw) && (ch)) {
-		currentFontdata = (unsigned char *)fontdata;
-		charWidth = cw;
-		charHeight = ch;
-	} else {
-		currentFontdata = gfxPrimitivesFontdata;
-		charWidth = 8;
-		charHeight = 8;
-	}
+/*!
+\brief Draw a cubic bezier curve segment with alpha blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx1 X coordinate of the first control point.
+\param cy1 Y coordinate of the first control point.
+\param cx2 X coordinate of the second control point.
+\param cy2 Y coordinate of the second control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
 
-	charPitch = (charWidth+7)/8;
-	charSize = charPitch * charHeight;
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierCubicRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-	/* Maybe flip width/height for rendering */
-	if ((charRotation==1) || (charRotation==3))
-	{
-		charWidthLocal = charHeight;
-		charHeightLocal = charWidth;
-	}
-	else
-	{
-		charWidthLocal = charWidth;
-		charHeightLocal = charHeight;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierCubicRGBA(&dst, x1, y1, cx1, cy1, cx2, cy2, x2, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	/* Clear character cache */
-	for (i = 0; i < 256; i++) {
-		if (gfxPrimitivesFont[i]) {
-			SDL_DestroyTexture(gfxPrimitivesFont[i]);
-			gfxPrimitivesFont[i] = NULL;
-		}
-	}
+	return result;
 }
 
 /*!
-\brief Sets current global font character rotation steps. 
+\brief Draw a quadratic bezier curve segment with alpha blending directly onto a surface.
 
-Default is 0 (no rotation). 1 = 90deg clockwise. 2 = 180deg clockwise. 3 = 270deg clockwise.
-Changing the rotation, will reset the character cache.
+\param surface The surface to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx X coordinate of the control point.
+\param cy Y coordinate of the control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param color The color value of the curve to draw (0xRRGGBBAA). 
 
-\param rotation Number of 90deg clockwise steps to rotate
+\returns Returns 0 on success, -1 on failure.
 */
-void gfxPrimitivesSetFontRotation(Uint32 rotation)
+int bezierQuadColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint32 color)
 {
-	int i;
+	Uint8 *c = (Uint8 *)&color; 
+	return bezierQuadRGBA_Surface(surface, x1, y1, cx, cy, x2, y2, c[0], c[1], c[2], c[3]);
+}
 
-	rotation = rotation & 3;
-	if (charRotation != rotation)
-	{
-		/* Store rotation */
-		charRotation = rotation;
+/*!
+\brief Draw a quadratic bezier curve segment with alpha blending directly onto a surface.
+
+\param surface The surface to draw on.
+\param x1 X coordinate of the start point.
+\param y1 Y coordinate of the start point.
+\param cx X coordinate of the control point.
+\param cy Y coordinate of the control point.
+\param x2 X coordinate of the end point.
+\param y2 Y coordinate of the end point.
+\param r The red value of the curve to draw. 
+\param g The green value of the curve to draw. 
+\param b The blue value of the curve to draw. 
+\param a The alpha value of the curve to draw.
 
-		/* Maybe flip width/height for rendering */
-		if ((charRotation==1) || (charRotation==3))
-		{
-			charWidthLocal = charHeight;
-			charHeightLocal = charWidth;
-		}
-		else
-		{
-			charWidthLocal = charWidth;
-			charHeightLocal = charHeight;
-		}
+\returns Returns 0 on success, -1 on failure.
+*/
+int bezierQuadRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
-		/* Clear character cache */
-		for (i = 0; i < 256; i++) {
-			if (gfxPrimitivesFont[i]) {
-				SDL_DestroyTexture(gfxPrimitivesFont[i]);
-				gfxPrimitivesFont[i] = NULL;
-			}
-		}
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_BEZIER, _bezierQuadRGBA(&dst, x1, y1, cx, cy, x2, y2, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
 
 /*!
-\brief Draw a character of the currently set font.
+\brief Draw a character of the currently set font directly onto a surface.
 
-\param renderer The Renderer to draw on.
+\param surface The surface to draw on.
 \param x X (horizontal) coordinate of the upper left corner of the character.
 \param y Y (vertical) coordinate of the upper left corner of the character.
 \param c The character to draw.
-\param r The red value of the character to draw. 
-\param g The green value of the character to draw. 
-\param b The blue value of the character to draw. 
-\param a The alpha value of the character to draw.
+\param color The color value of the character to draw (0xRRGGBBAA). 
 
 \returns Returns 0 on success, -1 on failure.
 */
-int characterRGBA(SDL_Renderer *renderer, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int characterColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, char c, Uint32 color)
 {
-	SDL_Rect srect;
-	SDL_Rect drect;
-	int result;
-	Uint32 ix, iy;
-	const unsigned char *charpos;
-	Uint8 *curpos;
-	Uint8 patt, mask;
-	Uint8 *linepos;
-	Uint32 pitch;
-	SDL_Surface *character;
-	SDL_Surface *rotatedCharacter;
-	Uint32 ci;
-
-	/*
-	* Setup source rectangle
-	*/
-	srect.x = 0;
-	srect.y = 0;
-	srect.w = charWidthLocal;
-	srect.h = charHeightLocal;
-
-	/*
-	* Setup destination rectangle
-	*/
-	drect.x = x;
-	drect.y = y;
-	drect.w = charWidthLocal;
-	drect.h = charHeightLocal;
-
-	/* Character index in cache */
-	ci = (unsigned char) c;
-
-	/*
-	* Create new charWidth x charHeight bitmap surface if not already present.
-	* Might get rotated later.
-	*/
-	if (gfxPrimitivesFont[ci] == NULL) {
-		/*
-		* Redraw character into surface
-		*/
-		character =	SDL_CreateRGBSurface(SDL_SWSURFACE,
-			charWidth, charHeight, 32,
-			0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
-		if (character == NULL) {
-			return (-1);
-		}
-
-		charpos = currentFontdata + ci * charSize;
-				linepos = (Uint8 *)character->pixels;
-		pitch = character->pitch;
-
-		/*
-		* Drawing loop 
-		*/
-		patt = 0;
-		for (iy = 0; iy < charHeight; iy++) {
-			mask = 0x00;
-			curpos = linepos;
-			for (ix = 0; ix < charWidth; ix++) {
-				if (!(mask >>= 1)) {
-					patt = *charpos++;
-					mask = 0x80;
-				}
-				if (patt & mask) {
-					*(Uint32 *)curpos = 0xffffffff;
-				} else {
-					*(Uint32 *)curpos = 0;
-				}
-				curpos += 4;
-			}
-			linepos += pitch;
-		}
-
-		/* Maybe rotate and replace cached image */
-		if (charRotation>0)
-		{
-			rotatedCharacter = rotateSurface90Degrees(character, charRotation);
-			SDL_FreeSurface(character);
-			character = rotatedCharacter;
-		}
-
-		/* Convert temp surface into texture */
-		gfxPrimitivesFont[ci] = SDL_CreateTextureFromSurface(renderer, character);
-		SDL_FreeSurface(character);
-
-		/*
-		* Check pointer 
-		*/
-		if (gfxPrimitivesFont[ci] == NULL) {
-			return (-1);
-		}
-	}
-
-	/*
-	* Set color 
-	*/
-	result = 0;
-	result |= SDL_SetTextureColorMod(gfxPrimitivesFont[ci], r, g, b);
-	result |= SDL_SetTextureAlphaMod(gfxPrimitivesFont[ci], a);
-
-	/*
-	* Draw texture onto destination 
-	*/
-	result |= SDL_RenderCopy(renderer, gfxPrimitivesFont[ci], &srect, &drect);
-
-	return (result);
+	Uint8 *co = (Uint8 *)&color; 
+	return characterRGBA_Surface(surface, x, y, c, co[0], co[1], co[2], co[3]);
 }
 
-
 /*!
-\brief Draw a character of the currently set font.
+\brief Draw a character of the currently set font directly onto a surface.
 
-\param renderer The renderer to draw on.
+\param renderer The Renderer to draw on.
 \param x X (horizontal) coordinate of the upper left corner of the character.
 \param y Y (vertical) coordinate of the upper left corner of the character.
 \param c The character to draw.
-\param color The color value of the character to draw (0xRRGGBBAA). 
+\param r The red value of the character to draw. 
+\param g The green value of the character to draw. 
+\param b The blue value of the character to draw. 
+\param a The alpha value of the character to draw.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int characterColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, char c, Uint32 color)
+int characterRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	Uint8 *co = (Uint8 *)&color; 
-	return characterRGBA(renderer, x, y, c, co[0], co[1], co[2], co[3]);
-}
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _characterRGBA(&dst, &gfxPrimitivesDefaultFont, x, y, c, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
+	return result;
+}
 
 /*!
-\brief Draw a string in the currently set font.
+\brief Draw a string in the currently set font directly onto a surface.
 
 The spacing between consequtive characters in the string is the fixed number of pixels 
 of the character width of the current global font.
 
-\param renderer The renderer to draw on.
+\param surface The surface to draw on.
 \param x X (horizontal) coordinate of the upper left corner of the string.
 \param y Y (vertical) coordinate of the upper left corner of the string.
 \param s The string to draw.
@@ -3492,16 +15398,16 @@ of the character width of the current global font.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int stringColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint32 color)
+int stringColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, const char *s, Uint32 color)
 {
 	Uint8 *c = (Uint8 *)&color; 
-	return stringRGBA(renderer, x, y, s, c[0], c[1], c[2], c[3]);
+	return stringRGBA_Surface(surface, x, y, s, c[0], c[1], c[2], c[3]);
 }
 
 /*!
-\brief Draw a string in the currently set font.
+\brief Draw a string in the currently set font directly onto a surface.
 
-\param renderer The renderer to draw on.
+\param surface The surface to draw on.
 \param x X (horizontal) coordinate of the upper left corner of the string.
 \param y Y (vertical) coordinate of the upper left corner of the string.
 \param s The string to draw.
@@ -3512,279 +15418,318 @@ int stringColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint
 
 \returns Returns 0 on success, -1 on failure.
 */
-int stringRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int stringRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-	int result = 0;
-	Sint16 curx = x;
-	Sint16 cury = y;
-	const char *curchar = s;
+	int result;
+	SDL2_gfxTarget dst;
 
-	while (*curchar && !result) {
-		result |= characterRGBA(renderer, curx, cury, *curchar, r, g, b, a);
-		switch (charRotation)
-		{
-		case 0:
-			curx += charWidthLocal;
-			break;
-		case 2:
-			curx -= charWidthLocal;
-			break;
-		case 1:
-			cury += charHeightLocal;
-			break;
-		case 3:
-			cury -= charHeightLocal;
-			break;
-		}
-		curchar++;
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_TEXT, _stringRGBA(&dst, &gfxPrimitivesDefaultFont, x, y, s, r, g, b, a));
+	_gfxSurfaceTargetDone(&dst);
 
-	return (result);
+	return result;
 }
 
-/* ---- Bezier curve */
-
 /*!
-\brief Internal function to calculate bezier interpolator of data array with ndata values at position 't'.
+\brief Draw many filled circles of the same radius with blending, each in its own color, directly onto a surface.
 
-\param data Array of values.
-\param ndata Size of array.
-\param t Position for which to calculate interpolated value. t should be between [0, ndata].
+\param surface The surface to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
 
-\returns Interpolated value at position t, value[0] when t<0, value[n-1] when t>n.
+\returns Returns 0 on success, -1 on failure.
 */
-double _evaluateBezier (double *data, int ndata, double t) 
+int filledCirclesRGBA_Surface(SDL_Surface * surface, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
 {
-	double mu, result;
-	int n,k,kn,nn,nkn;
-	double blend,muk,munk;
+	int result;
+	SDL2_gfxTarget dst;
 
-	/* Sanity check bounds */
-	if (t<0.0) {
-		return(data[0]);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
-	if (t>=(double)ndata) {
-		return(data[ndata-1]);
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCirclesRGBA(&dst, cx, cy, count, rad, colors));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
+}
+
+/*!
+\brief Draw many anti-aliased circles of the same radius with blending, each in its own color, directly onto a surface.
+
+\param surface The surface to draw on.
+\param cx Array of the X coordinates of the centers of the circles.
+\param cy Array of the Y coordinates of the centers of the circles.
+\param count Number of circles.
+\param rad Radius in pixels of the circles.
+\param colors Array of the colors of the circles (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int aacirclesRGBA_Surface(SDL_Surface * surface, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors)
+{
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _aacirclesRGBA(&dst, cx, cy, count, rad, colors));
+	_gfxSurfaceTargetDone(&dst);
 
-	/* Adjust t to the range 0.0 to 1.0 */ 
-	mu=t/(double)ndata;
+	return result;
+}
 
-	/* Calculate interpolate */
-	n=ndata-1;
-	result=0.0;
-	muk = 1;
-	munk = pow(1-mu,(double)n);
-	for (k=0;k<=n;k++) {
-		nn = n;
-		kn = k;
-		nkn = n - k;
-		blend = muk * munk;
-		muk *= mu;
-		munk /= (1-mu);
-		while (nn >= 1) {
-			blend *= nn;
-			nn--;
-			if (kn > 1) {
-				blend /= (double)kn;
-				kn--;
-			}
-			if (nkn > 1) {
-				blend /= (double)nkn;
-				nkn--;
-			}
-		}
-		result += data[k] * blend;
+/*!
+\brief Draw many boxes (filled rectangles) of the same size with blending, each in its own color, directly onto a surface.
+
+\param surface The surface to draw on.
+\param x Array of the X coordinates of the upper left corners of the boxes.
+\param y Array of the Y coordinates of the upper left corners of the boxes.
+\param count Number of boxes.
+\param w Width in pixels of the boxes.
+\param h Height in pixels of the boxes.
+\param colors Array of the colors of the boxes (0xRRGGBBAA).
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int boxesRGBA_Surface(SDL_Surface * surface, const Sint16 * x, const Sint16 * y, int count, Sint16 w, Sint16 h, const Uint32 * colors)
+{
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxesRGBA(&dst, x, y, count, w, h, colors));
+	_gfxSurfaceTargetDone(&dst);
 
-	return (result);
+	return result;
 }
 
 /*!
-\brief Draw a bezier curve with alpha blending.
+\brief Draw box (filled rectangle) with a linear gradient between two colors directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the bezier curve.
-\param vy Vertex array containing Y coordinates of the points of the bezier curve.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param s Number of steps for the interpolation. Minimum number is 2.
-\param color The color value of the bezier curve to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
 
 \returns Returns 0 on success, -1 on failure.
 */
-int bezierColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint32 color)
+int boxGradientColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint32 color1, Uint32 color2)
 {
-	Uint8 *c = (Uint8 *)&color; 
-	return bezierRGBA(renderer, vx, vy, n, s, c[0], c[1], c[2], c[3]);
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return boxGradientRGBA_Surface(surface, x1, y1, x2, y2, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
 }
 
 /*!
-\brief Draw a bezier curve with alpha blending.
+\brief Draw box (filled rectangle) with a linear gradient between two colors directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param vx Vertex array containing X coordinates of the points of the bezier curve.
-\param vy Vertex array containing Y coordinates of the points of the bezier curve.
-\param n Number of points in the vertex array. Minimum number is 3.
-\param s Number of steps for the interpolation. Minimum number is 2.
-\param r The red value of the bezier curve to draw. 
-\param g The green value of the bezier curve to draw. 
-\param b The blue value of the bezier curve to draw. 
-\param a The alpha value of the bezier curve to draw.
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
 
 \returns Returns 0 on success, -1 on failure.
 */
-int bezierRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+int boxGradientRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
 	int result;
-	int i;
-	double *x, *y, t, stepsize;
-	Sint16 x1, y1, x2, y2;
+	SDL2_gfxTarget dst;
 
-	/*
-	* Sanity check 
-	*/
-	if (n < 3) {
-		return (-1);
-	}
-	if (s < 2) {
-		return (-1);
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _boxGradientRGBA(&dst, x1, y1, x2, y2, direction, r1, g1, b1, a1, r2, g2, b2, a2));
+	_gfxSurfaceTargetDone(&dst);
 
-	/*
-	* Variable setup 
-	*/
-	stepsize=(double)1.0/(double)s;
+	return result;
+}
 
-	/* Transfer vertices into float arrays */
-	if ((x=(double *)malloc(sizeof(double)*(n+1)))==NULL) {
-		return(-1);
-	}
-	if ((y=(double *)malloc(sizeof(double)*(n+1)))==NULL) {
-		free(x);
-		return(-1);
-	}    
-	for (i=0; i<n; i++) {
-		x[i]=(double)vx[i];
-		y[i]=(double)vy[i];
-	}      
-	x[n]=(double)vx[0];
-	y[n]=(double)vy[0];
+/*!
+\brief Draw rounded-corner box (filled rectangle) with a linear gradient between two colors directly onto a surface.
 
-	/*
-	* Set color 
-	*/
-	result = 0;
-	result |= SDL_SetRenderDrawBlendMode(renderer, (a == 255) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
-	result |= SDL_SetRenderDrawColor(renderer, r, g, b, a);
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
 
-	/*
-	* Draw 
-	*/
-	t=0.0;
-	x1=(Sint16)lrint(_evaluateBezier(x,n+1,t));
-	y1=(Sint16)lrint(_evaluateBezier(y,n+1,t));
-	for (i = 0; i <= (n*s); i++) {
-		t += stepsize;
-		x2=(Sint16)_evaluateBezier(x,n,t);
-		y2=(Sint16)_evaluateBezier(y,n,t);
-		result |= line(renderer, x1, y1, x2, y2);
-		x1 = x2;
-		y1 = y2;
-	}
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxGradientColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+	gfxGradientDirection direction, Uint32 color1, Uint32 color2)
+{
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return roundedBoxGradientRGBA_Surface(surface, x1, y1, x2, y2, rad, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
+}
+
+/*!
+\brief Draw rounded-corner box (filled rectangle) with a linear gradient between two colors directly onto a surface.
 
-	/* Clean up temporary array */
-	free(x);
-	free(y);
+\param surface The surface to draw on.
+\param x1 X coordinate of the first point (i.e. top right) of the box.
+\param y1 Y coordinate of the first point (i.e. top right) of the box.
+\param x2 X coordinate of the second point (i.e. bottom left) of the box.
+\param y2 Y coordinate of the second point (i.e. bottom left) of the box.
+\param rad The radius of the corner arcs of the box.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
 
-	return (result);
-}
+\returns Returns 0 on success, -1 on failure.
+*/
+int roundedBoxGradientRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+	gfxGradientDirection direction, Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	int result;
+	SDL2_gfxTarget dst;
 
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_RECTANGLE, _roundedBoxGradientRGBA(&dst, x1, y1, x2, y2, rad, direction, r1, g1, b1, a1, r2, g2, b2, a2));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
+}
 
 /*!
-\brief Draw a thick line with alpha blending.
+\brief Draw filled circle with a radial gradient from the center to the edge directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the line.
-\param y1 Y coordinate of the first point of the line.
-\param x2 X coordinate of the second point of the line.
-\param y2 Y coordinate of the second point of the line.
-\param width Width of the line in pixels. Must be >0.
-\param color The color value of the line to draw (0xRRGGBBAA). 
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param inner The color of the center (0xRRGGBBAA).
+\param outer The color of the edge (0xRRGGBBAA).
 
 \returns Returns 0 on success, -1 on failure.
 */
-int thickLineColor(SDL_Renderer *renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint32 color)
-{	
-	Uint8 *c = (Uint8 *)&color; 
-	return thickLineRGBA(renderer, x1, y1, x2, y2, width, c[0], c[1], c[2], c[3]);
+int filledCircleRadialGradientColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 inner, Uint32 outer)
+{
+	Uint8 *c1 = (Uint8 *)&inner;
+	Uint8 *c2 = (Uint8 *)&outer;
+	return filledCircleRadialGradientRGBA_Surface(surface, x, y, rad, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
 }
 
 /*!
-\brief Draw a thick line with alpha blending.
+\brief Draw filled circle with a radial gradient from the center to the edge directly onto a surface.
 
-\param renderer The renderer to draw on.
-\param x1 X coordinate of the first point of the line.
-\param y1 Y coordinate of the first point of the line.
-\param x2 X coordinate of the second point of the line.
-\param y2 Y coordinate of the second point of the line.
-\param width Width of the line in pixels. Must be >0.
-\param r The red value of the character to draw. 
-\param g The green value of the character to draw. 
-\param b The blue value of the character to draw. 
-\param a The alpha value of the character to draw.
+\param surface The surface to draw on.
+\param x X coordinate of the center of the filled circle.
+\param y Y coordinate of the center of the filled circle.
+\param rad Radius in pixels of the filled circle.
+\param r1 The red value of the center.
+\param g1 The green value of the center.
+\param b1 The blue value of the center.
+\param a1 The alpha value of the center.
+\param r2 The red value of the edge.
+\param g2 The green value of the edge.
+\param b2 The blue value of the edge.
+\param a2 The alpha value of the edge.
 
 \returns Returns 0 on success, -1 on failure.
-*/	
-int thickLineRGBA(SDL_Renderer *renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+*/
+int filledCircleRadialGradientRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
 {
-	int wh;
-	double dx, dy, dx1, dy1, dx2, dy2;
-	double l, wl2, nx, ny, ang, adj;
-	Sint16 px[4], py[4];
+	int result;
+	SDL2_gfxTarget dst;
 
-	if (renderer == NULL) {
+	if (_gfxSurfaceTarget(&dst, surface)) {
 		return -1;
 	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_CIRCLE, _filledCircleRadialGradientRGBA(&dst, x, y, rad, r1, g1, b1, a1, r2, g2, b2, a2));
+	_gfxSurfaceTargetDone(&dst);
 
-	if (width < 1) {
-		return -1;
-	}
+	return result;
+}
 
-	/* Special case: thick "point" */
-	if ((x1 == x2) && (y1 == y2)) {
-		wh = width / 2;
-		return boxRGBA(renderer, x1 - wh, y1 - wh, x2 + width, y2 + width, r, g, b, a);		
-	}
+/*!
+\brief Draw filled polygon with a linear gradient between two colors directly onto a surface.
 
-	/* Special case: width == 1 */
-	if (width == 1) {
-		return lineRGBA(renderer, x1, y1, x2, y2, r, g, b, a);		
-	}
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param color1 The color of the top row or left column (0xRRGGBBAA).
+\param color2 The color of the bottom row or right column (0xRRGGBBAA).
 
-	/* Calculate offsets for sides */
-	dx = (double)(x2 - x1);
-	dy = (double)(y2 - y1);
-	l = SDL_sqrt(dx*dx + dy*dy);
-	ang = SDL_atan2(dx, dy);
-	adj = 0.1 + 0.9 * SDL_fabs(SDL_cos(2.0 * ang));
-	wl2 = ((double)width - adj)/(2.0 * l);
-	nx = dx * wl2;
-	ny = dy * wl2;
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonGradientColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint32 color1, Uint32 color2)
+{
+	Uint8 *c1 = (Uint8 *)&color1;
+	Uint8 *c2 = (Uint8 *)&color2;
+	return filledPolygonGradientRGBA_Surface(surface, vx, vy, n, direction, c1[0], c1[1], c1[2], c1[3], c2[0], c2[1], c2[2], c2[3]);
+}
 
-	/* Build polygon */
-	dx1 = (double)x1;
-	dy1 = (double)y1;
-	dx2 = (double)x2;
-	dy2 = (double)y2;
-	px[0] = (Sint16)(dx1 + ny);
-	px[1] = (Sint16)(dx1 - ny);
-	px[2] = (Sint16)(dx2 - ny);
-	px[3] = (Sint16)(dx2 + ny);
-	py[0] = (Sint16)(dy1 - nx);
-	py[1] = (Sint16)(dy1 + nx);
-	py[2] = (Sint16)(dy2 + nx);
-	py[3] = (Sint16)(dy2 - nx);
+/*!
+\brief Draw filled polygon with a linear gradient between two colors directly onto a surface.
 
-	/* Draw polygon */
-	return filledPolygonRGBA(renderer, px, py, 4, r, g, b, a);
+\param surface The surface to draw on.
+\param vx Vertex array containing X coordinates of the points of the filled polygon.
+\param vy Vertex array containing Y coordinates of the points of the filled polygon.
+\param n Number of points in the vertex array. Minimum number is 3.
+\param direction GFX_GRADIENT_VERTICAL from the top to the bottom row or GFX_GRADIENT_HORIZONTAL from the left to the right column.
+\param r1 The red value of the top row or left column.
+\param g1 The green value of the top row or left column.
+\param b1 The blue value of the top row or left column.
+\param a1 The alpha value of the top row or left column.
+\param r2 The red value of the bottom row or right column.
+\param g2 The green value of the bottom row or right column.
+\param b2 The blue value of the bottom row or right column.
+\param a2 The alpha value of the bottom row or right column.
+
+\returns Returns 0 on success, -1 on failure.
+*/
+int filledPolygonGradientRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2)
+{
+	int result;
+	SDL2_gfxTarget dst;
+
+	if (_gfxSurfaceTarget(&dst, surface)) {
+		return -1;
+	}
+	result = SDL2_GFX_STATS_CALL(&dst, GFX_STATS_POLYGON, _filledPolygonGradientRGBA(&dst, vx, vy, n, direction, r1, g1, b1, a1, r2, g2, b2, a2));
+	_gfxSurfaceTargetDone(&dst);
+
+	return result;
 }
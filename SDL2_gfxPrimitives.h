@@ -123,6 +123,27 @@ extern "C" {
 	SDL2_GFXPRIMITIVES_SCOPE int thickLineRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, 
 		Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
+	/* Thick Polyline */
+
+	/*! \brief Shape of the corners between the segments of a thick polyline. */
+	typedef enum {
+		GFX_JOIN_MITER,
+		GFX_JOIN_ROUND,
+		GFX_JOIN_BEVEL
+	} gfxLineJoin;
+
+	/*! \brief Shape of the ends of a thick polyline. */
+	typedef enum {
+		GFX_CAP_BUTT,
+		GFX_CAP_ROUND,
+		GFX_CAP_SQUARE
+	} gfxLineCap;
+
+	SDL2_GFXPRIMITIVES_SCOPE int thickPolylineColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n,
+		Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int thickPolylineRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n,
+		Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
 	/* Circle */
 
 	SDL2_GFXPRIMITIVES_SCOPE int circleColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad, Uint32 color);
@@ -214,15 +235,32 @@ extern "C" {
 	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx,
 		const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
+	/* AA-Filled Polygon */
+
+	SDL2_GFXPRIMITIVES_SCOPE int aafilledPolygonColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aafilledPolygonRGBA(SDL_Renderer * renderer, const Sint16 * vx,
+		const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
 	/* Textured Polygon */
 
 	SDL2_GFXPRIMITIVES_SCOPE int texturedPolygon(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, SDL_Surface * texture,int texture_dx,int texture_dy);
+	SDL2_GFXPRIMITIVES_SCOPE int texturedPolygonTexture(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, SDL_Texture * texture, int texture_dx, int texture_dy);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxPrimitivesSetTextureCaching(int enable);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxInvalidateTexture(SDL_Surface * surface);
 
 	/* Bezier */
 
 	SDL2_GFXPRIMITIVES_SCOPE int bezierColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint32 color);
 	SDL2_GFXPRIMITIVES_SCOPE int bezierRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy,
 		int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierCubicColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1,
+		Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierCubicRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1,
+		Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierQuadColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy,
+		Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierQuadRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy,
+		Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
 	/* Characters/Strings */
 
@@ -233,6 +271,223 @@ extern "C" {
 	SDL2_GFXPRIMITIVES_SCOPE int stringColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint32 color);
 	SDL2_GFXPRIMITIVES_SCOPE int stringRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
+	/* Fonts */
+
+	typedef struct gfxFont gfxFont;
+
+	SDL2_GFXPRIMITIVES_SCOPE gfxFont *gfxCreateFont(const void *fontdata, Uint32 cw, Uint32 ch);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxDestroyFont(gfxFont * font);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxSetFontRotation(gfxFont * font, Uint32 rotation);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxFontCharacterColor(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, char c, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxFontCharacterRGBA(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxFontStringColor(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, const char *s, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxFontStringRGBA(SDL_Renderer * renderer, gfxFont * font, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxReleaseRenderer(SDL_Renderer * renderer);
+
+	/* Batching */
+
+	typedef struct gfxBatch gfxBatch;
+
+	SDL2_GFXPRIMITIVES_SCOPE gfxBatch *gfxCreateBatch(SDL_Renderer * renderer);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxBeginBatch(gfxBatch * batch);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxFlushBatch(gfxBatch * batch);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxEndBatch(gfxBatch * batch);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxDestroyBatch(gfxBatch * batch);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxPrimitivesSetAABatching(int enable);
+
+	/* Display lists */
+
+	typedef struct gfxDisplayList gfxDisplayList;
+
+	SDL2_GFXPRIMITIVES_SCOPE gfxDisplayList *gfxCreateDisplayList(SDL_Renderer * renderer);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxBeginDisplayList(gfxDisplayList * list);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxEndDisplayList(gfxDisplayList * list);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxDrawDisplayList(gfxDisplayList * list, int x, int y);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxDestroyDisplayList(gfxDisplayList * list);
+
+	/* Contexts */
+
+	typedef struct gfxContext gfxContext;
+
+	SDL2_GFXPRIMITIVES_SCOPE gfxContext *gfxCreateContext(void);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxDestroyContext(gfxContext * context);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxSetContext(gfxContext * context);
+	SDL2_GFXPRIMITIVES_SCOPE gfxContext *gfxGetContext(void);
+
+	/* Renderer state */
+
+	SDL2_GFXPRIMITIVES_SCOPE void gfxPrimitivesSetStateShadowing(int enable);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxInvalidateRendererState(SDL_Renderer * renderer);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxGetRendererStateStats(SDL_Renderer * renderer, Uint32 * issued, Uint32 * elided);
+
+	/* Statistics */
+
+	/*! \brief Families of primitives counted by gfxPrimitivesGetStats. */
+	typedef enum {
+		GFX_STATS_PIXEL,
+		GFX_STATS_LINE,
+		GFX_STATS_AALINE,
+		GFX_STATS_RECTANGLE,
+		GFX_STATS_CIRCLE,
+		GFX_STATS_ELLIPSE,
+		GFX_STATS_POLYGON,
+		GFX_STATS_TEXTURED_POLYGON,
+		GFX_STATS_TEXT,
+		GFX_STATS_BEZIER,
+		GFX_STATS_BATCH,
+		GFX_STATS_FAMILIES
+	} gfxStatsFamily;
+
+	/*! \brief Counters of one family of primitives. */
+	typedef struct {
+		Uint32 calls;		/*!< primitives drawn */
+		Uint32 renderCalls;	/*!< SDL_Render... drawing calls issued (draw color and blend mode calls are counted by gfxGetRendererStateStats) */
+		Uint32 pixels;		/*!< single pixels generated */
+		Uint32 spans;		/*!< lines, spans and rectangles generated */
+		Uint32 triangles;	/*!< triangles rendered as geometry */
+		Uint64 bytesAllocated;	/*!< temporary and cache memory allocated */
+		Uint64 time;		/*!< time spent in SDL_GetPerformanceCounter() ticks */
+	} gfxPrimitivesStats;
+
+	SDL2_GFXPRIMITIVES_SCOPE int gfxPrimitivesGetStats(gfxPrimitivesStats * stats);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxPrimitivesResetStats(void);
+
+	/* Damage tracking */
+
+	SDL2_GFXPRIMITIVES_SCOPE void gfxSetDamageTracking(int maxRects);
+	SDL2_GFXPRIMITIVES_SCOPE int gfxGetDamageRects(SDL_Rect * rects, int maxRects);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxClearDamage(void);
+
+	/* Shape cache */
+
+	SDL2_GFXPRIMITIVES_SCOPE void gfxSetShapeCacheSize(int size);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxGetShapeCacheStats(int *size, int *count, Uint32 *hits, Uint32 *misses);
+	SDL2_GFXPRIMITIVES_SCOPE void gfxClearShapeCache(void);
+
+	/* Instances */
+
+	SDL2_GFXPRIMITIVES_SCOPE int filledCirclesRGBA(SDL_Renderer * renderer, const Sint16 * cx, const Sint16 * cy, int count,
+		Sint16 rad, const Uint32 * colors);
+	SDL2_GFXPRIMITIVES_SCOPE int aacirclesRGBA(SDL_Renderer * renderer, const Sint16 * cx, const Sint16 * cy, int count,
+		Sint16 rad, const Uint32 * colors);
+	SDL2_GFXPRIMITIVES_SCOPE int boxesRGBA(SDL_Renderer * renderer, const Sint16 * x, const Sint16 * y, int count,
+		Sint16 w, Sint16 h, const Uint32 * colors);
+
+	/* Gradients */
+
+	/*! \brief Direction of a linear gradient. */
+	typedef enum {
+		GFX_GRADIENT_VERTICAL,
+		GFX_GRADIENT_HORIZONTAL
+	} gfxGradientDirection;
+
+	SDL2_GFXPRIMITIVES_SCOPE int boxGradientColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2,
+		gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int boxGradientRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2,
+		gfxGradientDirection direction, Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxGradientColor(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+		gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxGradientRGBA(SDL_Renderer * renderer, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad,
+		gfxGradientDirection direction, Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleRadialGradientColor(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
+		Uint32 inner, Uint32 outer);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleRadialGradientRGBA(SDL_Renderer * renderer, Sint16 x, Sint16 y, Sint16 rad,
+		Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonGradientColor(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n,
+		gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonGradientRGBA(SDL_Renderer * renderer, const Sint16 * vx, const Sint16 * vy, int n,
+		gfxGradientDirection direction, Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+
+	/* Surface drawing */
+
+	SDL2_GFXPRIMITIVES_SCOPE int pixelColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int pixelRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int hlineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 x2, Sint16 y, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int hlineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 x2, Sint16 y, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int vlineColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y1, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int vlineRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y1, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int rectangleColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int rectangleRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedRectangleColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedRectangleRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int boxColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int boxRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2,
+	Sint16 y2, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int lineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int lineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aalineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aalineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int thickLineColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int thickLineRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Uint8 width, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int thickPolylineColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int thickPolylineRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 width, gfxLineJoin join, gfxLineCap cap, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int circleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int circleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int arcColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int arcRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aacircleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aacircleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int ellipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int ellipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aaellipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aaellipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledEllipseColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int filledEllipseRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int pieColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, 
+	Sint16 start, Sint16 end, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int pieRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPieColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Sint16 start, Sint16 end, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPieRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Sint16 start, Sint16 end, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int trigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int trigonRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aatrigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aatrigonRGBA_Surface(SDL_Surface * surface,  Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledTrigonColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int filledTrigonRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 x3, Sint16 y3,
+	Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int polygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int polygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aapolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aapolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int aafilledPolygonColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int aafilledPolygonRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int texturedPolygon_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, SDL_Surface *texture, int texture_dx, int texture_dy);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, int s, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierCubicColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierCubicRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx1, Sint16 cy1, Sint16 cx2, Sint16 cy2, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierQuadColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int bezierQuadRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 cx, Sint16 cy, Sint16 x2, Sint16 y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int characterColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, char c, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int characterRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, char c, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int stringColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, const char *s, Uint32 color);
+	SDL2_GFXPRIMITIVES_SCOPE int stringRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, const char *s, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCirclesRGBA_Surface(SDL_Surface * surface, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors);
+	SDL2_GFXPRIMITIVES_SCOPE int aacirclesRGBA_Surface(SDL_Surface * surface, const Sint16 * cx, const Sint16 * cy, int count, Sint16 rad, const Uint32 * colors);
+	SDL2_GFXPRIMITIVES_SCOPE int boxesRGBA_Surface(SDL_Surface * surface, const Sint16 * x, const Sint16 * y, int count, Sint16 w, Sint16 h, const Uint32 * colors);
+	SDL2_GFXPRIMITIVES_SCOPE int boxGradientColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int boxGradientRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxGradientColor_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int roundedBoxGradientRGBA_Surface(SDL_Surface * surface, Sint16 x1, Sint16 y1, Sint16 x2, Sint16 y2, Sint16 rad, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleRadialGradientColor_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad, Uint32 inner, Uint32 outer);
+	SDL2_GFXPRIMITIVES_SCOPE int filledCircleRadialGradientRGBA_Surface(SDL_Surface * surface, Sint16 x, Sint16 y, Sint16 rad,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonGradientColor_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction, Uint32 color1, Uint32 color2);
+	SDL2_GFXPRIMITIVES_SCOPE int filledPolygonGradientRGBA_Surface(SDL_Surface * surface, const Sint16 * vx, const Sint16 * vy, int n, gfxGradientDirection direction,
+	Uint8 r1, Uint8 g1, Uint8 b1, Uint8 a1, Uint8 r2, Uint8 g2, Uint8 b2, Uint8 a2);
+
 	/* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
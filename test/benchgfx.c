@@ -0,0 +1,653 @@
+/*
+  Copyright (C) 2012-2014 Andreas Schiffler
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/*
+  Headless benchmark of the SDL2_gfx primitives.
+
+  Every primitive is drawn onto an offscreen surface, either through a software
+  renderer created on the surface or with the ..._Surface functions, in several
+  size classes with and without alpha blending. No window or display is needed.
+  The results are printed as CSV or JSON so runs of different releases can be
+  compared.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#include "SDL2_gfxPrimitives.h"
+
+/* Size of the offscreen surface */
+#define WIDTH	1024
+#define HEIGHT	768
+
+/* Number of precomputed positions and colors cycled through by the benchmarks */
+#define NUM_POSITIONS	256
+
+/* Number of vertices of the benchmarked polygons */
+#define NUM_VERTICES	8
+
+/* Number of instances drawn per instanced call */
+#define NUM_INSTANCES	64
+
+/* Number of primitives drawn between time checks */
+#define OPS_PER_CHECK	16
+
+/* ====== Benchmark state */
+
+/*! \brief Where the benchmarked primitives are drawn. */
+typedef struct {
+	SDL_Surface *surface;
+	SDL_Renderer *renderer;
+	int useSurface;
+	SDL_Surface *texture;
+} BenchTarget;
+
+/*! \brief A benchmarked primitive: draws primitive number i of the given size class. */
+typedef int (*BenchFunc)(BenchTarget *t, int i, int size, Uint8 a);
+
+/*! \brief Name and function of a benchmarked primitive. */
+typedef struct {
+	const char *name;
+	BenchFunc func;
+} BenchCase;
+
+/*! \brief Name and size in pixels of a size class. */
+typedef struct {
+	const char *name;
+	int size;
+} BenchSize;
+
+static const BenchSize sizes[] = {
+	{ "small", 8 },
+	{ "medium", 64 },
+	{ "large", 256 }
+};
+#define NUM_SIZES ((int)(sizeof(sizes) / sizeof(sizes[0])))
+
+/* Centers of the primitives, per size class, so every primitive is fully visible */
+static Sint16 px[NUM_SIZES][NUM_POSITIONS], py[NUM_SIZES][NUM_POSITIONS];
+
+/* Colors of the primitives */
+static Uint8 cr[NUM_POSITIONS], cg[NUM_POSITIONS], cb[NUM_POSITIONS];
+
+/* Index of the size class currently benchmarked */
+static int sizeIndex;
+
+/* Vertex buffers */
+static Sint16 vx[NUM_INSTANCES], vy[NUM_INSTANCES];
+static Uint32 colors[NUM_INSTANCES];
+
+/* Strings drawn per size class */
+static const char *texts[NUM_SIZES] = {
+	"gfx",
+	"SDL2_gfx bench!!",
+	"The quick brown fox jumps over the lazy dog. 0123456789 !?#$%&*+"
+};
+
+/* Dispatch to the renderer or the surface variant of a primitive */
+#define DRAW(fn, ...) ((t->useSurface) ? fn##_Surface(t->surface, __VA_ARGS__) : fn(t->renderer, __VA_ARGS__))
+
+/* Position and color of primitive i */
+#define X(i) px[sizeIndex][(i) % NUM_POSITIONS]
+#define Y(i) py[sizeIndex][(i) % NUM_POSITIONS]
+#define RGB(i) cr[(i) % NUM_POSITIONS], cg[(i) % NUM_POSITIONS], cb[(i) % NUM_POSITIONS]
+
+/* ====== Primitives */
+
+static int benchPixel(BenchTarget *t, int i, int size, Uint8 a)
+{
+	(void)size;
+	return DRAW(pixelRGBA, X(i), Y(i), RGB(i), a);
+}
+
+static int benchHline(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(hlineRGBA, X(i) - size / 2, X(i) + size / 2, Y(i), RGB(i), a);
+}
+
+static int benchVline(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(vlineRGBA, X(i), Y(i) - size / 2, Y(i) + size / 2, RGB(i), a);
+}
+
+static int benchLine(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(lineRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, RGB(i), a);
+}
+
+static int benchAaline(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(aalineRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, RGB(i), a);
+}
+
+static int benchThickLine(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(thickLineRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, (Uint8)(2 + size / 16), RGB(i), a);
+}
+
+static int benchThickPolyline(BenchTarget *t, int i, int size, Uint8 a)
+{
+	vx[0] = X(i) - size / 2;
+	vy[0] = Y(i) + size / 3;
+	vx[1] = X(i) - size / 6;
+	vy[1] = Y(i) - size / 3;
+	vx[2] = X(i) + size / 6;
+	vy[2] = Y(i) + size / 3;
+	vx[3] = X(i) + size / 2;
+	vy[3] = Y(i) - size / 3;
+	return DRAW(thickPolylineRGBA, vx, vy, 4, (Uint8)(2 + size / 16), GFX_JOIN_MITER, GFX_CAP_BUTT, RGB(i), a);
+}
+
+static int benchRectangle(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(rectangleRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, RGB(i), a);
+}
+
+static int benchRoundedRectangle(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(roundedRectangleRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, size / 8, RGB(i), a);
+}
+
+static int benchBox(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(boxRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, RGB(i), a);
+}
+
+static int benchRoundedBox(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(roundedBoxRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, size / 8, RGB(i), a);
+}
+
+static int benchCircle(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(circleRGBA, X(i), Y(i), size / 2, RGB(i), a);
+}
+
+static int benchAacircle(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(aacircleRGBA, X(i), Y(i), size / 2, RGB(i), a);
+}
+
+static int benchFilledCircle(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(filledCircleRGBA, X(i), Y(i), size / 2, RGB(i), a);
+}
+
+static int benchArc(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(arcRGBA, X(i), Y(i), size / 2, (Sint16)(i % 360), (Sint16)(i % 360 + 200), RGB(i), a);
+}
+
+static int benchPie(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(pieRGBA, X(i), Y(i), size / 2, (Sint16)(i % 360), (Sint16)(i % 360 + 200), RGB(i), a);
+}
+
+static int benchFilledPie(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(filledPieRGBA, X(i), Y(i), size / 2, (Sint16)(i % 360), (Sint16)(i % 360 + 200), RGB(i), a);
+}
+
+static int benchEllipse(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(ellipseRGBA, X(i), Y(i), size / 2, size / 3, RGB(i), a);
+}
+
+static int benchAaellipse(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(aaellipseRGBA, X(i), Y(i), size / 2, size / 3, RGB(i), a);
+}
+
+static int benchFilledEllipse(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(filledEllipseRGBA, X(i), Y(i), size / 2, size / 3, RGB(i), a);
+}
+
+static int benchTrigon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(trigonRGBA, X(i) - size / 2, Y(i) + size / 2, X(i) + size / 2, Y(i) + size / 3, X(i), Y(i) - size / 2, RGB(i), a);
+}
+
+static int benchAatrigon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(aatrigonRGBA, X(i) - size / 2, Y(i) + size / 2, X(i) + size / 2, Y(i) + size / 3, X(i), Y(i) - size / 2, RGB(i), a);
+}
+
+static int benchFilledTrigon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(filledTrigonRGBA, X(i) - size / 2, Y(i) + size / 2, X(i) + size / 2, Y(i) + size / 3, X(i), Y(i) - size / 2, RGB(i), a);
+}
+
+/*!
+\brief Sets up a star shaped (concave) polygon of the given size around primitive i.
+*/
+static void benchStar(int i, int size)
+{
+	static const int sx[NUM_VERTICES] = { 0, 14, 50, 20, 30, 0, -30, -20 };
+	static const int sy[NUM_VERTICES] = { -50, -16, -16, 8, 46, 22, 46, 8 };
+	int k;
+
+	for (k = 0; k < NUM_VERTICES; k++) {
+		vx[k] = X(i) + sx[k] * size / 100;
+		vy[k] = Y(i) + sy[k] * size / 100;
+	}
+}
+
+static int benchPolygon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(polygonRGBA, vx, vy, NUM_VERTICES, RGB(i), a);
+}
+
+static int benchAapolygon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(aapolygonRGBA, vx, vy, NUM_VERTICES, RGB(i), a);
+}
+
+static int benchFilledPolygon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(filledPolygonRGBA, vx, vy, NUM_VERTICES, RGB(i), a);
+}
+
+static int benchAafilledPolygon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(aafilledPolygonRGBA, vx, vy, NUM_VERTICES, RGB(i), a);
+}
+
+static int benchTexturedPolygon(BenchTarget *t, int i, int size, Uint8 a)
+{
+	(void)a;
+	benchStar(i, size);
+	return DRAW(texturedPolygon, vx, vy, NUM_VERTICES, t->texture, i % 32, i % 32);
+}
+
+static int benchBezier(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(bezierRGBA, vx, vy, 4, 2 + size / 4, RGB(i), a);
+}
+
+static int benchString(BenchTarget *t, int i, int size, Uint8 a)
+{
+	(void)size;
+	return DRAW(stringRGBA, X(i) - (Sint16)(4 * strlen(texts[sizeIndex])), Y(i) - 4, texts[sizeIndex], RGB(i), a);
+}
+
+/*!
+\brief Sets up the instances drawn by one instanced call.
+*/
+static void benchInstances(int i, Uint8 a)
+{
+	int k;
+
+	for (k = 0; k < NUM_INSTANCES; k++) {
+		vx[k] = X(i + k);
+		vy[k] = Y(i + k);
+		colors[k] = ((Uint32)cr[(i + k) % NUM_POSITIONS] << 24) | ((Uint32)cg[(i + k) % NUM_POSITIONS] << 16) |
+			((Uint32)cb[(i + k) % NUM_POSITIONS] << 8) | a;
+	}
+}
+
+static int benchFilledCircles(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchInstances(i, a);
+	return DRAW(filledCirclesRGBA, vx, vy, NUM_INSTANCES, size / 2, colors);
+}
+
+static int benchBoxes(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchInstances(i, a);
+	return DRAW(boxesRGBA, vx, vy, NUM_INSTANCES, size, size, colors);
+}
+
+static int benchBoxGradient(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(boxGradientRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3,
+		(gfxGradientDirection)(i % 2), RGB(i), a, RGB(i + 1), a);
+}
+
+static int benchRoundedBoxGradient(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(roundedBoxGradientRGBA, X(i) - size / 2, Y(i) - size / 3, X(i) + size / 2, Y(i) + size / 3, size / 8,
+		(gfxGradientDirection)(i % 2), RGB(i), a, RGB(i + 1), a);
+}
+
+static int benchRadialGradient(BenchTarget *t, int i, int size, Uint8 a)
+{
+	return DRAW(filledCircleRadialGradientRGBA, X(i), Y(i), size / 2, RGB(i), a, RGB(i + 1), a);
+}
+
+static int benchFilledPolygonGradient(BenchTarget *t, int i, int size, Uint8 a)
+{
+	benchStar(i, size);
+	return DRAW(filledPolygonGradientRGBA, vx, vy, NUM_VERTICES, (gfxGradientDirection)(i % 2), RGB(i), a, RGB(i + 1), a);
+}
+
+static const BenchCase cases[] = {
+	{ "pixel", benchPixel },
+	{ "hline", benchHline },
+	{ "vline", benchVline },
+	{ "line", benchLine },
+	{ "aaline", benchAaline },
+	{ "thickLine", benchThickLine },
+	{ "thickPolyline", benchThickPolyline },
+	{ "rectangle", benchRectangle },
+	{ "roundedRectangle", benchRoundedRectangle },
+	{ "box", benchBox },
+	{ "roundedBox", benchRoundedBox },
+	{ "circle", benchCircle },
+	{ "aacircle", benchAacircle },
+	{ "filledCircle", benchFilledCircle },
+	{ "arc", benchArc },
+	{ "pie", benchPie },
+	{ "filledPie", benchFilledPie },
+	{ "ellipse", benchEllipse },
+	{ "aaellipse", benchAaellipse },
+	{ "filledEllipse", benchFilledEllipse },
+	{ "trigon", benchTrigon },
+	{ "aatrigon", benchAatrigon },
+	{ "filledTrigon", benchFilledTrigon },
+	{ "polygon", benchPolygon },
+	{ "aapolygon", benchAapolygon },
+	{ "filledPolygon", benchFilledPolygon },
+	{ "aafilledPolygon", benchAafilledPolygon },
+	{ "texturedPolygon", benchTexturedPolygon },
+	{ "bezier", benchBezier },
+	{ "string", benchString },
+	{ "filledCircles", benchFilledCircles },
+	{ "boxes", benchBoxes },
+	{ "boxGradient", benchBoxGradient },
+	{ "roundedBoxGradient", benchRoundedBoxGradient },
+	{ "radialGradient", benchRadialGradient },
+	{ "filledPolygonGradient", benchFilledPolygonGradient }
+};
+#define NUM_CASES ((int)(sizeof(cases) / sizeof(cases[0])))
+
+/* ====== Measurement */
+
+/*! \brief The result of one benchmark run. */
+typedef struct {
+	const char *name;
+	const char *target;
+	const char *size;
+	int alpha;
+	Uint64 ops;
+	double seconds;
+	double pixelsPerOp;
+} BenchResult;
+
+/*!
+\brief Waits until the renderer executed all queued drawing commands.
+*/
+static void benchFlush(BenchTarget *t)
+{
+#if SDL_VERSION_ATLEAST(2,0,10)
+	if (!t->useSurface) {
+		SDL_RenderFlush(t->renderer);
+	}
+#else
+	(void)t;
+#endif
+}
+
+/*!
+\brief Clears the surface to transparent black.
+*/
+static void benchClear(BenchTarget *t)
+{
+	SDL_FillRect(t->surface, NULL, 0);
+}
+
+/*!
+\brief Counts the pixels written by the first primitives of a benchmark.
+
+\returns Returns the average number of pixels written per primitive.
+*/
+static double benchCountPixels(BenchTarget *t, const BenchCase *bc, int size)
+{
+	Uint32 *pixels;
+	int i, x, y;
+	Uint64 count = 0;
+
+	for (i = 0; i < OPS_PER_CHECK; i++) {
+		benchClear(t);
+		bc->func(t, i, size, 255);
+		benchFlush(t);
+		if (SDL_LockSurface(t->surface) < 0) {
+			return 0.0;
+		}
+		for (y = 0; y < t->surface->h; y++) {
+			pixels = (Uint32 *)((Uint8 *)t->surface->pixels + y * t->surface->pitch);
+			for (x = 0; x < t->surface->w; x++) {
+				count += (pixels[x] != 0);
+			}
+		}
+		SDL_UnlockSurface(t->surface);
+	}
+
+	return (double)count / OPS_PER_CHECK;
+}
+
+/*!
+\brief Draws a primitive repeatedly for at least the given time.
+*/
+static void benchRun(BenchTarget *t, const BenchCase *bc, int size, Uint8 a, Uint64 minTicks, BenchResult *result)
+{
+	Uint64 start, elapsed, ops;
+	int i;
+
+	result->pixelsPerOp = benchCountPixels(t, bc, size);
+
+	/* Warm up caches */
+	benchClear(t);
+	for (i = 0; i < OPS_PER_CHECK; i++) {
+		bc->func(t, i, size, a);
+	}
+	benchFlush(t);
+
+	ops = 0;
+	start = SDL_GetPerformanceCounter();
+	do {
+		for (i = 0; i < OPS_PER_CHECK; i++) {
+			bc->func(t, (int)(ops + i), size, a);
+		}
+		benchFlush(t);
+		ops += OPS_PER_CHECK;
+		elapsed = SDL_GetPerformanceCounter() - start;
+	} while (elapsed < minTicks);
+
+	result->ops = ops;
+	result->seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+}
+
+/* ====== Output */
+
+static void printHeader(FILE *out, int json)
+{
+	if (json) {
+		fprintf(out, "{\n  \"version\": \"%i.%i.%i\",\n  \"platform\": \"%s\",\n  \"width\": %i,\n  \"height\": %i,\n  \"results\": [\n",
+			SDL2_GFXPRIMITIVES_MAJOR, SDL2_GFXPRIMITIVES_MINOR, SDL2_GFXPRIMITIVES_MICRO, SDL_GetPlatform(), WIDTH, HEIGHT);
+	} else {
+		fprintf(out, "primitive,target,size,alpha,ops,seconds,ops_per_sec,ns_per_op,pixels_per_op,pixels_per_sec\n");
+	}
+}
+
+static void printResult(FILE *out, int json, int first, const BenchResult *r)
+{
+	double opsPerSec = (r->seconds > 0.0) ? (double)r->ops / r->seconds : 0.0;
+	double nsPerOp = (r->ops > 0) ? r->seconds * 1e9 / (double)r->ops : 0.0;
+
+	if (json) {
+		fprintf(out, "%s    { \"primitive\": \"%s\", \"target\": \"%s\", \"size\": \"%s\", \"alpha\": %s, "
+			"\"ops\": %.0f, \"seconds\": %.6f, \"ops_per_sec\": %.1f, \"ns_per_op\": %.1f, "
+			"\"pixels_per_op\": %.1f, \"pixels_per_sec\": %.0f }",
+			(first) ? "" : ",\n", r->name, r->target, r->size, (r->alpha) ? "true" : "false",
+			(double)r->ops, r->seconds, opsPerSec, nsPerOp, r->pixelsPerOp, opsPerSec * r->pixelsPerOp);
+	} else {
+		fprintf(out, "%s,%s,%s,%i,%.0f,%.6f,%.1f,%.1f,%.1f,%.0f\n",
+			r->name, r->target, r->size, r->alpha,
+			(double)r->ops, r->seconds, opsPerSec, nsPerOp, r->pixelsPerOp, opsPerSec * r->pixelsPerOp);
+	}
+	fflush(out);
+}
+
+static void printFooter(FILE *out, int json)
+{
+	if (json) {
+		fprintf(out, "\n  ]\n}\n");
+	}
+}
+
+/* ====== Main */
+
+static void usage(const char *program)
+{
+	SDL_Log("Usage: %s [--format csv|json] [--time ms] [--target renderer|surface|all] [--filter name] [--output file]", program);
+}
+
+int main(int argc, char *argv[])
+{
+	BenchTarget target;
+	BenchResult result;
+	FILE *out = stdout;
+	const char *output = NULL;
+	const char *filter = NULL;
+	int json = 0;
+	int timeMs = 250;
+	int targets = 3;
+	int i, c, s, t, a, k, first;
+	Uint64 minTicks;
+
+	for (i = 1; i < argc; i++) {
+		if ((SDL_strcasecmp(argv[i], "--format") == 0) && (i + 1 < argc)) {
+			json = (SDL_strcasecmp(argv[++i], "json") == 0);
+		} else if ((SDL_strcasecmp(argv[i], "--time") == 0) && (i + 1 < argc)) {
+			timeMs = SDL_atoi(argv[++i]);
+			if (timeMs < 1) {
+				timeMs = 1;
+			}
+		} else if ((SDL_strcasecmp(argv[i], "--target") == 0) && (i + 1 < argc)) {
+			i++;
+			if (SDL_strcasecmp(argv[i], "renderer") == 0) {
+				targets = 1;
+			} else if (SDL_strcasecmp(argv[i], "surface") == 0) {
+				targets = 2;
+			} else {
+				targets = 3;
+			}
+		} else if ((SDL_strcasecmp(argv[i], "--filter") == 0) && (i + 1 < argc)) {
+			filter = argv[++i];
+		} else if ((SDL_strcasecmp(argv[i], "--output") == 0) && (i + 1 < argc)) {
+			output = argv[++i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	/* No display is needed; make sure no video driver is opened either */
+	if (SDL_getenv("SDL_VIDEODRIVER") == NULL) {
+		SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+	}
+	if (SDL_Init(0) < 0) {
+		SDL_Log("SDL_Init failed: %s", SDL_GetError());
+		return 2;
+	}
+
+	/* Offscreen surface, software renderer on it and a texture for the textured polygons */
+	memset(&target, 0, sizeof(target));
+	target.surface = SDL_CreateRGBSurface(0, WIDTH, HEIGHT, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+	target.texture = SDL_CreateRGBSurface(0, 32, 32, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+	if ((target.surface == NULL) || (target.texture == NULL)) {
+		SDL_Log("Creating surfaces failed: %s", SDL_GetError());
+		return 2;
+	}
+	target.renderer = SDL_CreateSoftwareRenderer(target.surface);
+	if (target.renderer == NULL) {
+		SDL_Log("Creating software renderer failed: %s", SDL_GetError());
+		return 2;
+	}
+	for (k = 0; k < 32 * 32; k++) {
+		((Uint32 *)target.texture->pixels)[k] = ((k / 32 + k % 32) & 4) ? 0xFFE0A020 : 0xFF2040C0;
+	}
+
+	/* Positions keeping every primitive of a size class visible, and nonzero colors */
+	srand(1);
+	for (s = 0; s < NUM_SIZES; s++) {
+		for (k = 0; k < NUM_POSITIONS; k++) {
+			px[s][k] = (Sint16)(sizes[s].size + rand() % (WIDTH - 2 * sizes[s].size));
+			py[s][k] = (Sint16)(sizes[s].size + rand() % (HEIGHT - 2 * sizes[s].size));
+		}
+	}
+	for (k = 0; k < NUM_POSITIONS; k++) {
+		cr[k] = (Uint8)(rand() | 1);
+		cg[k] = (Uint8)(rand() | 1);
+		cb[k] = (Uint8)(rand() | 1);
+	}
+
+	if (output) {
+		out = fopen(output, "w");
+		if (out == NULL) {
+			SDL_Log("Cannot open %s", output);
+			return 2;
+		}
+	}
+
+	minTicks = SDL_GetPerformanceFrequency() * (Uint64)timeMs / 1000;
+	first = 1;
+	printHeader(out, json);
+	for (t = 0; t < 2; t++) {
+		if (!(targets & (1 << t))) {
+			continue;
+		}
+		target.useSurface = t;
+		for (c = 0; c < NUM_CASES; c++) {
+			if ((filter) && (strstr(cases[c].name, filter) == NULL)) {
+				continue;
+			}
+			for (s = 0; s < NUM_SIZES; s++) {
+				sizeIndex = s;
+				for (a = 0; a < 2; a++) {
+					/* Textured polygons have no alpha parameter */
+					if ((a) && (cases[c].func == benchTexturedPolygon)) {
+						continue;
+					}
+					result.name = cases[c].name;
+					result.target = (t) ? "surface" : "renderer";
+					result.size = sizes[s].name;
+					result.alpha = a;
+					benchRun(&target, &cases[c], sizes[s].size, (Uint8)((a) ? 128 : 255), minTicks, &result);
+					printResult(out, json, first, &result);
+					first = 0;
+				}
+			}
+		}
+	}
+	printFooter(out, json);
+
+	if (out != stdout) {
+		fclose(out);
+	}
+	gfxReleaseRenderer(target.renderer);
+	SDL_DestroyRenderer(target.renderer);
+	SDL_FreeSurface(target.texture);
+	SDL_FreeSurface(target.surface);
+	SDL_Quit();
+
+	return 0;
+}
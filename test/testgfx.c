@@ -217,8 +217,8 @@ void ClearCenter(SDL_Renderer *renderer, const char *title)
 	stringRGBA (renderer, WIDTH/2 - 4*strlen(title),r.y + 2,title,255,255,255,255);
 }
 
-/* !< Function pointer to a primitives test function */
-typedef int (*PrimitivesTestCaseFp)(SDL_Renderer *renderer);
+/* !< Function pointer to a primitives test function */
+typedef int (*PrimitivesTestCaseFp)(SDL_Renderer *renderer);
 
 void ExecuteTest(SDL_Renderer *renderer, PrimitivesTestCaseFp testCase, int testNum, const char * testName)
 {
@@ -1491,11 +1491,727 @@ int TestTexturedPolygon(SDL_Renderer *renderer)
 	return (4 * NUM_RANDOM) / step;
 }
 
+int TestThickPolyline(SDL_Renderer *renderer)
+{
+	int i;
+	char r,g,b;
+	int step = 5;
+
+	/* Draw A=255 */
+	SetViewport(renderer,0,60,WIDTH/2,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		thickPolylineRGBA(renderer, &rx[i], &ry[i], 4, lw[i], (gfxLineJoin)(i % 3), (gfxLineCap)((i / 3) % 3), rr[i], rg[i], rb[i], 255);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,60,WIDTH,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		thickPolylineRGBA(renderer, &rx[i], &ry[i], 4, lw[i], (gfxLineJoin)(i % 3), (gfxLineCap)((i / 3) % 3), rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,80+(HEIGHT-80)/2,WIDTH,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		thickPolylineRGBA(renderer, &rx[i], &ry[i], 4, lw[i], (gfxLineJoin)(i % 3), (gfxLineCap)((i / 3) % 3), rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw Colortest */
+	SetViewport(renderer,0,80+(HEIGHT-80)/2,WIDTH/2,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		if (rx[i] < (WIDTH/6))  {
+			r=255; g=0; b=0; 
+		} else if (rx[i] < (WIDTH/3) ) {
+			r=0; g=255; b=0; 
+		} else {
+			r=0; g=0; b=255; 
+		}
+		rx[i+1]=rx[i]+rr1[i];
+		rx[i+2]=rx[i];
+		ry[i+1]=ry[i];
+		ry[i+2]=ry[i]+rr2[i];
+		thickPolylineRGBA(renderer, &rx[i], &ry[i], 3, lw[i], GFX_JOIN_MITER, GFX_CAP_BUTT, r, g, b, 255);
+	}
+
+	/* Clear viewport */
+	ClearViewport(renderer);
+
+	/* Accuracy test */
+	ClearCenter(renderer, "3pt thick polyline");
+	rx[0] = WIDTH/2; ry[0] = HEIGHT/2;
+	rx[1] = rx[0] + 5; 	ry[1] = ry[0] + 5;
+	rx[2] = rx[0] + 10; ry[2] = ry[0] - 5;
+	thickPolylineRGBA(renderer, rx, ry, 3, 3, GFX_JOIN_MITER, GFX_CAP_BUTT, 255, 255, 255, 255);
+
+	return (4 * NUM_RANDOM) / step;
+}
+
+int TestAAFilledPolygon(SDL_Renderer *renderer)
+{
+	int i;
+	char r,g,b;
+	int step = 4;
+
+	/* Draw A=255 */
+	SetViewport(renderer,0,60,WIDTH/2,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-3); i += step) {
+		aafilledPolygonRGBA(renderer, &rx[i], &ry[i], 3, rr[i], rg[i], rb[i], 255);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,60,WIDTH,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-3); i += step) {
+		aafilledPolygonRGBA(renderer, &rx[i], &ry[i], 3, rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,80+(HEIGHT-80)/2,WIDTH,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-3); i += step) {
+		aafilledPolygonRGBA(renderer, &rx[i], &ry[i], 3, rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw Colortest */
+	SetViewport(renderer,0,80+(HEIGHT-80)/2,WIDTH/2,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-3); i += step) {
+		if (rx[i] < (WIDTH/6))  {
+			r=255; g=0; b=0; 
+		} else if (rx[i] < (WIDTH/3) ) {
+			r=0; g=255; b=0; 
+		} else {
+			r=0; g=0; b=255; 
+		}
+		rx[i+1]=rx[i]+rr1[i];
+		rx[i+2]=rx[i];
+		ry[i+1]=ry[i];
+		ry[i+2]=ry[i]+rr2[i];
+		aafilledPolygonRGBA(renderer, &rx[i], &ry[i], 3, r, g, b, 255);
+	}
+
+	/* Clear viewport */
+	ClearViewport(renderer);
+
+	/* Accuracy test */
+	ClearCenter(renderer, "3pt AA F poly");
+	rx[0] = WIDTH/2; ry[0] = HEIGHT/2;
+	rx[1] = rx[0] + 5; 	ry[1] = ry[0] + 5;
+	rx[2] = rx[0] + 10; ry[2] = ry[0] - 5;
+	aafilledPolygonRGBA(renderer, rx, ry, 3, 255, 255, 255, 255);
+
+	return (4 * NUM_RANDOM) / step;
+}
+
+int TestBezierCubic(SDL_Renderer *renderer)
+{
+	int i;
+	char r,g,b;
+	int step = 5;
+
+	/* Draw A=255 */
+	SetViewport(renderer,0,60,WIDTH/2,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		bezierCubicRGBA(renderer, rx[i], ry[i], rx[i+1], ry[i+1], rx[i+2], ry[i+2], rx[i+3], ry[i+3], rr[i], rg[i], rb[i], 255);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,60,WIDTH,60+(HEIGHT-80)/2);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		bezierCubicRGBA(renderer, rx[i], ry[i], rx[i+1], ry[i+1], rx[i+2], ry[i+2], rx[i+3], ry[i+3], rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,80+(HEIGHT-80)/2,WIDTH,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		bezierQuadRGBA(renderer, rx[i], ry[i], rx[i+1], ry[i+1], rx[i+2], ry[i+2], rr[i], rg[i], rb[i], ra[i]);
+	}
+
+	/* Draw Colortest */
+	SetViewport(renderer,0,80+(HEIGHT-80)/2,WIDTH/2,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-4); i += step) {
+		if (rx[i] < (WIDTH/6))  {
+			r=255; g=0; b=0; 
+		} else if (rx[i] < (WIDTH/3) ) {
+			r=0; g=255; b=0; 
+		} else {
+			r=0; g=0; b=255; 
+		}
+		bezierCubicRGBA(renderer, rx[i], ry[i], rx[i]+rr1[i], ry[i], rx[i], ry[i]+rr2[i], rx[i]+rr1[i], ry[i]+rr2[i], r, g, b, 255);
+	}
+
+	/* Clear viewport */
+	ClearViewport(renderer);
+
+	/* Accuracy test */
+	ClearCenter(renderer, "cubic bezier");
+	rx[0] = WIDTH/2; ry[0] = HEIGHT/2;
+	bezierCubicRGBA(renderer, rx[0], ry[0], rx[0] + 5, ry[0] + 5, rx[0] + 10, ry[0] - 5, rx[0] + 15, ry[0], 255, 255, 255, 255);
+
+	return (4 * NUM_RANDOM) / step;
+}
+
+int TestGradients(SDL_Renderer *renderer)
+{
+	int i;
+	int step = 7;
+
+	/* Draw A=255 */
+	SetViewport(renderer,0,60,WIDTH/2,60+(HEIGHT-80)/2);
+	for (i=0; i<NUM_RANDOM; i += step) {
+		boxGradientRGBA(renderer, rx[i], ry[i], rx[i]+rr1[i], ry[i]+rr2[i], (gfxGradientDirection)(i & 1), 
+			rr[i], rg[i], rb[i], 255, rb[i], rr[i], rg[i], 255);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,60,WIDTH,60+(HEIGHT-80)/2);
+	for (i=0; i<NUM_RANDOM; i += step) {
+		roundedBoxGradientRGBA(renderer, rx[i], ry[i], rx[i]+rr1[i], ry[i]+rr2[i], 4, (gfxGradientDirection)(i & 1), 
+			rr[i], rg[i], rb[i], ra[i], rb[i], rr[i], rg[i], 255);
+	}
+
+	/* Draw A=various */
+	SetViewport(renderer,WIDTH/2,80+(HEIGHT-80)/2,WIDTH,HEIGHT);
+	for (i=0; i<NUM_RANDOM; i += step) {
+		filledCircleRadialGradientRGBA(renderer, rx[i], ry[i], rr1[i], rr[i], rg[i], rb[i], 255, rb[i], rr[i], rg[i], ra[i]);
+	}
+
+	/* Draw Colortest */
+	SetViewport(renderer,0,80+(HEIGHT-80)/2,WIDTH/2,HEIGHT);
+	for (i=0; i<(NUM_RANDOM-3); i += step) {
+		filledPolygonGradientRGBA(renderer, &rx[i], &ry[i], 3, (gfxGradientDirection)(i & 1), 255, 0, 0, 255, 0, 0, 255, 255);
+	}
+
+	/* Clear viewport */
+	ClearViewport(renderer);
+
+	/* Accuracy test */
+	ClearCenter(renderer, "gradient box");
+	boxGradientRGBA(renderer, WIDTH/2, HEIGHT/2 - 5, WIDTH/2 + 10, HEIGHT/2 + 5, GFX_GRADIENT_VERTICAL, 255, 0, 0, 255, 0, 0, 255, 255);
+
+	return (4 * NUM_RANDOM) / step;
+}
+
+/* --------------------- Checks ------------------------ */
+
+/* Size of the offscreen surface the checks draw on */
+#define CHECK_WIDTH	64
+#define CHECK_HEIGHT	64
+
+/* Number of failed checks */
+static int checkFailures = 0;
+
+/* Frames read back by the checks */
+static Uint32 checkFrame[CHECK_WIDTH * CHECK_HEIGHT], checkExpected[CHECK_WIDTH * CHECK_HEIGHT];
+
+/* Log the result of a check */
+void CheckResult(const char *name, int passed)
+{
+	if (passed) {
+		SDL_Log("Check %-24s passed", name);
+	} else {
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Check %-24s FAILED", name);
+		checkFailures++;
+	}
+}
+
+/* Clear the whole check renderer to opaque black using plain SDL calls */
+void CheckClear(SDL_Renderer *renderer)
+{
+	SDL_RenderSetViewport(renderer, NULL);
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+	SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+	SDL_RenderClear(renderer);
+}
+
+/* Read back the check renderer as RGBA8888 pixels */
+void CheckRead(SDL_Renderer *renderer, Uint32 *pixels)
+{
+	SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGBA8888, pixels, CHECK_WIDTH * 4);
+}
+
+/* Create a surface in the format read back by CheckRead */
+SDL_Surface *CheckCreateSurface(void)
+{
+	return SDL_CreateRGBSurface(SDL_SWSURFACE, CHECK_WIDTH, CHECK_HEIGHT, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+}
+
+/* Clear a check surface to opaque black */
+void CheckClearSurface(SDL_Surface *surface)
+{
+	SDL_FillRect(surface, NULL, 0x000000FF);
+}
+
+/* Read back a check surface */
+void CheckReadSurface(SDL_Surface *surface, Uint32 *pixels)
+{
+	int y;
+	for (y = 0; y < CHECK_HEIGHT; y++) {
+		memcpy(pixels + y * CHECK_WIDTH, (Uint8 *)surface->pixels + y * surface->pitch, CHECK_WIDTH * 4);
+	}
+}
+
+/* Count the pixels which differ between two frames; with coverage set only drawn vs. black is compared */
+int CheckDiff(const Uint32 *a, const Uint32 *b, int coverage)
+{
+	int i, n = 0;
+	for (i = 0; i < CHECK_WIDTH * CHECK_HEIGHT; i++) {
+		if (coverage) {
+			n += ((a[i] != 0x000000FF) != (b[i] != 0x000000FF));
+		} else {
+			n += (a[i] != b[i]);
+		}
+	}
+	return n;
+}
+
+/* Get a pixel of a frame */
+Uint32 CheckPixel(const Uint32 *pixels, int x, int y)
+{
+	return pixels[y * CHECK_WIDTH + x];
+}
+
+/* Test if a color channel of a pixel is close to a value */
+int CheckChannel(Uint32 pixel, int shift, int value)
+{
+	return (abs((int)((pixel >> shift) & 0xFF) - value) <= 2);
+}
+
+/* Primitives drawn once directly and once batched */
+void DrawBatchScene(SDL_Renderer *renderer)
+{
+	int i;
+	for (i = 0; i < 16; i++) {
+		boxRGBA(renderer, 2 + i * 3, 2, 3 + i * 3, 20, (i & 1) ? 255 : 0, (i & 1) ? 0 : 255, 0, 255);
+		hlineRGBA(renderer, 2, 60, 24 + i * 2, 0, 0, 255, 255);
+		vlineRGBA(renderer, 2 + i * 3, 58, 61, 255, 0, 255, 255);
+		pixelRGBA(renderer, 2 + i * 3, 62, 255, 255, 255, 255);
+	}
+	rectangleRGBA(renderer, 8, 8, 40, 40, 0, 255, 255, 255);
+	boxRGBA(renderer, 10, 10, 50, 50, 255, 255, 0, 128);
+	for (i = 0; i < 8; i++) {
+		lineRGBA(renderer, 4, 22 + i * 4, 60, 30 + i * 3, 255, 255, 255, 96);
+		boxRGBA(renderer, 20 + i * 2, 24, 30 + i * 2, 34, (i & 1) ? 255 : 0, 0, (i & 1) ? 0 : 255, 128);
+		trigonRGBA(renderer, 40 + i, 40, 60, 44 + i, 44, 60, 0, 255, 0, 96);
+	}
+}
+
+/* Batched primitives draw the same pixels as unbatched ones */
+void CheckBatch(SDL_Renderer *renderer)
+{
+	gfxBatch *batch;
+
+	CheckClear(renderer);
+	DrawBatchScene(renderer);
+	CheckRead(renderer, checkExpected);
+
+	CheckClear(renderer);
+	batch = gfxCreateBatch(renderer);
+	gfxBeginBatch(batch);
+	DrawBatchScene(renderer);
+	gfxEndBatch(batch);
+	gfxDestroyBatch(batch);
+	CheckRead(renderer, checkFrame);
+
+	CheckResult("batch", (batch != NULL) && (CheckDiff(checkExpected, checkFrame, 0) == 0));
+}
+
+/* Primitives drawn once directly and once from a display list */
+void DrawDisplayListScene(SDL_Renderer *renderer, SDL_Surface *texture, int x, int y)
+{
+	Sint16 vx[4], vy[4];
+
+	boxRGBA(renderer, x + 2, y + 2, x + 20, y + 12, 255, 0, 0, 255);
+	filledCircleRGBA(renderer, x + 30, y + 20, 9, 0, 255, 0, 255);
+	hlineRGBA(renderer, x + 2, x + 40, y + 35, 0, 0, 255, 255);
+	roundedBoxRGBA(renderer, x + 4, y + 38, x + 30, y + 50, 5, 255, 255, 0, 255);
+	vx[0] = x + 42; vy[0] = y + 30;
+	vx[1] = x + 55; vy[1] = y + 34;
+	vx[2] = x + 50; vy[2] = y + 52;
+	vx[3] = x + 36; vy[3] = y + 45;
+	texturedPolygon(renderer, vx, vy, 4, texture, x, -y);
+}
+
+/* A display list draws what was recorded at the offset it is drawn at */
+void CheckDisplayList(SDL_Renderer *renderer)
+{
+	gfxDisplayList *list;
+	SDL_Surface *texture;
+	Uint32 *pixels;
+	int i, diff = 0;
+
+	texture = SDL_CreateRGBSurface(SDL_SWSURFACE, 3, 2, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+	if (texture == NULL) {
+		CheckResult("display list", 0);
+		return;
+	}
+	for (i = 0; i < 6; i++) {
+		pixels = (Uint32 *)((Uint8 *)texture->pixels + (i / 3) * texture->pitch) + i % 3;
+		*pixels = (i & 1) ? 0xFF00FFFF : 0x00FFFFFF;
+	}
+
+	/* Textured polygons are recorded without texture caching */
+	list = gfxCreateDisplayList(renderer);
+	gfxBeginDisplayList(list);
+	DrawDisplayListScene(renderer, texture, 0, 0);
+	gfxEndDisplayList(list);
+
+	CheckClear(renderer);
+	DrawDisplayListScene(renderer, texture, 0, 0);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	gfxDrawDisplayList(list, 0, 0);
+	CheckRead(renderer, checkFrame);
+	diff += CheckDiff(checkExpected, checkFrame, 0);
+
+	CheckClear(renderer);
+	DrawDisplayListScene(renderer, texture, 7, 5);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	gfxDrawDisplayList(list, 7, 5);
+	CheckRead(renderer, checkFrame);
+	diff += CheckDiff(checkExpected, checkFrame, 0);
+
+	gfxDestroyDisplayList(list);
+	SDL_FreeSurface(texture);
+
+	CheckResult("display list", (list != NULL) && (diff == 0));
+}
+
+/* A thick polyline covers its segments and the outside of its miter join, but not beyond its width,
+   and draws the same pixels on renderers and surfaces */
+void CheckThickPolyline(SDL_Renderer *renderer)
+{
+	Sint16 vx[3] = { 10, 50, 50 };
+	Sint16 vy[3] = { 10, 10, 50 };
+	Sint16 zx[4] = { 8, 30, 41, 55 };
+	Sint16 zy[4] = { 12, 50, 9, 33 };
+	SDL_Surface *surface;
+	int width, join, passed, diff = 0;
+
+	CheckClear(renderer);
+	thickPolylineRGBA(renderer, vx, vy, 3, 5, GFX_JOIN_MITER, GFX_CAP_BUTT, 255, 255, 255, 255);
+	CheckRead(renderer, checkFrame);
+	passed = (CheckPixel(checkFrame, 30, 10) == 0xFFFFFFFF) && (CheckPixel(checkFrame, 50, 30) == 0xFFFFFFFF) &&
+		(CheckPixel(checkFrame, 52, 8) == 0xFFFFFFFF) && (CheckPixel(checkFrame, 30, 20) == 0x000000FF) &&
+		(CheckPixel(checkFrame, 30, 14) == 0x000000FF);
+
+	surface = CheckCreateSurface();
+	for (width = 2; (surface != NULL) && (width <= 9); width++) {
+		for (join = GFX_JOIN_MITER; join <= GFX_JOIN_BEVEL; join++) {
+			CheckClear(renderer);
+			thickPolylineRGBA(renderer, zx, zy, 4, width, (gfxLineJoin)join, (gfxLineCap)join, 255, 255, 255, 255);
+			CheckRead(renderer, checkFrame);
+			CheckClearSurface(surface);
+			thickPolylineRGBA_Surface(surface, zx, zy, 4, width, (gfxLineJoin)join, (gfxLineCap)join, 255, 255, 255, 255);
+			CheckReadSurface(surface, checkExpected);
+			diff += CheckDiff(checkExpected, checkFrame, 0);
+		}
+	}
+	SDL_FreeSurface(surface);
+
+	CheckResult("thick polyline", passed && (surface != NULL) && (diff == 0));
+}
+
+/* An anti-aliased filled polygon is opaque inside and leaves the outside untouched */
+void CheckAAFilledPolygon(SDL_Renderer *renderer)
+{
+	Sint16 vx[4] = { 10, 40, 40, 10 };
+	Sint16 vy[4] = { 10, 10, 40, 40 };
+
+	CheckClear(renderer);
+	aafilledPolygonRGBA(renderer, vx, vy, 4, 255, 255, 255, 255);
+	CheckRead(renderer, checkFrame);
+
+	CheckResult("aafilledPolygon", 
+		(CheckPixel(checkFrame, 25, 25) == 0xFFFFFFFF) && (CheckPixel(checkFrame, 11, 11) == 0xFFFFFFFF) &&
+		(CheckPixel(checkFrame, 5, 5) == 0x000000FF) && (CheckPixel(checkFrame, 45, 25) == 0x000000FF));
+}
+
+/* Translucent rounded boxes blend every covered pixel exactly once (a radius below 2 draws an outline) */
+void CheckRoundedBox(SDL_Renderer *renderer)
+{
+	Uint32 blended;
+	int w, h, rad, i, covered, passed = 1;
+
+	CheckClear(renderer);
+	pixelRGBA(renderer, 0, 0, 255, 255, 255, 128);
+	CheckRead(renderer, checkFrame);
+	blended = CheckPixel(checkFrame, 0, 0);
+
+	for (w = 1; w <= 12; w++) {
+		for (h = 1; h <= 12; h++) {
+			for (rad = 2; rad <= 7; rad++) {
+				CheckClear(renderer);
+				roundedBoxRGBA(renderer, 5, 5, 5 + w, 5 + h, rad, 255, 255, 255, 128);
+				CheckRead(renderer, checkFrame);
+				covered = 0;
+				for (i = 0; i < CHECK_WIDTH * CHECK_HEIGHT; i++) {
+					if (checkFrame[i] == blended) {
+						covered++;
+					} else if (checkFrame[i] != 0x000000FF) {
+						passed = 0;
+					}
+				}
+				passed = passed && (covered > 0);
+			}
+		}
+	}
+
+	CheckResult("roundedBox", passed);
+}
+
+/* Textured polygons cover the same pixels as filled polygons and repeat the texture */
+void CheckTexturedPolygon(SDL_Renderer *renderer)
+{
+	Sint16 vx[5] = { 5, 50, 58, 30, 12 };
+	Sint16 vy[5] = { 8, 3, 44, 25, 60 };
+	SDL_Surface *texture;
+	Uint32 *pixels;
+	int diff, colors;
+
+	texture = SDL_CreateRGBSurface(SDL_SWSURFACE, 2, 3, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+	if (texture == NULL) {
+		CheckResult("texturedPolygon", 0);
+		return;
+	}
+	pixels = (Uint32 *)texture->pixels;
+	pixels[0] = pixels[texture->pitch / 4] = pixels[2 * texture->pitch / 4] = 0xFF0000FF;
+	pixels[1] = pixels[texture->pitch / 4 + 1] = pixels[2 * texture->pitch / 4 + 1] = 0x00FF00FF;
+
+	CheckClear(renderer);
+	filledPolygonRGBA(renderer, vx, vy, 5, 255, 255, 255, 255);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	texturedPolygon(renderer, vx, vy, 5, texture, 0, 0);
+	CheckRead(renderer, checkFrame);
+	diff = CheckDiff(checkExpected, checkFrame, 1);
+	colors = (CheckPixel(checkFrame, 38, 20) == 0xFF0000FF) && (CheckPixel(checkFrame, 39, 20) == 0x00FF00FF);
+
+	SDL_FreeSurface(texture);
+	CheckResult("texturedPolygon", (diff == 0) && colors);
+}
+
+/* Gradients cover the same pixels as the solid shapes, each once, and start and end in their colors */
+void CheckGradients(SDL_Renderer *renderer)
+{
+	Sint16 vx[4] = { 5, 50, 58, 12 };
+	Sint16 vy[4] = { 8, 3, 44, 60 };
+	int diff = 0, colors, rad, i;
+	SDL_Surface *surface;
+
+	CheckClear(renderer);
+	boxRGBA(renderer, 5, 6, 40, 50, 255, 255, 255, 255);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	boxGradientRGBA(renderer, 5, 6, 40, 50, GFX_GRADIENT_VERTICAL, 255, 0, 0, 255, 0, 0, 255, 255);
+	CheckRead(renderer, checkFrame);
+	diff += CheckDiff(checkExpected, checkFrame, 1);
+	colors = CheckChannel(CheckPixel(checkFrame, 20, 6), 24, 255) && CheckChannel(CheckPixel(checkFrame, 20, 6), 8, 0) &&
+		CheckChannel(CheckPixel(checkFrame, 20, 50), 24, 0) && CheckChannel(CheckPixel(checkFrame, 20, 50), 8, 255);
+
+	CheckClear(renderer);
+	roundedBoxRGBA(renderer, 5, 6, 40, 50, 9, 255, 255, 255, 255);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	roundedBoxGradientRGBA(renderer, 5, 6, 40, 50, 9, GFX_GRADIENT_HORIZONTAL, 255, 0, 0, 255, 0, 0, 255, 255);
+	CheckRead(renderer, checkFrame);
+	diff += CheckDiff(checkExpected, checkFrame, 1);
+
+	/* A radius beyond half the box is fitted to it once for the renderer and the surface */
+	surface = CheckCreateSurface();
+	for (rad = 4; rad <= 40; rad += 6) {
+		CheckClear(renderer);
+		boxRGBA(renderer, 20, 5, 29, 40, 255, 255, 255, 255);
+		CheckRead(renderer, checkExpected);
+		CheckClear(renderer);
+		roundedBoxGradientRGBA(renderer, 20, 5, 29, 40, rad, GFX_GRADIENT_VERTICAL, 255, 0, 0, 255, 0, 0, 255, 255);
+		CheckRead(renderer, checkFrame);
+		for (i = 0; i < CHECK_WIDTH * CHECK_HEIGHT; i++) {
+			diff += ((checkFrame[i] != 0x000000FF) && (checkExpected[i] == 0x000000FF));
+		}
+		if (surface != NULL) {
+			CheckClearSurface(surface);
+			roundedBoxGradientRGBA_Surface(surface, 20, 5, 29, 40, rad, GFX_GRADIENT_VERTICAL, 255, 0, 0, 255, 0, 0, 255, 255);
+			CheckReadSurface(surface, checkExpected);
+			diff += CheckDiff(checkExpected, checkFrame, 1);
+		}
+	}
+	SDL_FreeSurface(surface);
+
+	CheckClear(renderer);
+	filledPolygonRGBA(renderer, vx, vy, 4, 255, 255, 255, 255);
+	CheckRead(renderer, checkExpected);
+	CheckClear(renderer);
+	filledPolygonGradientRGBA(renderer, vx, vy, 4, GFX_GRADIENT_VERTICAL, 255, 0, 0, 255, 0, 0, 255, 255);
+	CheckRead(renderer, checkFrame);
+	diff += CheckDiff(checkExpected, checkFrame, 1);
+
+	for (rad = 0; rad <= 25; rad++) {
+		CheckClear(renderer);
+		filledCircleRGBA(renderer, 31, 31, rad, 255, 255, 255, 255);
+		CheckRead(renderer, checkExpected);
+		CheckClear(renderer);
+		filledCircleRadialGradientRGBA(renderer, 31, 31, rad, 255, 0, 0, 255, 0, 0, 255, 255);
+		CheckRead(renderer, checkFrame);
+		diff += CheckDiff(checkExpected, checkFrame, 1);
+	}
+	colors = colors && CheckChannel(CheckPixel(checkFrame, 31, 31), 24, 255) && CheckChannel(CheckPixel(checkFrame, 31, 31), 8, 0) &&
+		(CheckPixel(checkFrame, 31, 6) >> 24 < 16) && (((CheckPixel(checkFrame, 31, 6) >> 8) & 0xFF) > 239);
+
+	/* Every pixel is drawn once */
+	CheckClear(renderer);
+	filledCircleRadialGradientRGBA(renderer, 31, 31, 20, 255, 0, 0, 128, 255, 0, 0, 128);
+	CheckRead(renderer, checkFrame);
+	for (i = 0; i < CHECK_WIDTH * CHECK_HEIGHT; i++) {
+		colors = colors && ((checkFrame[i] == 0x000000FF) || CheckChannel(checkFrame[i], 24, 128));
+	}
+
+	CheckResult("gradients", (diff == 0) && colors);
+}
+
+/* A cubic bezier curve is drawn through its end points */
+void CheckBezierCubic(SDL_Renderer *renderer)
+{
+	CheckClear(renderer);
+	bezierCubicRGBA(renderer, 5, 5, 60, 5, 5, 60, 60, 40, 255, 255, 255, 255);
+	CheckRead(renderer, checkFrame);
+
+	CheckResult("bezierCubic", (CheckPixel(checkFrame, 5, 5) == 0xFFFFFFFF) && (CheckPixel(checkFrame, 60, 40) == 0xFFFFFFFF));
+}
+
+/* Damaged rectangles are reported in render target coordinates and contain every changed pixel */
+void CheckDamage(SDL_Renderer *renderer)
+{
+	SDL_Rect viewport, rects[8];
+	int n, i, x, y, j, inside, passed;
+
+	CheckClear(renderer);
+	CheckRead(renderer, checkExpected);
+	gfxSetDamageTracking(8);
+	viewport.x = 13;
+	viewport.y = 7;
+	viewport.w = 40;
+	viewport.h = 40;
+	SDL_RenderSetViewport(renderer, &viewport);
+	boxRGBA(renderer, 2, 2, 9, 9, 255, 255, 255, 255);
+	SDL_RenderSetViewport(renderer, NULL);
+	aacircleRGBA(renderer, 40, 45, 8, 255, 0, 0, 255);
+	CheckRead(renderer, checkFrame);
+	n = gfxGetDamageRects(rects, 8);
+	gfxSetDamageTracking(0);
+
+	passed = (n == 2) && (rects[0].x == 15) && (rects[0].y == 9) && (rects[0].w == 8) && (rects[0].h == 8);
+	for (i = 0; i < CHECK_WIDTH * CHECK_HEIGHT; i++) {
+		if (checkFrame[i] == checkExpected[i]) {
+			continue;
+		}
+		x = i % CHECK_WIDTH;
+		y = i / CHECK_WIDTH;
+		inside = 0;
+		for (j = 0; j < SDL_min(n, 8); j++) {
+			if ((x >= rects[j].x) && (y >= rects[j].y) && (x < rects[j].x + rects[j].w) && (y < rects[j].y + rects[j].h)) {
+				inside = 1;
+			}
+		}
+		passed = passed && inside;
+	}
+
+	CheckResult("damage tracking", passed);
+}
+
+/* With state shadowing repeated state calls are skipped, and invalidating honors plain SDL calls */
+void CheckStateShadowing(SDL_Renderer *renderer)
+{
+	Uint32 pixel, elided1, elided2;
+
+	gfxPrimitivesSetStateShadowing(1);
+	CheckClear(renderer);
+	gfxGetRendererStateStats(renderer, NULL, &elided1);
+	boxRGBA(renderer, 0, 0, 3, 3, 255, 0, 0, 128);
+	boxRGBA(renderer, 4, 0, 7, 3, 255, 0, 0, 128);
+	gfxGetRendererStateStats(renderer, NULL, &elided2);
+	CheckClear(renderer);
+	gfxInvalidateRendererState(renderer);
+	boxRGBA(renderer, 0, 0, 3, 3, 255, 0, 0, 128);
+	CheckRead(renderer, checkFrame);
+	gfxPrimitivesSetStateShadowing(0);
+
+	pixel = CheckPixel(checkFrame, 1, 1);
+	CheckResult("state shadowing", (elided2 > elided1) && CheckChannel(pixel, 24, 128) && CheckChannel(pixel, 16, 0) && CheckChannel(pixel, 8, 0));
+}
+
+/* Bezier curves of many points and steps stay within the bounding box of their points */
+void CheckBezier(SDL_Renderer *renderer)
+{
+	static const int points[4] = { 9, 13, 16, 24 };
+	static const int steps[3] = { 20, 100, 200 };
+	Sint16 vx[24], vy[24];
+	int i, j, k, x, y, passed = 1;
+
+	for (i = 0; i < 4; i++) {
+		for (k = 0; k < points[i]; k++) {
+			vx[k] = 4 + (k * 37) % 56;
+			vy[k] = (k & 1) ? 59 : 4;
+		}
+		for (j = 0; j < 3; j++) {
+			CheckClear(renderer);
+			bezierRGBA(renderer, vx, vy, points[i], steps[j], 255, 255, 255, 255);
+			CheckRead(renderer, checkFrame);
+			for (k = 0; k < CHECK_WIDTH * CHECK_HEIGHT; k++) {
+				x = k % CHECK_WIDTH;
+				y = k / CHECK_WIDTH;
+				if ((checkFrame[k] != 0x000000FF) && ((x < 4) || (x > 59) || (y < 4) || (y > 59))) {
+					passed = 0;
+				}
+			}
+			passed = passed && (CheckPixel(checkFrame, vx[0], vy[0]) == 0xFFFFFFFF);
+			passed = passed && (CheckPixel(checkFrame, vx[points[i] - 1], vy[points[i] - 1]) == 0xFFFFFFFF);
+		}
+	}
+
+	CheckResult("bezier", passed);
+}
+
+/* Run the pixel checks on an offscreen software renderer */
+int RunChecks(void)
+{
+	SDL_Surface *surface;
+	SDL_Renderer *renderer;
+
+	surface = SDL_CreateRGBSurface(SDL_SWSURFACE, CHECK_WIDTH, CHECK_HEIGHT, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+	if (surface == NULL) {
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+		return 1;
+	}
+	renderer = SDL_CreateSoftwareRenderer(surface);
+	if (renderer == NULL) {
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s\n", SDL_GetError());
+		SDL_FreeSurface(surface);
+		return 1;
+	}
+
+	CheckBatch(renderer);
+	CheckDisplayList(renderer);
+	CheckThickPolyline(renderer);
+	CheckAAFilledPolygon(renderer);
+	CheckRoundedBox(renderer);
+	CheckTexturedPolygon(renderer);
+	CheckGradients(renderer);
+	CheckBezier(renderer);
+	CheckBezierCubic(renderer);
+	CheckDamage(renderer);
+	CheckStateShadowing(renderer);
+
+	gfxReleaseRenderer(renderer);
+	SDL_DestroyRenderer(renderer);
+	SDL_FreeSurface(surface);
+
+	SDL_Log("%d check(s) failed", checkFailures);
+	return (checkFailures > 0) ? 1 : 0;
+}
+
 /* ====== Main */
 
 int main(int argc, char *argv[])
 {
-    int i, done, drawn, test = 0;
+    int i, done, drawn, test = 0, check = 0;
     SDL_Event event;
     Uint32 then, now, frames;
     int numTests;
@@ -1519,19 +2235,29 @@ int main(int argc, char *argv[])
                  test = SDL_atoi(argv[i + 1]);
                  consumed = 2;
                }
+            } else if (SDL_strcasecmp(argv[i], "--check") == 0) {
+              check = 1;
+              consumed = 1;
             }
         }
                  
            
         if (consumed < 0) {
             fprintf(stderr,
-                    "Usage: %s %s [--test N]\n",
+                    "Usage: %s %s [--test N] [--check]\n",
                     argv[0], SDLTest_CommonUsage(state));
             return 1;
         }
         i += consumed;
     }
     
+    /* Run the pixel checks offscreen instead of the visual tests */
+    if (check) {
+        done = RunChecks();
+        SDLTest_CommonQuit(state);
+        return done;
+    }
+
     if (!SDLTest_CommonInit(state)) {
         return 2;
     }
@@ -1590,7 +2316,7 @@ int main(int argc, char *argv[])
 
 		if (!drawn) {
 			/* Set test range */
-			numTests = 24;
+			numTests = 28;
 			if (test < 0) { 
 				test = (numTests - 1); 
 			} else {
@@ -1705,6 +2431,22 @@ int main(int argc, char *argv[])
 						ExecuteTest(renderer, TestThickLineAccuracy, test, "ThickLine (Accuracy)");
 						break;
 					}					
+					case 25: {
+						ExecuteTest(renderer, TestThickPolyline, test, "ThickPolyline");
+						break;
+					}
+					case 26: {
+						ExecuteTest(renderer, TestAAFilledPolygon, test, "AAFilledPolygon");
+						break;
+					}
+					case 27: {
+						ExecuteTest(renderer, TestBezierCubic, test, "BezierCubic");
+						break;
+					}
+					case 28: {
+						ExecuteTest(renderer, TestGradients, test, "Gradients");
+						break;
+					}
 					default: {
 						ClearScreen(renderer, "Unknown Test");
 						break;